@@ -0,0 +1,351 @@
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <Penrose/Assets/AssetManager.hpp>
+#include <Penrose/ECS/EntityManager.hpp>
+#include <Penrose/Engine.hpp>
+#include <Penrose/Events/EngineEvents.hpp>
+#include <Penrose/Performance/ChromeTrace.hpp>
+#include <Penrose/Performance/FrameStats.hpp>
+#include <Penrose/Performance/Profiler.hpp>
+#include <Penrose/Rendering/RenderManager.hpp>
+#include <Penrose/Resources/Resource.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+#include <Penrose/Resources/Updatable.hpp>
+#include <Penrose/Scene/SceneManager.hpp>
+
+#include "SceneGenerator.hpp"
+
+using namespace Penrose;
+
+// version of report layout, should be increased on incompatible changes
+inline constexpr std::uint32_t REPORT_VERSION = 2;
+
+struct BenchOptions {
+    SceneDefinition scene;
+    std::uint32_t warmupTicks = 120;
+    std::uint32_t ticks = 600;
+    bool nullRenderer = false;
+    std::string dataDirectory = "demos/SceneDemo/data";
+    std::string output = "penrose-bench.json";
+    std::optional<std::string> trace;
+};
+
+using FrameSummary = std::array<std::optional<FrameTimeStats>, FRAME_SOURCE_COUNT>;
+
+struct ScopeSummary {
+    std::uint64_t count;
+    double min;
+    double avg;
+    double p50;
+    double p95;
+    double p99;
+    double max;
+};
+
+// engine update on main thread drives scene with fixed step, so every run performs same work per tick; engine update,
+// systems and render list build are timed by scopes of engine itself, so driver does not add scopes of its own
+class BenchDriver final: public Resource<BenchDriver>,
+                         public Updatable {
+public:
+    explicit BenchDriver(const ResourceSet *resources)
+        : _entityManager(resources->get<EntityManager>()),
+          _engineEventQueue(resources->get<EngineEventQueue>()),
+          _profiler(resources->get<Profiler>()),
+          _frameStats(resources->get<FrameStats>()) {
+        //
+    }
+
+    ~BenchDriver() override = default;
+
+    void setScene(GeneratedScene &&scene, const std::uint32_t warmupTicks, const std::uint32_t ticks) {
+        this->_scene = std::forward<decltype(scene)>(scene);
+        this->_warmupTicks = warmupTicks;
+        this->_ticks = ticks;
+    }
+
+    void update(float) override {
+        if (this->_capture.has_value()) {
+            return;
+        }
+
+        // frame statistics are captured along with scopes, so both cover exactly measured ticks
+        if (this->_tick == this->_warmupTicks) {
+            this->_profiler->beginCapture(this->_ticks);
+            this->_frameStats->beginCapture();
+        } else if (this->_tick > this->_warmupTicks) {
+            this->_capture = this->_profiler->takeCapture();
+
+            if (this->_capture.has_value()) {
+                this->_frames = this->_frameStats->takeCapture();
+
+                this->_engineEventQueue->push<EngineDestroyRequestEvent>();
+
+                return;
+            }
+        }
+
+        moveEntities(this->_scene, this->_entityManager.get(), this->_tick);
+
+        this->_tick++;
+    }
+
+    [[nodiscard]] const std::optional<Profiler::Capture> &getCapture() const { return this->_capture; }
+
+    [[nodiscard]] const FrameSummary &getFrames() const { return this->_frames; }
+
+private:
+    ResourceProxy<EntityManager> _entityManager;
+    ResourceProxy<EngineEventQueue> _engineEventQueue;
+    ResourceProxy<Profiler> _profiler;
+    ResourceProxy<FrameStats> _frameStats;
+
+    GeneratedScene _scene;
+    std::uint32_t _warmupTicks = 0;
+    std::uint32_t _ticks = 0;
+    std::uint64_t _tick = 0;
+
+    std::optional<Profiler::Capture> _capture;
+    FrameSummary _frames;
+};
+
+template <typename T>
+[[nodiscard]] static T parseValue(const std::string_view arg, const std::string_view value) {
+    T result;
+    const auto [ptr, error] = std::from_chars(value.data(), value.data() + value.size(), result);
+
+    if (error != std::errc() || ptr != value.data() + value.size()) {
+        throw std::invalid_argument(fmt::format("Invalid value {} of {}", value, arg));
+    }
+
+    return result;
+}
+
+[[nodiscard]] static BenchOptions parseOptions(const int argc, const char **argv) {
+    auto options = BenchOptions();
+
+    for (int argIdx = 1; argIdx < argc; argIdx++) {
+        const auto arg = std::string_view(argv[argIdx]);
+
+        if (arg == "--null-renderer") {
+            options.nullRenderer = true;
+
+            continue;
+        }
+
+        if (argIdx + 1 >= argc) {
+            throw std::invalid_argument(fmt::format("Missing value of {}", arg));
+        }
+
+        const auto value = std::string_view(argv[++argIdx]);
+
+        if (arg == "--entities") {
+            options.scene.entityCount = parseValue<std::uint32_t>(arg, value);
+        } else if (arg == "--depth") {
+            options.scene.hierarchyDepth = parseValue<std::uint32_t>(arg, value);
+        } else if (arg == "--moving") {
+            options.scene.movingFraction = parseValue<float>(arg, value);
+        } else if (arg == "--seed") {
+            options.scene.seed = parseValue<std::uint32_t>(arg, value);
+        } else if (arg == "--warmup") {
+            options.warmupTicks = parseValue<std::uint32_t>(arg, value);
+        } else if (arg == "--ticks") {
+            options.ticks = parseValue<std::uint32_t>(arg, value);
+        } else if (arg == "--data") {
+            options.dataDirectory = value;
+        } else if (arg == "--output") {
+            options.output = value;
+        } else if (arg == "--trace") {
+            options.trace = value;
+        } else {
+            throw std::invalid_argument(fmt::format("Unknown argument {}", arg));
+        }
+    }
+
+    if (options.ticks == 0) {
+        throw std::invalid_argument("Count of ticks should be positive");
+    }
+
+    return options;
+}
+
+[[nodiscard]] static std::map<std::string, ScopeSummary> summarizeScopes(const Profiler::Capture &capture) {
+    auto durations = std::map<std::string, std::vector<double>>();
+
+    for (const auto &thread: capture.threads) {
+        for (const auto &record: thread.records) {
+            durations[capture.tags.at(record.tag)].push_back(
+                1000 * static_cast<double>(record.end - record.begin) / capture.ticksPerSecond
+            );
+        }
+    }
+
+    const auto percentile = [](const std::vector<double> &sorted, const double fraction) {
+        const auto idx = static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(sorted.size()))) - 1;
+
+        return sorted.at(std::min(idx, sorted.size() - 1));
+    };
+
+    auto summaries = std::map<std::string, ScopeSummary>();
+
+    for (auto &[tag, values]: durations) {
+        std::ranges::sort(values);
+
+        auto sum = 0.0;
+        for (const auto value: values) {
+            sum += value;
+        }
+
+        summaries.emplace(
+            tag, ScopeSummary {
+                     .count = values.size(),
+                     .min = values.front(),
+                     .avg = sum / static_cast<double>(values.size()),
+                     .p50 = percentile(values, 0.50),
+                     .p95 = percentile(values, 0.95),
+                     .p99 = percentile(values, 0.99),
+                     .max = values.back(),
+                 }
+        );
+    }
+
+    return summaries;
+}
+
+// report is written with sorted keys and one scope per line, so reports of different versions diff cleanly
+static void writeReport(
+    const BenchOptions &options, const std::size_t movingEntityCount, const Profiler::Capture &capture,
+    const FrameSummary &frames, std::ostream &stream
+) {
+    stream << "{\n";
+    stream << fmt::format(R"(  "version": {},)", REPORT_VERSION) << '\n';
+    stream << fmt::format(
+        R"(  "scene": {{"entities": {}, "depth": {}, "moving": {}, "movingEntities": {}, "seed": {}}},)",
+        options.scene.entityCount, options.scene.hierarchyDepth, options.scene.movingFraction,
+        movingEntityCount, options.scene.seed
+    ) << '\n';
+    stream << fmt::format(
+        R"(  "run": {{"warmupTicks": {}, "ticks": {}, "renderer": "{}"}},)", options.warmupTicks, options.ticks,
+        options.nullRenderer ? "null" : "default"
+    ) << '\n';
+
+    stream << R"(  "frames": {)" << '\n';
+
+    for (std::size_t sourceIdx = 0; sourceIdx < FRAME_SOURCE_COUNT; sourceIdx++) {
+        const auto source = static_cast<FrameSource>(sourceIdx);
+        const auto stats = frames.at(sourceIdx).value_or(FrameTimeStats {});
+        const auto name = source == FrameSource::Engine   ? "engine"
+                          : source == FrameSource::Render ? "render"
+                                                          : "systems";
+
+        stream << fmt::format(
+            R"(    "{}": {{"count": {}, "p50": {:.4f}, "p95": {:.4f}, "p99": {:.4f}, "max": {:.4f}}}{})", name,
+            stats.count, 1000 * stats.p50, 1000 * stats.p95, 1000 * stats.p99, 1000 * stats.max,
+            sourceIdx + 1 < FRAME_SOURCE_COUNT ? "," : ""
+        ) << '\n';
+    }
+
+    stream << "  },\n";
+
+    // scope tags are engine-defined identifiers, so they are not escaped
+    const auto scopes = summarizeScopes(capture);
+    std::size_t scopeIdx = 0;
+
+    stream << R"(  "scopes": {)" << '\n';
+
+    for (const auto &[tag, summary]: scopes) {
+        stream << fmt::format(
+            R"(    "{}": {{"count": {}, "min": {:.4f}, "avg": {:.4f}, "p50": {:.4f}, "p95": {:.4f}, "p99": {:.4f}, )"
+            R"("max": {:.4f}}}{})",
+            tag, summary.count, summary.min, summary.avg, summary.p50, summary.p95, summary.p99, summary.max,
+            ++scopeIdx < scopes.size() ? "," : ""
+        ) << '\n';
+    }
+
+    stream << "  }\n";
+    stream << "}\n";
+}
+
+int main(const int argc, const char **argv) {
+    BenchOptions options;
+
+    try {
+        options = parseOptions(argc, argv);
+    } catch (const std::invalid_argument &error) {
+        fmt::print(stderr, "{}\n", error.what());
+        fmt::print(
+            stderr, "Usage: {} [--entities N] [--depth N] [--moving FRACTION] [--seed N] [--warmup N] [--ticks N] "
+                    "[--null-renderer] [--data DIR] [--output FILE] [--trace FILE]\n",
+            argv[0]
+        );
+
+        return 1;
+    }
+
+    Engine engine(HeadlessInfo {});
+
+    auto driver = engine.resources().add<BenchDriver>().group(ResourceGroup::Custom).implements<Updatable>().done();
+
+    engine.resources().get<AssetManager>()->addDir(std::filesystem::path(options.dataDirectory));
+
+    // null renderer submits empty frames, so only engine overhead of frame submission is measured
+    if (options.nullRenderer) {
+        engine.resources().get<RenderManager>()->setExecutionInfo(RenderExecutionInfo {.renderers = {}});
+    }
+
+    auto scene = generateScene(
+        options.scene, engine.resources().get<EntityManager>().get(), engine.resources().get<SceneManager>().get()
+    );
+
+    const auto movingEntityCount = scene.movingEntities.size();
+
+    driver->setScene(std::move(scene), options.warmupTicks, options.ticks);
+
+    // report file is opened before run, so inaccessible path does not waste whole benchmark
+    auto output = std::ofstream(options.output);
+
+    if (!output.is_open()) {
+        fmt::print(stderr, "Failed to open report file {}\n", options.output);
+
+        return 1;
+    }
+
+    engine.run();
+
+    const auto &capture = driver->getCapture();
+
+    if (!capture.has_value()) {
+        fmt::print(stderr, "Engine was stopped before benchmark was finished\n");
+
+        return 1;
+    }
+
+    writeReport(options, movingEntityCount, *capture, driver->getFrames(), output);
+    output.flush();
+
+    if (!output) {
+        fmt::print(stderr, "Failed to write report file {}\n", options.output);
+
+        return 1;
+    }
+
+    if (options.trace.has_value()) {
+        writeChromeTrace(*capture, std::filesystem::path(*options.trace));
+    }
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include "SceneGenerator.hpp"
+
+#include <cmath>
+#include <random>
+
+#include <glm/trigonometric.hpp>
+
+#include <Penrose/Builtin/Penrose/ECS/MeshComponent.hpp>
+#include <Penrose/Builtin/Penrose/ECS/TransformComponent.hpp>
+#include <Penrose/Builtin/Penrose/ECS/ViewComponent.hpp>
+
+namespace Penrose {
+
+    inline constexpr float GRID_STEP = 4;
+    inline constexpr float FIXED_STEP = 1.0f / 60;
+    inline constexpr float ANGULAR_SPEED = glm::radians(90.0f);
+
+    // standard distributions are implementation-defined, so floats are built from upper 24 bits of generator output
+    [[nodiscard]] static float nextUnitFloat(std::mt19937 &random) {
+        return static_cast<float>(random() >> 8) * 0x1p-24f;
+    }
+
+    GeneratedScene generateScene(
+        const SceneDefinition &definition, EntityManager *entityManager, SceneManager *sceneManager
+    ) {
+        // generator is seeded explicitly, so results do not depend on platform or run
+        auto random = std::mt19937(definition.seed);
+
+        const auto root = sceneManager->addRoot("Default");
+        const auto gridSize = static_cast<std::uint32_t>(std::ceil(std::sqrt(definition.entityCount)));
+        const auto gridExtent = static_cast<float>(gridSize) * GRID_STEP;
+
+        auto scene = GeneratedScene {
+            .view = entityManager->createEntity(),
+            .entities = {},
+            .movingEntities = {},
+        };
+
+        {
+            auto transform = std::make_shared<TransformComponent>();
+            transform->pos = glm::vec3(-gridExtent / 2, gridExtent / 4, 0);
+            transform->rot = glm::vec3(0, 0, glm::radians(-30.0f));
+
+            entityManager->addComponent(scene.view, std::make_shared<ViewComponent>());
+            entityManager->addComponent(scene.view, std::move(transform));
+
+            sceneManager->insertEntityNode(root, scene.view);
+        }
+
+        // entities are chained into hierarchy of required depth, every level holds parents of next one
+        const auto depth = std::max(definition.hierarchyDepth, 1u);
+        auto parents = std::vector<SceneNodePtr>(depth, root);
+
+        for (std::uint32_t idx = 0; idx < definition.entityCount; idx++) {
+            const auto entity = entityManager->createEntity();
+            const auto level = idx % depth;
+
+            auto mesh = std::make_shared<MeshComponent>();
+            mesh->mesh = definition.mesh;
+            mesh->albedo = definition.albedo;
+
+            // order of evaluation of arguments is unspecified, so jitter is drawn in separate statements
+            const auto jitterX = nextUnitFloat(random) - 0.5f;
+            const auto jitterZ = nextUnitFloat(random) - 0.5f;
+
+            auto transform = std::make_shared<TransformComponent>();
+            transform->pos = glm::vec3(
+                (static_cast<float>(idx % gridSize) + jitterX) * GRID_STEP - gridExtent / 2, 0,
+                (static_cast<float>(idx / gridSize) + jitterZ) * GRID_STEP - gridExtent / 2
+            );
+
+            entityManager->addComponent(entity, std::move(mesh));
+            entityManager->addComponent(entity, std::move(transform));
+
+            const auto node = sceneManager->insertEntityNode(level == 0 ? root : parents.at(level - 1), entity);
+
+            parents.at(level) = node;
+
+            scene.entities.push_back(entity);
+
+            if (nextUnitFloat(random) < definition.movingFraction) {
+                scene.movingEntities.push_back(entity);
+            }
+        }
+
+        return scene;
+    }
+
+    void moveEntities(const GeneratedScene &scene, EntityManager *entityManager, const std::uint64_t tick) {
+        const auto time = static_cast<float>(tick) * FIXED_STEP;
+
+        for (const auto entity: scene.movingEntities) {
+            const auto transform = entityManager->getComponent<TransformComponent>(entity);
+
+            transform->pos.y = std::sin(time + static_cast<float>(entity));
+            transform->rot.y = ANGULAR_SPEED * time;
+        }
+    }
+}
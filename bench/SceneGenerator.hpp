@@ -0,0 +1,38 @@
+#ifndef PENROSE_BENCH_SCENE_GENERATOR_HPP
+#define PENROSE_BENCH_SCENE_GENERATOR_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <Penrose/ECS/Entity.hpp>
+#include <Penrose/ECS/EntityManager.hpp>
+#include <Penrose/Scene/SceneManager.hpp>
+
+namespace Penrose {
+
+    // scene is generated from seed only, so same definition always produces same scene
+    struct SceneDefinition {
+        std::uint32_t entityCount = 1024;
+        std::uint32_t hierarchyDepth = 1;
+        float movingFraction = 0.1f;
+        std::uint32_t seed = 42;
+        std::string mesh = "models/cube";
+        std::string albedo = "textures/texture-1024";
+    };
+
+    struct GeneratedScene {
+        Entity view;
+        std::vector<Entity> entities;
+        std::vector<Entity> movingEntities;
+    };
+
+    [[nodiscard]] GeneratedScene generateScene(
+        const SceneDefinition &definition, EntityManager *entityManager, SceneManager *sceneManager
+    );
+
+    // moves entities by fixed step, so entity state depends only on tick index
+    void moveEntities(const GeneratedScene &scene, EntityManager *entityManager, std::uint64_t tick);
+}
+
+#endif // PENROSE_BENCH_SCENE_GENERATOR_HPP
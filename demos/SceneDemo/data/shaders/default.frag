@@ -1,6 +1,14 @@
 #version 460
 
-layout (set = 0, binding = 0) uniform sampler2D albedoTextures[64];
+#extension GL_EXT_nonuniform_qualifier : require
+
+layout (set = 0, binding = 0) uniform texture2D textures[];
+layout (set = 0, binding = 1) uniform sampler samplers[];
+
+layout (push_constant) uniform PerRenderData {
+    layout (offset = 64) uint samplerId;
+    layout (offset = 68) uint placeholderId;
+} perRenderData;
 
 layout (location = 0) in vec3 inPos;
 layout (location = 1) in vec3 inNormal;
@@ -11,5 +19,9 @@ flat layout (location = 4) in uint inTextureId;
 layout (location = 0) out vec4 outAlbedo;
 
 void main() {
-    outAlbedo = vec4(inColor, 1) * texture(albedoTextures[inTextureId], inUV);
+    // images which are not loaded yet are referenced by 0xFFFFFFFF
+    const uint textureId = inTextureId != 0xFFFFFFFFu ? inTextureId : perRenderData.placeholderId;
+    const sampler2D albedo = sampler2D(textures[nonuniformEXT(textureId)], samplers[perRenderData.samplerId]);
+
+    outAlbedo = vec4(inColor, 1) * texture(albedo, inUV);
 }
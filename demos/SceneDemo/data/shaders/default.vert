@@ -29,4 +29,5 @@ void main() {
     outNormal = (instanceModelRot * vec4(vertexNormal, 1)).xyz;
     outColor = instanceColor * vertexColor;
     outUV = vertexUV;
+    outTextureId = instanceTextureId;
 }
@@ -12,7 +12,8 @@ namespace Penrose {
         Shader = 0x01,
         Mesh = 0x02,
         Image = 0x03,
-        UILayout = 0x04
+        UILayout = 0x04,
+        UIBinaryLayout = 0x05
     };
 }
 
@@ -0,0 +1,45 @@
+#ifndef PENROSE_BUILTIN_HEADLESS_HPP
+#define PENROSE_BUILTIN_HEADLESS_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+
+#include <Penrose/Api.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+#include <Penrose/Types/Size.hpp>
+
+namespace Penrose {
+
+    /**
+     * \brief Headless surface definition
+     */
+    struct PENROSE_API HeadlessInfo {
+
+        /**
+         * \brief Size of offscreen images
+         */
+        Size size = {1280, 720};
+
+        /**
+         * \brief Count of offscreen images
+         */
+        std::uint32_t imageCount = 3;
+
+        /**
+         * \brief Directory for PNG files of captured frames, frames are not written if not set
+         */
+        std::optional<std::filesystem::path> captureDirectory = std::nullopt;
+    };
+
+    /**
+     * \brief Configure headless windowing resources in provided resource set
+     * \details Headless surface is rendered offscreen, so no display is required.
+     * \param resources Target resource set
+     * \param info Headless surface definition
+     * \return Target resource set
+     */
+    ResourceSet &addHeadless(ResourceSet &resources, const HeadlessInfo &info);
+}
+
+#endif // PENROSE_BUILTIN_HEADLESS_HPP
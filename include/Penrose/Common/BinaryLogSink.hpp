@@ -0,0 +1,135 @@
+#ifndef PENROSE_COMMON_BINARY_LOG_SINK_HPP
+#define PENROSE_COMMON_BINARY_LOG_SINK_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Penrose/Api.hpp>
+#include <Penrose/Common/LogSink.hpp>
+#include <Penrose/Resources/Resource.hpp>
+
+namespace Penrose {
+
+    /**
+     * \brief Binary log sink definition
+     */
+    struct PENROSE_API BinaryLogSinkInfo {
+
+        /**
+         * \brief Write log files, sink is registered in log by engine, but drops messages until enabled
+         */
+        bool enabled = false;
+
+        /**
+         * \brief Directory, which contains log files
+         */
+        std::filesystem::path directory = "logs";
+
+        /**
+         * \brief Prefix of log file names, files are named as {prefix}-{index}.plog
+         */
+        std::string prefix = "penrose";
+
+        /**
+         * \brief Size of file in bytes, after which new file is started
+         */
+        std::uint64_t maxFileSize = 16 * 1024 * 1024;
+
+        /**
+         * \brief Count of kept files, oldest files are removed
+         */
+        std::uint32_t maxFileCount = 8;
+    };
+
+    /**
+     * \brief Message, which is read from binary log
+     */
+    struct PENROSE_API BinaryLogEntry {
+
+        /**
+         * \brief Level of message
+         */
+        LogLevel level;
+
+        /**
+         * \brief Time, at which message was written
+         */
+        std::chrono::system_clock::time_point time;
+
+        /**
+         * \brief Hash of identifier of writing thread
+         */
+        std::uint64_t thread;
+
+        /**
+         * \brief Tag of message
+         */
+        std::string_view tag;
+
+        /**
+         * \brief Text of message
+         */
+        std::string_view msg;
+    };
+
+    /**
+     * \brief Log sink, which writes messages as length-prefixed binary records into size-rotated files
+     * \details Every file starts with header and defines tags before their first use, so every file could be decoded
+     * on its own. Records are buffered and written on LogSink::flush.
+     */
+    class PENROSE_API BinaryLogSink final: public Resource<BinaryLogSink>,
+                                           public LogSink {
+    public:
+        ~BinaryLogSink() override;
+
+        /**
+         * \brief Set definition of sink
+         * \details Definition is applied to next file, so it should be set before engine is run.
+         * \param info Binary log sink definition
+         */
+        void setInfo(BinaryLogSinkInfo &&info);
+
+        //! \copydoc LogSink::write
+        void write(const LogRecord &record) override;
+
+        //! \copydoc LogSink::flush
+        void flush() override;
+
+    private:
+        std::mutex _mutex;
+        BinaryLogSinkInfo _info;
+
+        std::ofstream _file;
+        std::uint64_t _fileIdx = 0;
+        std::uint64_t _fileSize = 0;
+
+        // failed file is not opened again until sink definition is changed
+        bool _fileFailed = false;
+
+        std::vector<std::byte> _buffer;
+        std::map<std::string, std::uint16_t, std::less<>> _tagIds;
+
+        void openFile();
+        void writeBuffer();
+        [[nodiscard]] std::uint16_t useTag(std::string_view tag);
+    };
+
+    /**
+     * \brief Read messages of binary log file
+     * \param stream Input stream of binary log file
+     * \param handler Handler of every message, message data is valid only during call
+     * \throws EngineError if stream does not contain valid binary log
+     */
+    PENROSE_API void readBinaryLog(std::istream &stream, const std::function<void(const BinaryLogEntry &)> &handler);
+}
+
+#endif // PENROSE_COMMON_BINARY_LOG_SINK_HPP
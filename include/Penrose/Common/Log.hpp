@@ -1,22 +1,54 @@
 #ifndef PENROSE_COMMON_LOG_HPP
 #define PENROSE_COMMON_LOG_HPP
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string_view>
 #include <typeindex>
 
 #include <fmt/core.h>
 
+#include <Penrose/Api.hpp>
 #include <Penrose/Common/LogLevel.hpp>
 #include <Penrose/Common/LogSink.hpp>
 
 namespace Penrose {
 
+    /**
+     * \brief Counters of log system
+     */
+    struct PENROSE_API LogStats {
+
+        /**
+         * \brief Count of messages, which were passed to sinks
+         */
+        std::uint64_t written = 0;
+
+        /**
+         * \brief Count of messages, which were dropped because log queue was full
+         */
+        std::uint64_t dropped = 0;
+
+        /**
+         * \brief Count of messages, which were truncated to Log::MAX_MESSAGE_SIZE
+         */
+        std::uint64_t truncated = 0;
+    };
+
     /**
      * \brief Log system interface
-     * \details This interface provides methods of log system.
+     * \details This interface provides methods of log system. Messages are formatted on calling thread without
+     * allocations and are passed to sinks asynchronously.
      */
     class PENROSE_API Log {
     public:
+        /**
+         * \brief Maximal size of log message, longer messages are truncated
+         */
+        static constexpr std::size_t MAX_MESSAGE_SIZE = 512;
+
         virtual ~Log() = default;
 
         /**
@@ -32,8 +64,10 @@ namespace Penrose {
          * \param tag Message tag (i.e. class name)
          * \param msg Log message
          */
-        constexpr void writeDebug(const std::string_view tag, const std::string_view msg) {
-            this->write(LogLevel::Debug, tag, msg);
+        void writeDebug(const std::string_view tag, const std::string_view msg) {
+            if constexpr (LogLevel::Debug >= MIN_LOG_LEVEL) {
+                this->write(LogLevel::Debug, tag, msg);
+            }
         }
 
         /**
@@ -44,8 +78,8 @@ namespace Penrose {
          * \param args Format string arguments
          */
         template <typename... Args>
-        constexpr void writeDebug(const std::string_view tag, fmt::format_string<Args...> fmt, Args &&...args) {
-            this->write(LogLevel::Debug, tag, fmt::format(std::move(fmt), std::forward<Args>(args)...));
+        void writeDebug(const std::string_view tag, fmt::format_string<Args...> fmt, Args &&...args) {
+            this->writeFormatted<LogLevel::Debug>(tag, std::move(fmt), std::forward<Args>(args)...);
         }
 
         /**
@@ -53,8 +87,10 @@ namespace Penrose {
          * \param tag Message tag (i.e. class name)
          * \param msg Log message
          */
-        constexpr void writeInfo(const std::string_view tag, const std::string_view msg) {
-            this->write(LogLevel::Info, tag, msg);
+        void writeInfo(const std::string_view tag, const std::string_view msg) {
+            if constexpr (LogLevel::Info >= MIN_LOG_LEVEL) {
+                this->write(LogLevel::Info, tag, msg);
+            }
         }
 
         /**
@@ -65,8 +101,8 @@ namespace Penrose {
          * \param args Format string arguments
          */
         template <typename... Args>
-        constexpr void writeInfo(const std::string_view tag, fmt::format_string<Args...> fmt, Args &&...args) {
-            this->write(LogLevel::Info, tag, fmt::format(std::move(fmt), std::forward<Args>(args)...));
+        void writeInfo(const std::string_view tag, fmt::format_string<Args...> fmt, Args &&...args) {
+            this->writeFormatted<LogLevel::Info>(tag, std::move(fmt), std::forward<Args>(args)...);
         }
 
         /**
@@ -74,8 +110,10 @@ namespace Penrose {
          * \param tag Message tag (i.e. class name)
          * \param msg Log message
          */
-        constexpr void writeWarning(const std::string_view tag, const std::string_view msg) {
-            this->write(LogLevel::Warning, tag, msg);
+        void writeWarning(const std::string_view tag, const std::string_view msg) {
+            if constexpr (LogLevel::Warning >= MIN_LOG_LEVEL) {
+                this->write(LogLevel::Warning, tag, msg);
+            }
         }
 
         /**
@@ -86,8 +124,8 @@ namespace Penrose {
          * \param args Format string arguments
          */
         template <typename... Args>
-        constexpr void writeWarning(const std::string_view tag, fmt::format_string<Args...> fmt, Args &&...args) {
-            this->write(LogLevel::Warning, tag, fmt::format(std::move(fmt), std::forward<Args>(args)...));
+        void writeWarning(const std::string_view tag, fmt::format_string<Args...> fmt, Args &&...args) {
+            this->writeFormatted<LogLevel::Warning>(tag, std::move(fmt), std::forward<Args>(args)...);
         }
 
         /**
@@ -95,8 +133,10 @@ namespace Penrose {
          * \param tag Message tag (i.e. class name)
          * \param msg Log message
          */
-        constexpr void writeError(const std::string_view tag, const std::string_view msg) {
-            this->write(LogLevel::Error, tag, msg);
+        void writeError(const std::string_view tag, const std::string_view msg) {
+            if constexpr (LogLevel::Error >= MIN_LOG_LEVEL) {
+                this->write(LogLevel::Error, tag, msg);
+            }
         }
 
         /**
@@ -107,10 +147,21 @@ namespace Penrose {
          * \param args Format string arguments
          */
         template <typename... Args>
-        constexpr void writeError(const std::string_view tag, fmt::format_string<Args...> fmt, Args &&...args) {
-            this->write(LogLevel::Error, tag, fmt::format(std::move(fmt), std::forward<Args>(args)...));
+        void writeError(const std::string_view tag, fmt::format_string<Args...> fmt, Args &&...args) {
+            this->writeFormatted<LogLevel::Error>(tag, std::move(fmt), std::forward<Args>(args)...);
         }
 
+        /**
+         * \brief Wait until every previously written message is passed to sinks and sinks are flushed
+         */
+        virtual void flush() = 0;
+
+        /**
+         * \brief Get counters of log system
+         * \return Log counters
+         */
+        [[nodiscard]] virtual LogStats getStats() const = 0;
+
         /**
          * \brief Add log sink
          * \param type Type of log sink
@@ -126,6 +177,21 @@ namespace Penrose {
         void addSink() {
             this->addSink(typeid(T));
         }
+
+    private:
+        template <LogLevel Level, typename... Args>
+        void writeFormatted(const std::string_view tag, fmt::format_string<Args...> fmt, Args &&...args) {
+            if constexpr (Level >= MIN_LOG_LEVEL) {
+                // message is formatted on stack, one extra character lets log system detect truncation
+                std::array<char, MAX_MESSAGE_SIZE + 1> buffer;
+
+                const auto result = fmt::format_to_n(
+                    buffer.data(), buffer.size(), std::move(fmt), std::forward<Args>(args)...
+                );
+
+                this->write(Level, tag, std::string_view(buffer.data(), std::min(result.size, buffer.size())));
+            }
+        }
     };
 }
 
@@ -1,6 +1,14 @@
 #ifndef PENROSE_COMMON_LOG_LEVEL_HPP
 #define PENROSE_COMMON_LOG_LEVEL_HPP
 
+/**
+ * \brief Minimal log level, which is compiled in: 0 - Debug, 1 - Info, 2 - Warning, 3 - Error
+ * \details Messages of lower levels are discarded at compile time, so their arguments are not even formatted.
+ */
+#ifndef PENROSE_MIN_LOG_LEVEL
+#define PENROSE_MIN_LOG_LEVEL 0
+#endif
+
 namespace Penrose {
 
     /**
@@ -12,6 +20,11 @@ namespace Penrose {
         Warning,
         Error
     };
+
+    /**
+     * \brief Minimal log level, which is compiled in
+     */
+    inline constexpr LogLevel MIN_LOG_LEVEL = static_cast<LogLevel>(PENROSE_MIN_LOG_LEVEL);
 }
 
 #endif // PENROSE_COMMON_LOG_LEVEL_HPP
@@ -1,14 +1,50 @@
 #ifndef PENROSE_COMMON_LOG_SINK_HPP
 #define PENROSE_COMMON_LOG_SINK_HPP
 
+#include <chrono>
 #include <string_view>
+#include <thread>
 
+#include <Penrose/Api.hpp>
 #include <Penrose/Common/LogLevel.hpp>
 
 namespace Penrose {
 
+    /**
+     * \brief Log message, which is passed to sinks
+     */
+    struct PENROSE_API LogRecord {
+
+        /**
+         * \brief Message level
+         */
+        LogLevel level;
+
+        /**
+         * \brief Time of message creation
+         */
+        std::chrono::system_clock::time_point time;
+
+        /**
+         * \brief Thread, which created message
+         */
+        std::thread::id thread;
+
+        /**
+         * \brief Message tag (i.e. class name)
+         */
+        std::string_view tag;
+
+        /**
+         * \brief Log message
+         */
+        std::string_view msg;
+    };
+
     /**
      * \brief Log system sink
+     * \details Sinks are invoked from single log writer thread. Messages are written in batches, every batch is
+     * followed by LogSink::flush.
      */
     class PENROSE_API LogSink {
     public:
@@ -16,11 +52,17 @@ namespace Penrose {
 
         /**
          * \brief Write message into sink
-         * \param level Message level
-         * \param tag Message tag (i.e. class name)
-         * \param msg Log message
+         * \details Message data is valid only during call.
+         * \param record Log message
+         */
+        virtual void write(const LogRecord &record) = 0;
+
+        /**
+         * \brief Flush written messages
          */
-        virtual void write(LogLevel level, std::string_view tag, std::string_view msg) = 0;
+        virtual void flush() {
+            // nothing to do
+        }
     };
 }
 
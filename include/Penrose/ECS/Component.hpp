@@ -31,6 +31,7 @@ namespace Penrose {
      */
     template <typename Self>
     struct PENROSE_API Component: ComponentPtr {
+        Component() = default;
         Component(const Component &) = default;
         Component(Component &&) = default;
         Component &operator=(const Component &) = default;
@@ -11,6 +11,7 @@
 #include <Penrose/ECS/EntityArchetype.hpp>
 #include <Penrose/ECS/EntityIterator.hpp>
 #include <Penrose/ECS/EntityQuery.hpp>
+#include <Penrose/Performance/MemoryTracker.hpp>
 
 namespace Penrose {
 
@@ -57,6 +58,8 @@ namespace Penrose {
         template <typename T>
         requires std::is_base_of_v<Component<T>, T> && std::is_default_constructible_v<T>
         void addComponent(const Entity entity) {
+            const auto memoryScope = MemoryTagScope(MemoryTag::ECS);
+
             this->addComponent(entity, std::make_shared<T>());
         }
 
@@ -69,6 +72,8 @@ namespace Penrose {
         template <typename T>
         requires std::is_base_of_v<Component<T>, T> && std::is_move_constructible_v<T>
         void addComponent(const Entity entity, T &&component) {
+            const auto memoryScope = MemoryTagScope(MemoryTag::ECS);
+
             this->addComponent(entity, std::make_shared<T>(std::forward<decltype(component)>(component)));
         }
 
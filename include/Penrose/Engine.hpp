@@ -2,6 +2,7 @@
 #define PENROSE_ENGINE_HPP
 
 #include <Penrose/Api.hpp>
+#include <Penrose/Builtin/Headless.hpp>
 #include <Penrose/Resources/ResourceSet.hpp>
 
 namespace Penrose {
@@ -10,8 +11,11 @@ namespace Penrose {
     private:
         ResourceSet _resources;
 
+        void addEngineResources();
+
     public:
         Engine();
+        explicit Engine(const HeadlessInfo &headless);
 
         void run();
 
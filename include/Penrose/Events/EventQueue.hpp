@@ -3,19 +3,39 @@
 
 #include <array>
 #include <atomic>
+#include <cstddef>
 #include <functional>
 #include <list>
+#include <mutex>
 #include <type_traits>
 #include <variant>
 #include <vector>
 
+#include <Penrose/Api.hpp>
 #include <Penrose/Resources/Initializable.hpp>
 #include <Penrose/Resources/Resource.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
 #include <Penrose/Resources/Updatable.hpp>
 #include <Penrose/Utils/TemplateUtils.hpp>
 
 namespace Penrose {
 
+    class MetricCounter;
+
+    /**
+     * \brief Get or create counter of events dispatched by event queues
+     * \param resources Resource set
+     * \return Instance of counter
+     */
+    [[nodiscard]] PENROSE_API MetricCounter *getDispatchedEventsCounter(const ResourceSet *resources);
+
+    /**
+     * \brief Add count of dispatched events into counter
+     * \param counter Instance of counter
+     * \param count Count of dispatched events
+     */
+    PENROSE_API void addDispatchedEvents(MetricCounter *counter, std::size_t count);
+
     /**
      * \brief Event queue
      * \details Event queue allows to push event and dispatch them to corresponding handlers. All added handlers are
@@ -27,6 +47,17 @@ namespace Penrose {
                                         public Initializable,
                                         public Updatable {
     public:
+        EventQueue() = default;
+
+        /**
+         * \brief Create event queue, which reports count of dispatched events into metrics registry
+         * \param resources Resource set
+         */
+        explicit EventQueue(const ResourceSet *resources)
+            : _dispatchedMetric(getDispatchedEventsCounter(resources)) {
+            //
+        }
+
         ~EventQueue() override = default;
 
         //! \copydoc Initializable::init
@@ -47,6 +78,10 @@ namespace Penrose {
         void update(float) override {
             this->swap();
 
+            if (this->_dispatchedMetric != nullptr) {
+                addDispatchedEvents(this->_dispatchedMetric, this->back().size());
+            }
+
             for (const auto &event: this->back()) {
                 for (const auto &handler: this->_handlers) {
                     handler(&event);
@@ -85,6 +120,9 @@ namespace Penrose {
         template <typename E>
         requires Any<std::is_same_v<E, Events>...>
         void addHandler(std::function<void(const E *)> &&handler) {
+            // handlers are added by resources initialized in parallel, events are dispatched only after that
+            auto lock = std::lock_guard(this->_handlersMutex);
+
             this->_handlers.emplace_back([handler](const EventVariant *event) {
                 const auto targetEvent = std::get_if<E>(event);
 
@@ -103,6 +141,9 @@ namespace Penrose {
         using Queue = std::vector<EventVariant>;
         using Handler = std::function<void(const EventVariant *)>;
 
+        MetricCounter *_dispatchedMetric = nullptr;
+
+        std::mutex _handlersMutex;
         std::list<Handler> _handlers;
         std::array<Queue, QUEUE_COUNT> _eventQueues;
         std::atomic_size_t _currentEventQueueIdx = 0;
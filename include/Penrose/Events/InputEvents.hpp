@@ -1,6 +1,8 @@
 #ifndef PENROSE_EVENTS_INPUT_EVENTS_HPP
 #define PENROSE_EVENTS_INPUT_EVENTS_HPP
 
+#include <cstdint>
+
 #include <Penrose/Events/EventQueue.hpp>
 #include <Penrose/Input/Input.hpp>
 
@@ -21,11 +23,17 @@ namespace Penrose {
          * \brief New input state
          */
         InputState state;
+
+        /**
+         * \brief Time of capture
+         */
+        InputTimestamp timestamp;
     };
 
     /**
      * \brief Mouse movement event
-     * \details Fired on any mouse movement.
+     * \details Consecutive movements are coalesced into single event of InputEventQueue, so event holds last
+     * position and movement accumulated since previous event. Every sample is fired into RawInputEventQueue.
      */
     struct PENROSE_API MouseMovementEvent {
 
@@ -38,11 +46,22 @@ namespace Penrose {
          * \brief Mouse movement
          */
         InputMouseMovement movement;
+
+        /**
+         * \brief Time of capture of last sample
+         */
+        InputTimestamp timestamp;
+
+        /**
+         * \brief Count of samples coalesced into event
+         */
+        std::uint32_t samples;
     };
 
     /**
      * \brief Mouse wheel scroll event
-     * \details Fired on any mouse wheel scroll
+     * \details Consecutive scrolls are coalesced into single event of InputEventQueue, so event holds scroll
+     * accumulated since previous event. Every sample is fired into RawInputEventQueue.
      */
     struct PENROSE_API MouseScrollEvent {
 
@@ -50,12 +69,29 @@ namespace Penrose {
          * \brief Mouse wheel scroll
          */
         InputMouseScroll scroll;
+
+        /**
+         * \brief Time of capture of last sample
+         */
+        InputTimestamp timestamp;
+
+        /**
+         * \brief Count of samples coalesced into event
+         */
+        std::uint32_t samples;
     };
 
     /**
      * \brief Input event queue
      */
     using InputEventQueue = EventQueue<KeyStateUpdatedEvent, MouseMovementEvent, MouseScrollEvent>;
+
+    /**
+     * \brief Raw input event queue
+     * \details Queue is opt-in: when it is added into resource set before engine is run, every mouse sample is fired
+     * into it without coalescing.
+     */
+    using RawInputEventQueue = EventQueue<MouseMovementEvent, MouseScrollEvent>;
 }
 
 #endif // PENROSE_EVENTS_INPUT_EVENTS_HPP
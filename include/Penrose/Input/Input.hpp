@@ -1,10 +1,24 @@
 #ifndef PENROSE_INPUT_INPUT_HPP
 #define PENROSE_INPUT_INPUT_HPP
 
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string_view>
 #include <tuple>
 
 namespace Penrose {
 
+    /**
+     * \brief Clock of input timestamps
+     */
+    using InputClock = std::chrono::steady_clock;
+
+    /**
+     * \brief Time point, when input was captured from backend
+     */
+    using InputTimestamp = InputClock::time_point;
+
     /**
      * \brief Relative mouse position
      * \details Both axis are limited within [-1.0, 1.0]. Position is calculated from top left corner of surface.
@@ -90,6 +104,12 @@ namespace Penrose {
         // clang-format on
     };
 
+    /**
+     * \brief Count of input keys
+     * \details Last key of InputKey should be used here, so keys could be used as indices of fixed-size arrays.
+     */
+    inline constexpr std::size_t INPUT_KEY_COUNT = static_cast<std::size_t>(InputKey::MB7) + 1;
+
     /**
      * \brief Checks key is keyboard key
      * \param key Key
@@ -103,6 +123,14 @@ namespace Penrose {
      * \return True if key is mouse key
      */
     [[nodiscard]] bool isMouseKey(InputKey key);
+
+    /**
+     * \brief Find key by its name
+     * \details Name of key is name of InputKey value, numbers are named without leading underscore.
+     * \param name Name of key
+     * \return Key or nothing, if name is unknown
+     */
+    [[nodiscard]] std::optional<InputKey> tryParseInputKey(std::string_view name);
 }
 
 #endif // PENROSE_INPUT_INPUT_HPP
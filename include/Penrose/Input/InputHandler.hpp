@@ -2,35 +2,61 @@
 #define PENROSE_INPUT_INPUT_HANDLER_HPP
 
 #include <cstdint>
-#include <map>
+#include <memory>
+#include <optional>
 
 #include <Penrose/Api.hpp>
 #include <Penrose/Events/InputEvents.hpp>
 #include <Penrose/Input/Input.hpp>
 #include <Penrose/Input/InputHook.hpp>
+#include <Penrose/Input/InputSnapshot.hpp>
+#include <Penrose/Performance/MetricsRegistry.hpp>
 #include <Penrose/Resources/ResourceSet.hpp>
 
 namespace Penrose {
 
+    template <typename T>
+    class SeqDoubleBuffer;
+
     class PENROSE_API InputHandler: public Resource<InputHandler> {
     public:
         explicit InputHandler(const ResourceSet *resources);
-        ~InputHandler() override = default;
+        ~InputHandler() override;
+
+        // input is pushed on main thread only, timestamp is time of capture by backend
+        void pushKeyStateUpdate(InputKey key, InputState state, InputTimestamp timestamp);
+        void pushMouseMove(float x, float y, InputTimestamp timestamp);
+        void pushScroll(float dx, float dy, InputTimestamp timestamp);
+
+        // push coalesced mouse events into event queue, backend calls it after input is polled
+        void flushEvents();
+
+        // publish input of completed frame and start accumulating next one, called on main thread
+        void endFrame();
 
-        void pushKeyStateUpdate(InputKey key, InputState state);
-        void pushMouseMove(float x, float y);
-        void pushScroll(float dx, float dy);
+        // snapshot of last completed frame, lock-free and safe to call from any thread
+        [[nodiscard]] InputSnapshot getSnapshot() const;
 
         [[nodiscard]] InputState getCurrentStateOf(InputKey key) const;
 
-        [[nodiscard]] std::tuple<float, float> getCurrentMousePosition() const { return this->_mousePos; }
+        [[nodiscard]] InputMousePosition getCurrentMousePosition() const;
 
     private:
         ResourceProxy<InputEventQueue> _eventQueue;
+        ResourceProxy<RawInputEventQueue> _rawEventQueue;
         ResourceProxy<InputHook> _inputHooks;
 
-        std::map<InputKey, InputState> _states;
-        InputMousePosition _mousePos;
+        MetricGauge *_frameSamplesMetric;
+        MetricGauge *_frameEventsMetric;
+
+        std::optional<MouseMovementEvent> _pendingMovement;
+        std::optional<MouseScrollEvent> _pendingScroll;
+        std::uint64_t _frameSamples = 0;
+        std::uint64_t _frameEvents = 0;
+
+        InputSnapshot _pending;
+
+        std::unique_ptr<SeqDoubleBuffer<InputSnapshot>> _snapshots;
     };
 }
 
@@ -0,0 +1,176 @@
+#ifndef PENROSE_INPUT_INPUT_MAPPER_HPP
+#define PENROSE_INPUT_INPUT_MAPPER_HPP
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <istream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Penrose/Api.hpp>
+#include <Penrose/Input/Input.hpp>
+#include <Penrose/Input/InputHandler.hpp>
+#include <Penrose/Input/InputSnapshot.hpp>
+#include <Penrose/Resources/Resource.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+
+namespace Penrose {
+
+    template <typename T>
+    class SeqDoubleBuffer;
+
+    /**
+     * \brief Identifier of input action, index of action in input map
+     */
+    using InputActionId = std::uint32_t;
+
+    /**
+     * \brief Identifier of missing input action
+     */
+    inline constexpr InputActionId NO_INPUT_ACTION = std::numeric_limits<InputActionId>::max();
+
+    /**
+     * \brief Maximum count of actions and axes in input map
+     */
+    inline constexpr std::size_t MAX_INPUT_ACTION_COUNT = 256;
+
+    /**
+     * \brief State of input action at the end of frame
+     */
+    struct PENROSE_API InputActionState {
+
+        /**
+         * \brief Value of action: 1 or 0 for button actions, sum of scales of held keys within [-1.0, 1.0] for axes
+         */
+        float value = 0.0f;
+
+        /**
+         * \brief Action is active: any bound key is held down and value is not zero
+         */
+        bool down = false;
+
+        /**
+         * \brief Action became active during frame
+         */
+        bool pressed = false;
+
+        /**
+         * \brief Action became inactive during frame
+         */
+        bool released = false;
+    };
+
+    /**
+     * \brief Mapping of input keys into actions and axes
+     * \details Input map is loaded from JSON file:
+     * \code{.json}
+     * {
+     *   "actions": {"jump": ["Space", "MB1"]},
+     *   "axes": {"moveX": {"D": 1.0, "A": -1.0}}
+     * }
+     * \endcode
+     * Bindings are compiled into flat tables indexed by InputKey. Actions are evaluated once per frame from
+     * InputSnapshot, so systems read state of action by its identifier instead of filtering input events.
+     */
+    class PENROSE_API InputMapper final: public Resource<InputMapper> {
+    public:
+        explicit InputMapper(const ResourceSet *resources);
+        ~InputMapper() override;
+
+        /**
+         * \brief Load input map from file, replacing current one
+         * \details Input map is applied as a whole by next InputMapper::endFrame, so identifiers of its actions are
+         * resolved after that frame. Input map could be reloaded between frames from any thread.
+         * \param path Path to input map file
+         */
+        void loadFile(const std::filesystem::path &path);
+
+        /**
+         * \brief Load input map from stream, replacing current one
+         * \details Input map is applied as a whole by next InputMapper::endFrame, so identifiers of its actions are
+         * resolved after that frame. Input map could be reloaded between frames from any thread.
+         * \param stream Stream of input map
+         */
+        void load(std::istream &stream);
+
+        /**
+         * \brief Evaluate actions from last published input snapshot
+         * \details Should be called once per frame on main thread after InputHandler::endFrame. Loaded input map is
+         * applied before actions are evaluated.
+         */
+        void endFrame();
+
+        /**
+         * \brief Find identifier of action in applied input map
+         * \param name Name of action or axis
+         * \return Identifier of action or NO_INPUT_ACTION
+         */
+        [[nodiscard]] InputActionId tryGetActionId(std::string_view name) const;
+
+        /**
+         * \brief Get identifier of action in applied input map
+         * \param name Name of action or axis
+         * \return Identifier of action
+         */
+        [[nodiscard]] InputActionId getActionId(std::string_view name) const;
+
+        /**
+         * \brief Get state of action at the end of last evaluated frame
+         * \details Lock-free and safe to call from any thread. Unknown actions are reported as inactive.
+         * \param action Identifier of action
+         * \return State of action
+         */
+        [[nodiscard]] InputActionState getState(InputActionId action) const;
+
+        /**
+         * \brief Get count of actions
+         * \return Count of actions and axes in applied input map
+         */
+        [[nodiscard]] std::uint32_t getActionCount() const;
+
+    private:
+        struct KeyBinding {
+            InputActionId action;
+            float scale;
+        };
+
+        struct InputMap {
+            std::map<std::string, InputActionId, std::less<>> actionIds;
+            std::vector<std::string> actionNames;
+
+            // bindings of key are in range [keyOffsets[key], keyOffsets[key + 1]) of bindings
+            std::array<std::uint32_t, INPUT_KEY_COUNT + 1> keyOffsets = {};
+            std::vector<KeyBinding> bindings;
+            std::vector<InputKey> boundKeys;
+        };
+
+        // states are kept in fixed array, so buffers are never reallocated while readers could copy from them
+        struct ActionStates {
+            std::uint32_t count = 0;
+            std::array<InputActionState, MAX_INPUT_ACTION_COUNT> states = {};
+        };
+
+        ResourceProxy<InputHandler> _inputHandler;
+
+        // applied input map is replaced by staged one in endFrame on main thread, lookups of other threads are guarded
+        mutable std::mutex _mapMutex;
+        InputMap _map;
+        std::optional<InputMap> _pendingMap;
+
+        // per-action scratch of evaluation, kept to avoid allocations per frame
+        std::array<float, MAX_INPUT_ACTION_COUNT> _values = {};
+        std::array<std::uint8_t, MAX_INPUT_ACTION_COUNT> _downKeys = {};
+        std::array<std::uint8_t, MAX_INPUT_ACTION_COUNT> _pressedKeys = {};
+
+        std::unique_ptr<SeqDoubleBuffer<ActionStates>> _states;
+    };
+}
+
+#endif // PENROSE_INPUT_INPUT_MAPPER_HPP
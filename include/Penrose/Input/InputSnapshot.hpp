@@ -0,0 +1,85 @@
+#ifndef PENROSE_INPUT_INPUT_SNAPSHOT_HPP
+#define PENROSE_INPUT_INPUT_SNAPSHOT_HPP
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+#include <Penrose/Api.hpp>
+#include <Penrose/Input/Input.hpp>
+
+namespace Penrose {
+
+    /**
+     * \brief Set of input keys, indexed by value of InputKey
+     */
+    using InputKeySet = std::bitset<INPUT_KEY_COUNT>;
+
+    /**
+     * \brief State of input at the end of frame
+     */
+    struct PENROSE_API InputSnapshot {
+
+        /**
+         * \brief Index of frame, which is captured into snapshot
+         */
+        std::uint64_t frame = 0;
+
+        /**
+         * \brief Keys, which are held down at the end of frame
+         */
+        InputKeySet down;
+
+        /**
+         * \brief Keys, which were pressed during frame
+         */
+        InputKeySet pressed;
+
+        /**
+         * \brief Keys, which were released during frame
+         */
+        InputKeySet released;
+
+        /**
+         * \brief Mouse position at the end of frame
+         */
+        InputMousePosition mousePosition = {0.0f, 0.0f};
+
+        /**
+         * \brief Mouse movement accumulated during frame
+         */
+        InputMouseMovement mouseMovement = {0.0f, 0.0f};
+
+        /**
+         * \brief Mouse wheel scroll accumulated during frame
+         */
+        InputMouseScroll mouseScroll = {0.0f, 0.0f};
+
+        /**
+         * \brief Check key is held down
+         * \param key Input key
+         * \return True if key is held down at the end of frame
+         */
+        [[nodiscard]] bool isDown(const InputKey key) const { return this->down.test(static_cast<std::size_t>(key)); }
+
+        /**
+         * \brief Check key was pressed during frame
+         * \param key Input key
+         * \return True if key was pressed during frame, even if it was released afterwards
+         */
+        [[nodiscard]] bool wasPressed(const InputKey key) const {
+            return this->pressed.test(static_cast<std::size_t>(key));
+        }
+
+        /**
+         * \brief Check key was released during frame
+         * \param key Input key
+         * \return True if key was released during frame, even if it was pressed again afterwards
+         */
+        [[nodiscard]] bool wasReleased(const InputKey key) const {
+            return this->released.test(static_cast<std::size_t>(key));
+        }
+    };
+}
+
+#endif // PENROSE_INPUT_INPUT_SNAPSHOT_HPP
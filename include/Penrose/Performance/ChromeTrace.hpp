@@ -0,0 +1,29 @@
+#ifndef PENROSE_PERFORMANCE_CHROME_TRACE_HPP
+#define PENROSE_PERFORMANCE_CHROME_TRACE_HPP
+
+#include <filesystem>
+#include <ostream>
+
+#include <Penrose/Api.hpp>
+#include <Penrose/Performance/Profiler.hpp>
+
+namespace Penrose {
+
+    /**
+     * \brief Write profiler capture in Chrome trace event format
+     * \details Output is accepted by chrome://tracing and Perfetto UI. Scopes are written as complete events, counters
+     * as counter events and frames as complete events on separate track.
+     * \param capture Profiler capture
+     * \param stream Output stream
+     */
+    PENROSE_API void writeChromeTrace(const Profiler::Capture &capture, std::ostream &stream);
+
+    /**
+     * \brief Write profiler capture in Chrome trace event format into file
+     * \param capture Profiler capture
+     * \param path Path to file
+     */
+    PENROSE_API void writeChromeTrace(const Profiler::Capture &capture, const std::filesystem::path &path);
+}
+
+#endif // PENROSE_PERFORMANCE_CHROME_TRACE_HPP
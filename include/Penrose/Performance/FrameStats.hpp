@@ -0,0 +1,236 @@
+#ifndef PENROSE_PERFORMANCE_FRAME_STATS_HPP
+#define PENROSE_PERFORMANCE_FRAME_STATS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <Penrose/Api.hpp>
+#include <Penrose/Common/Log.hpp>
+#include <Penrose/Performance/MetricsRegistry.hpp>
+#include <Penrose/Performance/Profiler.hpp>
+#include <Penrose/Resources/Resource.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+#include <Penrose/Resources/Updatable.hpp>
+
+namespace Penrose {
+
+    /**
+     * \brief Source of frame times
+     */
+    enum class FrameSource : std::uint8_t {
+
+        /**
+         * \brief Interval between engine updates on main thread
+         */
+        Engine,
+
+        /**
+         * \brief Interval between rendered frames
+         */
+        Render,
+
+        /**
+         * \brief Duration of single tick of every running system
+         */
+        Systems
+    };
+
+    /**
+     * \brief Count of frame sources
+     */
+    inline constexpr std::size_t FRAME_SOURCE_COUNT = 3;
+
+    /**
+     * \brief Statistics of frame times over most recent FrameStats::WINDOW frames or over captured frames, in seconds
+     */
+    struct PENROSE_API FrameTimeStats {
+
+        /**
+         * \brief Count of frames
+         */
+        std::uint64_t count;
+
+        /**
+         * \brief Median frame time
+         */
+        float p50;
+
+        /**
+         * \brief 95th percentile of frame time
+         */
+        float p95;
+
+        /**
+         * \brief 99th percentile of frame time
+         */
+        float p99;
+
+        /**
+         * \brief Longest frame time
+         */
+        float max;
+    };
+
+    /**
+     * \brief Frame, which took longer than hitch threshold
+     */
+    struct PENROSE_API FrameHitch {
+
+        /**
+         * \brief Source of hitching frame
+         */
+        FrameSource source;
+
+        /**
+         * \brief Duration of frame in seconds
+         */
+        float duration;
+
+        /**
+         * \brief Wall clock time, at which frame was recorded
+         */
+        std::chrono::system_clock::time_point time;
+
+        /**
+         * \brief Profiler scopes of frames around hitch
+         */
+        Profiler::Capture capture;
+    };
+
+    /**
+     * \brief Frame statistics definition
+     */
+    struct PENROSE_API FrameStatsInfo {
+
+        /**
+         * \brief Duration of frame in seconds, above which frame is considered a hitch
+         */
+        float hitchThreshold = 0.05f;
+
+        /**
+         * \brief Count of most recent hitches, which are kept until FrameStats::takeHitches
+         */
+        std::uint32_t maxHitchCount = 16;
+
+        /**
+         * \brief Directory, into which every hitch is written as Chrome trace, nothing keeps hitches in memory only
+         */
+        std::optional<std::filesystem::path> hitchDumpDirectory;
+
+        /**
+         * \brief Interval between summaries in seconds, summary is written into log and metrics
+         */
+        float summaryInterval = 10;
+    };
+
+    /**
+     * \brief Rolling frame time statistics and hitch detector
+     * \details Frame times are recorded by engine loop, render thread and system manager. Frame, which exceeds hitch
+     * threshold, is resolved on next FrameStats::endFrame into snapshot of recent profiler frames.
+     */
+    class PENROSE_API FrameStats final: public Resource<FrameStats>,
+                                        public Updatable {
+    public:
+        /**
+         * \brief Count of most recent frames per source, which are used in statistics
+         */
+        static constexpr std::uint32_t WINDOW = 512;
+
+        explicit FrameStats(const ResourceSet *resources);
+        ~FrameStats() override = default;
+
+        /**
+         * \brief Set frame statistics definition
+         * \param info Frame statistics definition
+         */
+        void setInfo(FrameStatsInfo &&info);
+
+        /**
+         * \brief Record frame time, could be called from any thread
+         * \param source Source of frame
+         * \param duration Duration of frame in seconds
+         */
+        void record(FrameSource source, float duration);
+
+        /**
+         * \brief Resolve hitches recorded since previous call, should be called right after Profiler::endFrame
+         */
+        void endFrame();
+
+        /**
+         * \brief Get statistics of frame times
+         * \param source Source of frames
+         * \return Frame time statistics or nothing, if no frames were recorded
+         */
+        [[nodiscard]] std::optional<FrameTimeStats> getStats(FrameSource source);
+
+        /**
+         * \brief Start capture of every recorded frame time, which is not limited by window
+         * \details Previous capture, which was not taken, is discarded.
+         */
+        void beginCapture();
+
+        /**
+         * \brief Finish capture and take statistics of frames recorded since FrameStats::beginCapture
+         * \return Statistics of captured frames per source, nothing for sources without captured frames
+         */
+        [[nodiscard]] std::array<std::optional<FrameTimeStats>, FRAME_SOURCE_COUNT> takeCapture();
+
+        /**
+         * \brief Take resolved hitches
+         * \return Hitches, oldest first
+         */
+        [[nodiscard]] std::vector<FrameHitch> takeHitches();
+
+        //! \copydoc Updatable::update
+        void update(float delta) override;
+
+    private:
+        struct PendingHitch {
+            FrameSource source;
+            float duration;
+            std::chrono::system_clock::time_point time;
+        };
+
+        struct SourceWindow {
+            std::mutex mutex;
+            std::array<float, WINDOW> durations;
+            std::uint64_t count = 0;
+            std::optional<std::vector<float>> captured;
+        };
+
+        struct SourceMetrics {
+            MetricHistogram *time;
+            MetricGauge *p99;
+            MetricCounter *hitches;
+        };
+
+        ResourceProxy<Log> _log;
+        ResourceProxy<Profiler> _profiler;
+        ResourceProxy<MetricsRegistry> _metrics;
+
+        std::array<SourceMetrics, FRAME_SOURCE_COUNT> _sourceMetrics;
+        std::array<SourceWindow, FRAME_SOURCE_COUNT> _windows;
+        std::atomic<float> _hitchThreshold;
+
+        std::mutex _hitchesMutex;
+        FrameStatsInfo _info;
+        std::vector<PendingHitch> _pendingHitches;
+        std::deque<FrameHitch> _hitches;
+        std::uint64_t _hitchIdx = 0;
+
+        float _sinceSummary = 0;
+
+        void writeSummary();
+        void dumpHitch(const std::filesystem::path &directory, const FrameHitch &hitch);
+    };
+}
+
+#endif // PENROSE_PERFORMANCE_FRAME_STATS_HPP
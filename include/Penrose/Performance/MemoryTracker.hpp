@@ -0,0 +1,157 @@
+#ifndef PENROSE_PERFORMANCE_MEMORY_TRACKER_HPP
+#define PENROSE_PERFORMANCE_MEMORY_TRACKER_HPP
+
+#include <array>
+#include <cstdint>
+
+#include <Penrose/Api.hpp>
+#include <Penrose/Performance/MetricsRegistry.hpp>
+#include <Penrose/Resources/Resource.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+
+namespace Penrose {
+
+    /**
+     * \brief Subsystem, which heap allocations are accounted to
+     */
+    enum class MemoryTag : std::uint8_t {
+        Untagged,
+        ECS,
+        Scene,
+        Rendering,
+        Assets,
+        UI
+    };
+
+    /**
+     * \brief Count of memory tags
+     */
+    inline constexpr std::size_t MEMORY_TAG_COUNT = 6;
+
+    /**
+     * \brief Heap usage of single memory tag
+     */
+    struct PENROSE_API MemoryTagStats {
+
+        /**
+         * \brief Bytes allocated and not freed yet
+         */
+        std::uint64_t liveBytes;
+
+        /**
+         * \brief Maximum of live bytes since start of process
+         */
+        std::uint64_t peakBytes;
+
+        /**
+         * \brief Count of allocations since start of process
+         */
+        std::uint64_t allocations;
+
+        /**
+         * \brief Count of allocations of all threads during last completed frame
+         */
+        std::uint64_t frameAllocations;
+
+        /**
+         * \brief Count of allocations of thread, which completes frames, during last completed frame
+         */
+        std::uint64_t loopFrameAllocations;
+    };
+
+    /**
+     * \brief Scope, which accounts heap allocations of current thread to memory tag
+     * \details Scopes are nested, previous tag is restored on scope destruction. Deallocations are always accounted to
+     * tag of allocation.
+     */
+    class PENROSE_API MemoryTagScope {
+    public:
+        explicit MemoryTagScope(MemoryTag tag);
+        ~MemoryTagScope();
+
+        MemoryTagScope(const MemoryTagScope &) = delete;
+        MemoryTagScope(MemoryTagScope &&) = delete;
+        MemoryTagScope &operator=(const MemoryTagScope &) = delete;
+        MemoryTagScope &operator=(MemoryTagScope &&) = delete;
+
+    private:
+        MemoryTag _previousTag;
+    };
+
+    /**
+     * \brief Memory tracker definition
+     */
+    struct PENROSE_API MemoryTrackerInfo {
+
+        /**
+         * \brief Fail frame, which allocates after warm-up, by throwing EngineError from MemoryTracker::endFrame
+         * \details Only allocations of thread, which completes frames, are checked, so allocations of log writer,
+         * render thread and other workers do not fail frame.
+         */
+        bool zeroFrameAllocations = false;
+
+        /**
+         * \brief Count of frames, which are allowed to allocate before steady state is expected
+         */
+        std::uint32_t warmupFrames = 60;
+    };
+
+    /**
+     * \brief Heap accounting per subsystem
+     * \details Accounting is opt-in: engine should be built with memory_tracking option, which replaces global
+     * operator new and operator delete. Otherwise all statistics stay zero. Live and peak bytes are published into
+     * metrics as memory.<tag>.live_bytes and memory.<tag>.peak_bytes, allocations of last frame are published as
+     * memory.<tag>.frame_allocations.
+     */
+    class PENROSE_API MemoryTracker final: public Resource<MemoryTracker> {
+    public:
+        explicit MemoryTracker(const ResourceSet *resources);
+        ~MemoryTracker() override = default;
+
+        /**
+         * \brief Check whether engine was built with allocation tracking
+         * \return Allocation tracking availability
+         */
+        [[nodiscard]] static bool isEnabled();
+
+        /**
+         * \brief Set memory tracker definition
+         * \param info Memory tracker definition
+         */
+        void setInfo(MemoryTrackerInfo &&info);
+
+        /**
+         * \brief Complete frame: publish statistics into metrics and check steady state allocations
+         * \details Should be called once per frame on main thread. Allocations of all threads are published into
+         * metrics, while steady state is checked only for allocations of calling thread.
+         */
+        void endFrame();
+
+        /**
+         * \brief Get heap usage of memory tag
+         * \param tag Memory tag
+         * \return Heap usage
+         */
+        [[nodiscard]] MemoryTagStats getStats(MemoryTag tag) const;
+
+    private:
+        struct TagMetrics {
+            MetricGauge *liveBytes;
+            MetricGauge *peakBytes;
+            MetricGauge *frameAllocations;
+        };
+
+        ResourceProxy<MetricsRegistry> _metrics;
+
+        std::array<TagMetrics, MEMORY_TAG_COUNT> _tagMetrics;
+
+        MemoryTrackerInfo _info;
+        std::uint64_t _frameIdx = 0;
+        std::array<std::uint64_t, MEMORY_TAG_COUNT> _frameStartAllocations = {};
+        std::array<std::uint64_t, MEMORY_TAG_COUNT> _frameAllocations = {};
+        std::array<std::uint64_t, MEMORY_TAG_COUNT> _loopFrameStartAllocations = {};
+        std::array<std::uint64_t, MEMORY_TAG_COUNT> _loopFrameAllocations = {};
+    };
+}
+
+#endif // PENROSE_PERFORMANCE_MEMORY_TRACKER_HPP
@@ -0,0 +1,246 @@
+#ifndef PENROSE_PERFORMANCE_METRICS_REGISTRY_HPP
+#define PENROSE_PERFORMANCE_METRICS_REGISTRY_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Penrose/Api.hpp>
+#include <Penrose/Common/Log.hpp>
+#include <Penrose/Resources/Resource.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+#include <Penrose/Resources/Updatable.hpp>
+
+namespace Penrose {
+
+    /**
+     * \brief Monotonic counter metric
+     */
+    class PENROSE_API MetricCounter {
+    public:
+        /**
+         * \brief Increase counter
+         * \param value Increment
+         */
+        void add(const std::uint64_t value = 1) { this->_value.fetch_add(value, std::memory_order_relaxed); }
+
+        /**
+         * \brief Get current value of counter
+         * \return Value of counter
+         */
+        [[nodiscard]] std::uint64_t get() const { return this->_value.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic_uint64_t _value = 0;
+    };
+
+    /**
+     * \brief Gauge metric, which holds arbitrary current value
+     */
+    class PENROSE_API MetricGauge {
+    public:
+        /**
+         * \brief Set value of gauge
+         * \param value New value
+         */
+        void set(const double value) { this->_value.store(value, std::memory_order_relaxed); }
+
+        /**
+         * \brief Change value of gauge
+         * \param value Difference to apply
+         */
+        void add(double value);
+
+        /**
+         * \brief Get current value of gauge
+         * \return Value of gauge
+         */
+        [[nodiscard]] double get() const { return this->_value.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<double> _value = 0;
+    };
+
+    /**
+     * \brief Histogram metric with fixed bucket bounds
+     */
+    class PENROSE_API MetricHistogram {
+    public:
+        /**
+         * \brief Create histogram
+         * \param bounds Sorted upper bounds of buckets, values above last bound fall into overflow bucket
+         */
+        explicit MetricHistogram(std::vector<double> &&bounds);
+
+        /**
+         * \brief Record value
+         * \param value Value to record
+         */
+        void record(double value);
+
+    private:
+        friend class MetricsRegistry;
+
+        std::vector<double> _bounds;
+        std::unique_ptr<std::atomic_uint64_t[]> _buckets;
+        std::atomic_uint64_t _count = 0;
+        std::atomic<double> _sum = 0;
+        std::atomic<double> _min;
+        std::atomic<double> _max;
+    };
+
+    /**
+     * \brief Values of every registered metric at some moment
+     */
+    struct PENROSE_API MetricsSnapshot {
+
+        struct Counter {
+            std::string name;
+            std::uint64_t value;
+        };
+
+        struct Gauge {
+            std::string name;
+            double value;
+        };
+
+        struct Histogram {
+            std::string name;
+            std::uint64_t count;
+            double sum;
+            double min;
+            double max;
+
+            /**
+             * \brief Upper bounds of buckets
+             */
+            std::vector<double> bounds;
+
+            /**
+             * \brief Counts of values per bucket, last bucket holds values above last bound
+             */
+            std::vector<std::uint64_t> buckets;
+        };
+
+        std::vector<Counter> counters;
+        std::vector<Gauge> gauges;
+        std::vector<Histogram> histograms;
+    };
+
+    /**
+     * \brief Periodic dump of metrics into file
+     */
+    struct PENROSE_API MetricsDumpInfo {
+
+        /**
+         * \brief Path to file, every snapshot is appended as single JSON line
+         */
+        std::filesystem::path path;
+
+        /**
+         * \brief Interval between dumps in seconds
+         */
+        float interval = 1;
+    };
+
+    /**
+     * \brief Registry of named metrics
+     * \details Metrics are created on first request and live as long as registry, so instrumented code resolves them
+     * once and updates them without locking.
+     */
+    class PENROSE_API MetricsRegistry final: public Resource<MetricsRegistry>,
+                                             public Updatable {
+    public:
+        /**
+         * \brief Default bucket bounds, suitable for latencies in milliseconds
+         */
+        static constexpr std::array DEFAULT_BOUNDS = {
+            0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0, 25.0, 50.0, 100.0, 250.0, 1000.0,
+        };
+
+        MetricsRegistry() = default;
+
+        /**
+         * \brief Create registry, which reports failed dumps into log
+         * \param resources Resource set
+         */
+        explicit MetricsRegistry(const ResourceSet *resources);
+
+        ~MetricsRegistry() override = default;
+
+        /**
+         * \brief Get or create counter
+         * \param name Name of metric
+         * \return Instance of counter
+         */
+        [[nodiscard]] MetricCounter *counter(std::string_view name);
+
+        /**
+         * \brief Get or create gauge
+         * \param name Name of metric
+         * \return Instance of gauge
+         */
+        [[nodiscard]] MetricGauge *gauge(std::string_view name);
+
+        /**
+         * \brief Get or create histogram with default bucket bounds
+         * \param name Name of metric
+         * \return Instance of histogram
+         */
+        [[nodiscard]] MetricHistogram *histogram(std::string_view name);
+
+        /**
+         * \brief Get or create histogram
+         * \param name Name of metric
+         * \param bounds Sorted upper bounds of buckets, ignored if histogram already exists
+         * \return Instance of histogram
+         */
+        [[nodiscard]] MetricHistogram *histogram(std::string_view name, std::vector<double> &&bounds);
+
+        /**
+         * \brief Get values of every metric
+         * \return Snapshot of metrics
+         */
+        [[nodiscard]] MetricsSnapshot snapshot();
+
+        /**
+         * \brief Set periodic dump of metrics into file
+         * \details Dump is skipped if file could not be opened.
+         * \param dumpInfo Dump definition or nothing to disable dump
+         */
+        void setDumpInfo(std::optional<MetricsDumpInfo> &&dumpInfo);
+
+        //! \copydoc Updatable::update
+        void update(float delta) override;
+
+    private:
+        std::optional<ResourceProxy<Log>> _log;
+
+        std::mutex _mutex;
+        std::map<std::string, std::unique_ptr<MetricCounter>, std::less<>> _counters;
+        std::map<std::string, std::unique_ptr<MetricGauge>, std::less<>> _gauges;
+        std::map<std::string, std::unique_ptr<MetricHistogram>, std::less<>> _histograms;
+
+        std::optional<MetricsDumpInfo> _dumpInfo;
+        float _sinceDump = 0;
+    };
+
+    /**
+     * \brief Write snapshot of metrics as single line of JSON
+     * \param snapshot Snapshot of metrics
+     * \param stream Output stream
+     */
+    PENROSE_API void writeMetrics(const MetricsSnapshot &snapshot, std::ostream &stream);
+}
+
+#endif // PENROSE_PERFORMANCE_METRICS_REGISTRY_HPP
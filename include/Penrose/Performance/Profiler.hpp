@@ -1,58 +1,314 @@
 #ifndef PENROSE_PERFORMANCE_PROFILER_HPP
 #define PENROSE_PERFORMANCE_PROFILER_HPP
 
+#include <array>
+#include <atomic>
 #include <chrono>
-#include <list>
-#include <map>
-#include <stack>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
+#include <Penrose/Api.hpp>
 #include <Penrose/Resources/Resource.hpp>
 
 namespace Penrose {
 
-    class Profiler : public Resource<Profiler> {
+    /**
+     * \brief Hierarchical scope profiler
+     * \details Every thread records finished scopes into its own fixed-size ring buffer without locking. Buffers are
+     * drained once per frame by Profiler::endFrame, which aggregates statistics for every scope. Scopes are identified
+     * by interned tags, so tags should be interned once and reused. Timestamps are taken from TSC where available and
+     * are converted to time through ratio, which is calibrated against steady clock.
+     */
+    class PENROSE_API Profiler: public Resource<Profiler> {
     public:
-        class FunctionCall {
+        using Clock = std::chrono::steady_clock;
+        using Ticks = std::uint64_t;
+        using TagId = std::uint32_t;
+
+        /**
+         * \brief Count of scope record slots per thread, older records are overwritten if buffer is not drained in time
+         */
+        static constexpr std::uint64_t THREAD_BUFFER_CAPACITY = 8192;
+
+        /**
+         * \brief Count of most recent durations per scope, which are used in statistics
+         */
+        static constexpr std::uint32_t STATS_WINDOW = 512;
+
+        /**
+         * \brief Count of most recent drained frames, which are kept for Profiler::getRecentFrames
+         */
+        static constexpr std::uint32_t HISTORY_FRAMES = 4;
+
+        /**
+         * \brief Record of finished scope
+         */
+        struct ScopeRecord {
+            TagId tag;
+            std::uint32_t depth;
+            Ticks begin;
+            Ticks end;
+        };
+
+        /**
+         * \brief Statistics of scope durations over most recent STATS_WINDOW records, in seconds
+         */
+        struct ScopeStats {
+            std::string tag;
+            std::uint64_t count;
+            float min;
+            float avg;
+            float max;
+            float p50;
+            float p95;
+            float p99;
+        };
+
+        /**
+         * \brief Sample of counter value
+         */
+        struct CounterSample {
+            TagId tag;
+            Ticks time;
+            double value;
+        };
+
+        /**
+         * \brief Scope records of single thread within capture
+         */
+        struct CaptureThread {
+            std::string name;
+            std::vector<ScopeRecord> records;
+        };
+
+        /**
+         * \brief Profiler data recorded over multiple frames
+         */
+        struct Capture {
+            double ticksPerSecond;
+            std::vector<std::string> tags;
+            std::vector<CaptureThread> threads;
+            std::vector<CounterSample> counters;
+            std::vector<Ticks> frames;
+        };
+
+        class ThreadBuffer;
+
+        /**
+         * \brief Scope guard, scope is recorded on destruction
+         */
+        class PENROSE_API Scope {
         public:
-            FunctionCall(Profiler *profiler, std::string_view &&tag);
-            ~FunctionCall();
+            Scope(ThreadBuffer *buffer, TagId tag);
+            ~Scope();
 
-            FunctionCall(const FunctionCall &) = delete;
-            FunctionCall(FunctionCall &&) = delete;
-            FunctionCall &operator=(const FunctionCall &) = delete;
-            FunctionCall &operator=(FunctionCall &&) = delete;
+            Scope(const Scope &) = delete;
+            Scope(Scope &&) = delete;
+            Scope &operator=(const Scope &) = delete;
+            Scope &operator=(Scope &&) = delete;
 
         private:
-            Profiler *_profiler;
+            ThreadBuffer *_buffer;
+            TagId _tag;
+            Ticks _begin;
+        };
+
+        class ThreadBuffer {
+        public:
+            explicit ThreadBuffer(std::thread::id threadId)
+                : _threadId(threadId) {
+                //
+            }
+
+        private:
+            friend class Profiler;
+            friend class Scope;
+
+            static constexpr std::uint64_t MASK = THREAD_BUFFER_CAPACITY - 1;
+
+            void push(const ScopeRecord &record) {
+                const auto head = this->_head.load(std::memory_order_relaxed);
+
+                this->_records[head & MASK] = record;
+                this->_head.store(head + 1, std::memory_order_release);
+            }
+
             std::thread::id _threadId;
-            std::string _tag;
+            std::string _name;
+            std::uint32_t _depth = 0;
+
+            // written only by owning thread, read by thread which drains buffer
+            std::atomic_uint64_t _head = 0;
+            std::uint64_t _tail = 0;
+            std::array<ScopeRecord, THREAD_BUFFER_CAPACITY> _records;
         };
 
+        static_assert((THREAD_BUFFER_CAPACITY & (THREAD_BUFFER_CAPACITY - 1)) == 0);
+
+        Profiler();
         ~Profiler() override = default;
 
-        [[nodiscard]] FunctionCall begin(std::string_view &&tag);
+        /**
+         * \brief Get current timestamp
+         * \return Timestamp in ticks
+         */
+        [[nodiscard]] static Ticks now();
+
+        /**
+         * \brief Get count of ticks per second
+         * \return Calibrated count of ticks per second
+         */
+        [[nodiscard]] double getTicksPerSecond();
+
+        /**
+         * \brief Get identifier of tag, identifier is allocated on first use of tag
+         * \param tag Name of scope
+         * \return Identifier of tag
+         */
+        [[nodiscard]] TagId intern(std::string_view tag);
+
+        /**
+         * \brief Get name of interned tag
+         * \param tag Identifier of tag
+         * \return Name of scope
+         */
+        [[nodiscard]] std::string getTagName(TagId tag);
+
+        /**
+         * \brief Set name of current thread
+         * \param name Name of thread
+         */
+        void setThreadName(std::string_view name);
+
+        /**
+         * \brief Begin scope on current thread
+         * \param tag Identifier of tag
+         * \return Scope guard
+         */
+        [[nodiscard]] Scope begin(TagId tag);
+
+        /**
+         * \brief Begin scope on current thread
+         * \details Tag is interned on every call, so this overload should not be used on hot paths.
+         * \param tag Name of scope
+         * \return Scope guard
+         */
+        [[nodiscard]] Scope begin(std::string_view tag);
+
+        /**
+         * \brief Add track, which is not bound to any thread
+         * \details Track holds scopes, which are measured elsewhere (i.e. on GPU) and are recorded through
+         * Profiler::record. Track is drained as every other thread, so only single thread should record into it.
+         * \param name Name of track
+         * \return Track instance, which lives as long as profiler
+         */
+        [[nodiscard]] ThreadBuffer *addTrack(std::string_view name);
+
+        /**
+         * \brief Record finished scope into track
+         * \param track Track, created by Profiler::addTrack
+         * \param record Scope record
+         */
+        void record(ThreadBuffer *track, const ScopeRecord &record) { track->push(record); }
+
+        /**
+         * \brief Drain scopes recorded by every thread and update statistics
+         */
+        void endFrame();
+
+        /**
+         * \brief Get statistics of every recorded scope
+         * \return Scope statistics, actual after last Profiler::endFrame
+         */
+        [[nodiscard]] std::vector<ScopeStats> getStats();
+
+        /**
+         * \brief Get scope records of most recent drained frames
+         * \details Records are kept for at most HISTORY_FRAMES frames regardless of capture, so recent frames could be
+         * inspected after the fact (i.e. when frame took too long).
+         * \return Capture of most recent frames, oldest first
+         */
+        [[nodiscard]] Capture getRecentFrames();
+
+        /**
+         * \brief Get count of scope records, which were overwritten before they were drained
+         * \return Count of dropped records
+         */
+        [[nodiscard]] std::uint64_t getDroppedCount();
+
+        /**
+         * \brief Record value of counter, value is kept only while capture is active
+         * \param tag Identifier of counter tag
+         * \param value Value of counter
+         */
+        void recordCounter(TagId tag, double value);
+
+        /**
+         * \brief Start capture of scopes from every thread
+         * \details Previous capture, which was not taken, is discarded.
+         * \param frameCount Count of frames to capture
+         */
+        void beginCapture(std::uint32_t frameCount);
+
+        /**
+         * \brief Check if capture is active
+         * \return Is capture active
+         */
+        [[nodiscard]] bool isCapturing() const { return this->_capturing.load(std::memory_order_relaxed); }
+
+        /**
+         * \brief Take finished capture
+         * \return Finished capture or nothing, if capture is active or was not started
+         */
+        [[nodiscard]] std::optional<Capture> takeCapture();
 
     private:
-        struct RecordedCall {
-            std::string tag;
-            std::chrono::high_resolution_clock::duration duration;
-            std::list<RecordedCall> nestedCalls;
+        struct TagStats {
+            std::array<float, STATS_WINDOW> durations;
+            std::uint64_t count = 0;
         };
 
-        struct CurrentCall {
-            std::string tag;
-            std::chrono::high_resolution_clock::time_point begin;
-            RecordedCall *recording;
+        std::uint64_t _instanceId;
+
+        Ticks _calibrationTicks;
+        Clock::time_point _calibrationTime;
+        double _ticksPerSecond;
+
+        std::mutex _tagsMutex;
+        std::unordered_map<std::string, TagId> _tagIds;
+        std::deque<std::string> _tagNames;
+
+        std::mutex _threadsMutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> _threads;
+
+        std::mutex _statsMutex;
+        std::unordered_map<TagId, TagStats> _tagStats;
+        std::vector<ScopeStats> _stats;
+        std::uint64_t _droppedCount = 0;
+
+        struct HistoryFrame {
+            Ticks end;
+            std::vector<std::vector<ScopeRecord>> threads;
         };
 
-        std::map<std::thread::id, std::stack<CurrentCall>> _currentCallstacks;
-        std::map<std::thread::id, RecordedCall> _recordedCallstacks;
+        std::array<HistoryFrame, HISTORY_FRAMES> _history;
+        std::uint64_t _historyCount = 0;
+
+        std::atomic_bool _capturing = false;
+        std::uint32_t _captureFramesLeft = 0;
+        std::optional<Capture> _capture;
+
+        [[nodiscard]] ThreadBuffer *getThreadBuffer();
 
-        void pushFunctionCall(const std::thread::id &threadId, const std::string_view &tag);
-        void popFunctionCall(const std::thread::id &threadId);
+        void calibrate();
     };
 }
 
@@ -0,0 +1,55 @@
+#ifndef PENROSE_RENDERING_FRAME_CAPTURE_HPP
+#define PENROSE_RENDERING_FRAME_CAPTURE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Penrose/Api.hpp>
+
+namespace Penrose {
+
+    /**
+     * \brief Contents of rendered frame, read back from GPU
+     */
+    struct PENROSE_API FrameCapture {
+
+        /**
+         * \brief Index of frame
+         */
+        std::uint64_t frameIdx;
+
+        /**
+         * \brief Width of frame
+         */
+        std::uint32_t width;
+
+        /**
+         * \brief Height of frame
+         */
+        std::uint32_t height;
+
+        /**
+         * \brief Tightly packed RGBA8 pixels, row by row from top to bottom
+         */
+        std::vector<std::byte> data;
+    };
+
+    /**
+     * \brief Interface of frame capture handler
+     * \details Frames are read back only for offscreen surfaces and only when any handler is available. Handlers are
+     * invoked from rendering thread, so any slow processing of frame should be deferred to other thread.
+     */
+    class PENROSE_API FrameCaptureHandler {
+    public:
+        virtual ~FrameCaptureHandler() = default;
+
+        /**
+         * \brief Handle captured frame
+         * \param capture Captured frame
+         */
+        virtual void onFrameCaptured(const FrameCapture &capture) = 0;
+    };
+}
+
+#endif // PENROSE_RENDERING_FRAME_CAPTURE_HPP
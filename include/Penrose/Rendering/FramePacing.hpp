@@ -0,0 +1,98 @@
+#ifndef PENROSE_RENDERING_FRAME_PACING_HPP
+#define PENROSE_RENDERING_FRAME_PACING_HPP
+
+#include <cstdint>
+#include <optional>
+
+#include <Penrose/Api.hpp>
+
+namespace Penrose {
+
+    /**
+     * \brief Frame pacing modes
+     */
+    enum class FramePacingMode {
+
+        /**
+         * \brief Frames are rendered as fast as possible, presentation is not synchronized with display
+         */
+        Unlimited,
+
+        /**
+         * \brief Frames are presented in sync with display refresh
+         */
+        Vsync,
+
+        /**
+         * \brief Frames are rendered with fixed target rate
+         */
+        TargetRate
+    };
+
+    /**
+     * \brief Frame pacing definition
+     */
+    struct PENROSE_API FramePacingInfo {
+
+        /**
+         * \brief Frame pacing mode
+         */
+        FramePacingMode mode = FramePacingMode::Vsync;
+
+        /**
+         * \brief Target count of frames per second, used only in FramePacingMode::TargetRate mode
+         */
+        std::uint32_t targetRate = 60;
+
+        /**
+         * \brief Target count of engine updates per second, zero disables limit
+         * \details Updates are paced independently, so they are not held back by rendering.
+         */
+        std::uint32_t updateRate = 120;
+
+        /**
+         * \brief Count of frames, which could be recorded by CPU while previous frames are still processed by GPU
+         * \details Lower count reduces input latency, higher count hides CPU and GPU hitches.
+         */
+        std::uint32_t framesInFlight = 2;
+    };
+
+    /**
+     * \brief Timings of single rendered frame, in seconds
+     */
+    struct PENROSE_API FrameTiming {
+
+        /**
+         * \brief Index of frame
+         */
+        std::uint64_t frameIdx = 0;
+
+        /**
+         * \brief Time between beginnings of this and previous frames
+         */
+        float frameTime = 0;
+
+        /**
+         * \brief Time spent sleeping by frame pacer
+         */
+        float pacingTime = 0;
+
+        /**
+         * \brief Time spent waiting for frame resources, i.e. for GPU to finish older frame
+         */
+        float waitTime = 0;
+
+        /**
+         * \brief Time spent by CPU on recording and submitting frame
+         */
+        float cpuTime = 0;
+
+        /**
+         * \brief Time spent by GPU on executing frame, not available if unsupported by render system
+         * \details GPU time is resolved when frame is finished, so it belongs to one of previous frames.
+         */
+        std::optional<float> gpuTime = std::nullopt;
+    };
+}
+
+#endif // PENROSE_RENDERING_FRAME_PACING_HPP
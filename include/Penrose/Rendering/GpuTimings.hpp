@@ -0,0 +1,57 @@
+#ifndef PENROSE_RENDERING_GPU_TIMINGS_HPP
+#define PENROSE_RENDERING_GPU_TIMINGS_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <Penrose/Api.hpp>
+#include <Penrose/Performance/Profiler.hpp>
+
+namespace Penrose {
+
+    /**
+     * \brief GPU execution time of single scope, i.e. renderer or render graph pass
+     */
+    struct PENROSE_API GpuScopeTiming {
+
+        /**
+         * \brief Profiler tag of scope
+         */
+        Profiler::TagId tag;
+
+        /**
+         * \brief Count of enclosing scopes
+         */
+        std::uint32_t depth;
+
+        /**
+         * \brief Beginning of scope relative to beginning of frame on GPU, in seconds
+         */
+        float begin;
+
+        /**
+         * \brief End of scope relative to beginning of frame on GPU, in seconds
+         */
+        float end;
+    };
+
+    /**
+     * \brief GPU timings of single finished frame
+     */
+    struct PENROSE_API GpuFrameTimings {
+
+        /**
+         * \brief Profiler timestamp of frame submission
+         * \details GPU and CPU clocks are not synchronized, so GPU scopes are placed on CPU timeline relatively to
+         * submission of their frame.
+         */
+        std::uint64_t submitTime;
+
+        /**
+         * \brief Timings of every scope, which was recorded within frame
+         */
+        std::vector<GpuScopeTiming> scopes;
+    };
+}
+
+#endif // PENROSE_RENDERING_GPU_TIMINGS_HPP
@@ -61,6 +61,8 @@ namespace Penrose {
     /**
      * \brief Attachment info for render graph
      * \details Attachments are used in render graph to define which targets should be treated as inputs or outputs.
+     * Image attachments which are neither loaded nor stored are transient: their memory is shared with other transient
+     * attachments which are not used at the same time.
      */
     struct PENROSE_API AttachmentInfo {
 
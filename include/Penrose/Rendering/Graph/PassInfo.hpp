@@ -12,12 +12,14 @@ namespace Penrose {
      * \brief Pass info for render graph
      * \details Render graph is consisted of passes which defines which targets are used as inputs or outputs. Pass
      * can be dependent on different passes. Pass can specify optional function name which invokes required renderer
-     * logic.
+     * logic. Passes are executed in dependency order, passes which do not contribute to any stored attachment are
+     * culled.
      */
     struct PENROSE_API PassInfo {
 
         /**
          * \brief Pass dependencies
+         * \details Dependencies define execution order only, barriers are derived from attachments shared by passes.
          */
         std::vector<std::uint32_t> dependsOn;
 
@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 
 namespace Penrose {
 
@@ -12,7 +13,8 @@ namespace Penrose {
     enum class BufferType {
         Uniform,
         Vertex,
-        Index
+        Index,
+        Storage
     };
 
     /**
@@ -45,6 +47,13 @@ namespace Penrose {
          * \return Pointer to raw data of buffer
          */
         [[nodiscard]] virtual DataPtr getData() const = 0;
+
+        /**
+         * \brief Get bindless index of buffer
+         * \details Only storage buffers are registered in global buffer array.
+         * \return Bindless index of buffer or nothing, if buffer is not a storage buffer
+         */
+        [[nodiscard]] virtual std::optional<std::uint32_t> getBindlessIndex() const = 0;
     };
 
     /**
@@ -32,6 +32,14 @@ namespace Penrose {
          * \return Height of image
          */
         [[nodiscard]] virtual std::uint32_t getHeight() const = 0;
+
+        /**
+         * \brief Get bindless index of image
+         * \details Index is assigned on image creation and stays stable for whole lifetime of image. Shaders of
+         * bindless pipelines address image through global image array by this index.
+         * \return Bindless index of image
+         */
+        [[nodiscard]] virtual std::uint32_t getBindlessIndex() const = 0;
     };
 }
 
@@ -177,6 +177,13 @@ namespace Penrose {
          */
         std::vector<PipelineObject> objects;
 
+        /**
+         * \brief Use global bindless set
+         * \details Bindless pipelines get global image, sampler and storage buffer arrays in descriptor set 0, objects
+         * of pipeline are moved to descriptor set 1.
+         */
+        bool bindless = false;
+
         friend auto operator<=>(const PipelineInfo &, const PipelineInfo &) = default;
     };
 }
@@ -61,6 +61,14 @@ namespace Penrose {
          * \return Border color of sampler
          */
         [[nodiscard]] virtual SamplerBorderColor getBorderColor() const = 0;
+
+        /**
+         * \brief Get bindless index of sampler
+         * \details Index is assigned on sampler creation and stays stable for whole lifetime of sampler. Shaders of
+         * bindless pipelines address sampler through global sampler array by this index.
+         * \return Bindless index of sampler
+         */
+        [[nodiscard]] virtual std::uint32_t getBindlessIndex() const = 0;
     };
 }
 
@@ -0,0 +1,27 @@
+#ifndef PENROSE_RENDERING_OFFSCREEN_SURFACE_HPP
+#define PENROSE_RENDERING_OFFSCREEN_SURFACE_HPP
+
+#include <cstdint>
+
+#include <Penrose/Rendering/Surface.hpp>
+
+namespace Penrose {
+
+    /**
+     * \brief Surface without presentation target
+     * \details Render systems render offscreen surfaces into their own images instead of swapchain, which allows to
+     * run rendering without display.
+     */
+    class OffscreenSurface : public Surface {
+    public:
+        ~OffscreenSurface() override = default;
+
+        /**
+         * \brief Get count of images, which are rendered in round-robin order
+         * \return Count of images
+         */
+        [[nodiscard]] virtual std::uint32_t getImageCount() const = 0;
+    };
+}
+
+#endif // PENROSE_RENDERING_OFFSCREEN_SURFACE_HPP
@@ -0,0 +1,36 @@
+#ifndef PENROSE_RENDERING_PIPELINE_WARM_UP_HPP
+#define PENROSE_RENDERING_PIPELINE_WARM_UP_HPP
+
+#include <string>
+
+#include <Penrose/Api.hpp>
+#include <Penrose/Rendering/Graph/GraphInfo.hpp>
+#include <Penrose/Rendering/Objects/Pipeline.hpp>
+
+namespace Penrose {
+
+    /**
+     * \brief Declaration of pipeline usage, which is compiled ahead of rendering
+     * \details Pipelines are compiled for exact render pass and subpass. Declared pipelines are compiled in parallel
+     * when rendering is started, otherwise they are compiled on first use and stall recording of frame.
+     */
+    struct PENROSE_API PipelineWarmUpInfo {
+
+        /**
+         * \brief Pipeline to compile
+         */
+        Pipeline *pipeline;
+
+        /**
+         * \brief Render graph, in which pipeline is used
+         */
+        GraphInfo graph;
+
+        /**
+         * \brief Renderer function of graph pass, in which pipeline is bound
+         */
+        std::string function;
+    };
+}
+
+#endif // PENROSE_RENDERING_PIPELINE_WARM_UP_HPP
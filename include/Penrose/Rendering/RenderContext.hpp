@@ -1,6 +1,14 @@
 #ifndef PENROSE_RENDERING_RENDER_CONTEXT_HPP
 #define PENROSE_RENDERING_RENDER_CONTEXT_HPP
 
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <Penrose/Performance/Profiler.hpp>
+#include <Penrose/Rendering/FramePacing.hpp>
+#include <Penrose/Rendering/GpuTimings.hpp>
+#include <Penrose/Rendering/PipelineWarmUp.hpp>
 #include <Penrose/Rendering/RendererContext.hpp>
 
 namespace Penrose {
@@ -37,6 +45,51 @@ namespace Penrose {
          * which are strictly depends on swapchain.
          */
         virtual void invalidate() = 0;
+
+        /**
+         * \brief Set frame pacing of current context
+         * \details Pacing is applied on next invalidation.
+         * \param pacingInfo Frame pacing definition
+         */
+        virtual void setPacingInfo(const FramePacingInfo &pacingInfo) = 0;
+
+        /**
+         * \brief Get GPU execution time of most recently finished frame
+         * \return GPU time in seconds or nothing, if GPU timings are not supported
+         */
+        [[nodiscard]] virtual std::optional<float> getGpuTime() const = 0;
+
+        /**
+         * \brief Begin GPU timing scope in current frame
+         * \details Scopes could be nested and should be ended in reverse order. Scopes are ignored, if GPU timings are
+         * not supported. Scope is identified by tag, which should be interned in profiler once, e.g. "GPU Renderer X".
+         * \param tag Profiler tag of scope
+         */
+        virtual void beginGpuScope(Profiler::TagId tag) = 0;
+
+        /**
+         * \brief End most recently started GPU timing scope
+         */
+        virtual void endGpuScope() = 0;
+
+        /**
+         * \brief Take GPU scope timings of most recently finished frame
+         * \details Timings are resolved when frame resources are reused, so they are taken only once.
+         * \return GPU scope timings or nothing, if there are no new timings or GPU timings are not supported
+         */
+        [[nodiscard]] virtual std::optional<GpuFrameTimings> takeGpuTimings() = 0;
+
+        /**
+         * \brief Compile declared pipelines ahead of rendering
+         * \param warmUp List of pipeline declarations
+         */
+        virtual void warmUpPipelines(const std::vector<PipelineWarmUpInfo> &warmUp) = 0;
+
+        /**
+         * \brief Get count of pipelines, which were not warmed up and were compiled while recording frames
+         * \return Count of pipelines
+         */
+        [[nodiscard]] virtual std::uint32_t getMidFramePipelineCount() const = 0;
     };
 }
 
@@ -1,8 +1,8 @@
 #ifndef PENROSE_RENDERING_RENDER_LIST_HPP
 #define PENROSE_RENDERING_RENDER_LIST_HPP
 
-#include <array>
 #include <cstdint>
+#include <limits>
 #include <list>
 #include <string>
 #include <vector>
@@ -12,17 +12,22 @@
 
 namespace Penrose {
 
-    // TODO: should be configurable
-    constexpr static const std::uint32_t TEXTURE_COUNT = 64;
+    // texture of instance, which image is not loaded yet, renderers substitute it with their placeholder
+    inline constexpr std::uint32_t NO_TEXTURE_ID = std::numeric_limits<std::uint32_t>::max();
 
     struct Texture {
         std::string asset;
+
+        // index of image in bindless table or NO_TEXTURE_ID
+        std::uint32_t bindlessIndex;
     };
 
     struct MeshInstance {
         glm::mat4 model;
         glm::mat4 modelRot;
         glm::vec3 color;
+
+        // index of albedo image in bindless table or NO_TEXTURE_ID
         std::uint32_t albedoTextureId;
     };
 
@@ -34,8 +39,7 @@ namespace Penrose {
     struct RenderList {
         View view;
 
-        std::uint32_t textureCount;
-        std::array<Texture, TEXTURE_COUNT> textures;
+        std::vector<Texture> textures;
 
         std::list<Mesh> meshes;
     };
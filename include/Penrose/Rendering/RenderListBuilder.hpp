@@ -6,9 +6,12 @@
 #include <optional>
 #include <set>
 
+#include <Penrose/Assets/AssetManager.hpp>
 #include <Penrose/ECS/Entity.hpp>
 #include <Penrose/Events/ECSEvents.hpp>
 #include <Penrose/Events/EventQueue.hpp>
+#include <Penrose/Performance/MetricsRegistry.hpp>
+#include <Penrose/Performance/Profiler.hpp>
 #include <Penrose/Rendering/DrawableProvider.hpp>
 #include <Penrose/Rendering/RenderList.hpp>
 #include <Penrose/Rendering/ViewProvider.hpp>
@@ -36,10 +39,18 @@ namespace Penrose {
         [[nodiscard]] std::optional<RenderList> tryBuildRenderList(const std::string &name);
 
     private:
+        ResourceProxy<AssetManager> _assetManager;
         ResourceProxy<ECSEventQueue> _eventQueue;
         ResourceProxy<SceneManager> _sceneManager;
         ResourceProxy<DrawableProvider> _drawableProviders;
         ResourceProxy<ViewProvider> _viewProviders;
+        ResourceProxy<MetricsRegistry> _metrics;
+        ResourceProxy<Profiler> _profiler;
+
+        MetricGauge *_drawablesMetric;
+        MetricGauge *_bucketsMetric;
+        MetricHistogram *_buildTimeMetric;
+        Profiler::TagId _buildTag;
 
         std::mutex _mutex;
 
@@ -1,8 +1,10 @@
 #ifndef PENROSE_RENDERING_RENDER_MANAGER_HPP
 #define PENROSE_RENDERING_RENDER_MANAGER_HPP
 
+#include <cstdint>
 #include <typeindex>
 
+#include <Penrose/Rendering/FramePacing.hpp>
 #include <Penrose/Rendering/Renderer.hpp>
 #include <Penrose/Rendering/RenderExecutionInfo.hpp>
 #include <Penrose/Rendering/RenderSystem.hpp>
@@ -60,6 +62,39 @@ namespace Penrose {
          * \return Current execution information
          */
         [[nodiscard]] virtual RenderExecutionInfo getExecutionInfo() = 0;
+
+        /**
+         * \brief Set frame pacing
+         * \param pacingInfo Frame pacing definition
+         */
+        virtual void setPacingInfo(FramePacingInfo &&pacingInfo) = 0;
+
+        /**
+         * \brief Get current frame pacing
+         * \return Current frame pacing definition
+         */
+        [[nodiscard]] virtual FramePacingInfo getPacingInfo() = 0;
+
+        /**
+         * \brief Get timings of most recently submitted frame
+         * \return Frame timings
+         */
+        [[nodiscard]] virtual FrameTiming getFrameTiming() = 0;
+
+        /**
+         * \brief Block current thread until frame is submitted
+         * \details Waiting is limited by timeout, so caller is not blocked forever if rendering is stopped.
+         * \param frameIdx Index of awaited frame
+         * \return Index of most recently submitted frame
+         */
+        [[nodiscard]] virtual std::uint64_t waitForFrame(std::uint64_t frameIdx) = 0;
+
+        /**
+         * \brief Get count of pipelines, which were not warmed up and were compiled while recording frames
+         * \details Every such pipeline causes hitch, so it should be declared by its renderer for warm-up.
+         * \return Count of pipelines
+         */
+        [[nodiscard]] virtual std::uint32_t getMidFramePipelineCount() = 0;
     };
 }
 
@@ -2,9 +2,11 @@
 #define PENROSE_RENDERING_RENDERER_HPP
 
 #include <string>
+#include <vector>
 
 #include <Penrose/Common/Params.hpp>
 #include <Penrose/Rendering/Graph/GraphInfo.hpp>
+#include <Penrose/Rendering/PipelineWarmUp.hpp>
 #include <Penrose/Rendering/RendererContext.hpp>
 
 namespace Penrose {
@@ -52,6 +54,13 @@ namespace Penrose {
          * \param params Renderer execution parameters
          */
         virtual void execute(RendererContext *context, const Params &params) = 0;
+
+        /**
+         * \brief Get pipelines used by renderer, which should be compiled before rendering is started
+         * \details Pipelines are requested after renderer is initialized.
+         * \return List of pipeline declarations
+         */
+        [[nodiscard]] virtual std::vector<PipelineWarmUpInfo> getPipelineWarmUp() const { return {}; }
     };
 }
 
@@ -3,6 +3,7 @@
 
 #include <typeindex>
 #include <typeinfo>
+#include <utility>
 
 namespace Penrose {
 
@@ -1,15 +1,18 @@
 #ifndef PENROSE_RESOURCES_RESOURCE_SET_HPP
 #define PENROSE_RESOURCES_RESOURCE_SET_HPP
 
-#include <list>
-#include <map>
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <memory>
 #include <optional>
-#include <ranges>
-#include <set>
+#include <tuple>
 #include <type_traits>
 #include <typeindex>
 #include <typeinfo>
+#include <vector>
 
 #include <Penrose/Common/EngineError.hpp>
 #include <Penrose/Resources/Resource.hpp>
@@ -18,24 +21,188 @@
 
 namespace Penrose {
 
+    /**
+     * \brief Dense identifier of resource type
+     */
+    using ResourceTypeId = std::uint32_t;
+
+    /**
+     * \brief Get dense identifier of resource type
+     * \details Identifiers are allocated sequentially on first request of type, so they could be used as indices.
+     * \param type Type index of resource type
+     * \return Identifier of resource type
+     */
+    [[nodiscard]] PENROSE_API ResourceTypeId getResourceTypeId(std::type_index type);
+
+    /**
+     * \brief Get dense identifier of resource type
+     * \details Identifier is requested only once per type, subsequent calls are reduced to read of static variable.
+     * \tparam Target Resource type
+     * \return Identifier of resource type
+     */
+    template <typename Target>
+    [[nodiscard]] ResourceTypeId getResourceTypeId() {
+        static const ResourceTypeId id = getResourceTypeId(typeid(Target));
+
+        return id;
+    }
+
     /**
      * \brief Resource set
      * \details Resource set is used as dependency container for any Resource<> inheritor and provides a single lifetime
      * for each resource instance.
      */
     class PENROSE_API ResourceSet {
+    private:
+        // instances of single type sorted by group, pointers are already adjusted to the type
+        struct TypeEntry {
+            std::vector<void *> instances;
+            std::vector<std::size_t> records;
+            std::vector<ResourceGroup> groups;
+        };
+
+        struct TypedInstance {
+            ResourceTypeId type;
+            void *instance;
+        };
+
+        struct InstanceRecord {
+            std::unique_ptr<ResourceBase> instance;
+            std::vector<ResourceTypeId> dependencies;
+            bool mainThread;
+        };
+
+        // types requested by constructor of resource are recorded as its dependencies
+        struct DependencyCapture {
+            const ResourceSet *resources;
+            std::vector<ResourceTypeId> *dependencies;
+        };
+
+        // dependencies of node split by order of addition
+        struct NodeDependencies {
+            std::vector<std::size_t> earlier;
+            std::vector<std::size_t> later;
+        };
+
     public:
+        /**
+         * \brief Node of dependency graph of resources
+         * \tparam Target Type of resources in graph
+         */
+        template <typename Target>
+        struct DependencyNode {
+
+            /**
+             * \brief Instance of resource
+             */
+            Target *instance;
+
+            /**
+             * \brief Concrete type of resource
+             */
+            std::type_index type;
+
+            /**
+             * \brief Indices of nodes, which resource depends on
+             */
+            std::vector<std::size_t> dependencies;
+
+            /**
+             * \brief Indices of nodes added later, which resource depends on
+             * \details Such dependencies contradict order of addition, so they are not included in dependencies and
+             * resources could be initialized in parallel.
+             */
+            std::vector<std::size_t> laterDependencies;
+
+            /**
+             * \brief Resource should be initialized and destroyed on main thread
+             */
+            bool mainThread;
+        };
+
         /**
          * \brief Wrapper around resource instances with lazy resolution
          * \details Internally, every proxies tries to resolve type instances from container. That's why instances of
-         * this type are not intended to be constant.
+         * this type are not intended to be constant. Resolved proxy refers to contiguous storage of instances inside
+         * container, so it is cheap to copy and resources added later are visible through it.
          * \tparam Target Type of proxied resource
          */
         template <typename Target>
         class Proxy {
         public:
-            using InstanceList = std::list<Target *>;
-            using Iterator = typename InstanceList::iterator;
+            /**
+             * \brief Iterator over contiguous storage of resolved instances
+             */
+            class Iterator {
+            public:
+                using iterator_concept = std::random_access_iterator_tag;
+                using iterator_category = std::random_access_iterator_tag;
+                using value_type = Target *;
+                using difference_type = std::ptrdiff_t;
+                using reference = Target *;
+
+                Iterator() = default;
+
+                explicit Iterator(void *const *ptr)
+                    : _ptr(ptr) {
+                    //
+                }
+
+                [[nodiscard]] Target *operator*() const { return static_cast<Target *>(*this->_ptr); }
+
+                [[nodiscard]] Target *operator[](const difference_type offset) const {
+                    return static_cast<Target *>(this->_ptr[offset]);
+                }
+
+                Iterator &operator++() {
+                    ++this->_ptr;
+
+                    return *this;
+                }
+
+                Iterator operator++(int) { return Iterator(this->_ptr++); }
+
+                Iterator &operator--() {
+                    --this->_ptr;
+
+                    return *this;
+                }
+
+                Iterator operator--(int) { return Iterator(this->_ptr--); }
+
+                Iterator &operator+=(const difference_type offset) {
+                    this->_ptr += offset;
+
+                    return *this;
+                }
+
+                Iterator &operator-=(const difference_type offset) {
+                    this->_ptr -= offset;
+
+                    return *this;
+                }
+
+                [[nodiscard]] Iterator operator+(const difference_type offset) const {
+                    return Iterator(this->_ptr + offset);
+                }
+
+                [[nodiscard]] friend Iterator operator+(const difference_type offset, const Iterator &it) {
+                    return Iterator(it._ptr + offset);
+                }
+
+                [[nodiscard]] Iterator operator-(const difference_type offset) const {
+                    return Iterator(this->_ptr - offset);
+                }
+
+                [[nodiscard]] difference_type operator-(const Iterator &other) const {
+                    return this->_ptr - other._ptr;
+                }
+
+                [[nodiscard]] auto operator<=>(const Iterator &) const = default;
+
+            private:
+                void *const *_ptr = nullptr;
+            };
 
             /**
              * \brief Create proxy in non-resolved state (instance resolve will occur on first usage)
@@ -43,17 +210,7 @@ namespace Penrose {
              */
             explicit Proxy(const ResourceSet *resources)
                 : _resources(resources),
-                  _instances(std::nullopt) {
-                //
-            }
-
-            /**
-             * \brief Create proxy in resolved state (instance resolve will not occur anymore)
-             * \param instances Collection of instances
-             */
-            explicit Proxy(InstanceList &&instances)
-                : _resources(nullptr),
-                  _instances(instances) {
+                  _type(getResourceTypeId<Target>()) {
                 //
             }
 
@@ -70,7 +227,17 @@ namespace Penrose {
             [[nodiscard]] bool isPresent() {
                 this->resolve();
 
-                return this->_instances.has_value() && !this->_instances->empty();
+                return this->_entry != nullptr && !this->_entry->instances.empty();
+            }
+
+            /**
+             * \brief Resolve instances and return count of them
+             * \return Count of resolved instances
+             */
+            [[nodiscard]] std::size_t size() {
+                this->resolve();
+
+                return this->_entry != nullptr ? this->_entry->instances.size() : 0;
             }
 
             /**
@@ -80,7 +247,7 @@ namespace Penrose {
             [[nodiscard]] Iterator begin() {
                 this->resolve();
 
-                return this->_instances->begin();
+                return Iterator(this->_entry != nullptr ? this->_entry->instances.data() : nullptr);
             }
 
             /**
@@ -90,7 +257,7 @@ namespace Penrose {
             [[nodiscard]] Iterator end() {
                 this->resolve();
 
-                return this->_instances->end();
+                return this->begin() + static_cast<std::ptrdiff_t>(this->size());
             }
 
             /**
@@ -104,7 +271,7 @@ namespace Penrose {
                     throw EngineError("No instances of type {} available", getTypeName<Target>());
                 }
 
-                return this->_instances->front();
+                return static_cast<Target *>(this->_entry->instances.front());
             }
 
             /**
@@ -115,14 +282,15 @@ namespace Penrose {
 
         private:
             const ResourceSet *_resources;
-            std::optional<std::list<Target *>> _instances;
+            ResourceTypeId _type;
+            const TypeEntry *_entry = nullptr;
 
             void resolve() {
-                if (this->_instances.has_value() || this->_resources == nullptr) {
+                if (this->_entry != nullptr || this->_resources == nullptr) {
                     return;
                 }
 
-                this->_instances = this->_resources->tryResolveAll<Target>();
+                this->_entry = this->_resources->tryGetEntry(this->_type);
             }
         };
 
@@ -135,9 +303,8 @@ namespace Penrose {
         public:
             explicit Registration(ResourceSet *resources)
                 : _resources(resources),
-                  _group(ResourceGroup::Custom),
-                  _types({typeid(Target)}) {
-                //
+                  _group(ResourceGroup::Custom) {
+                this->implements<Target>();
             }
 
             /**
@@ -153,13 +320,45 @@ namespace Penrose {
 
             /**
              * \brief Add implemented type for resource registration
+             * \details Pointer adjustment from resource to implemented type is captured here, so instances are
+             * resolved without dynamic_cast.
              * \tparam Interface Implemented type
              * \return This instance
              */
             template <typename Interface>
             requires std::is_base_of_v<Interface, Target>
             Registration &implements() {
-                this->_types.emplace(typeid(Interface));
+                const auto type = getResourceTypeId<Interface>();
+
+                if (std::ranges::find(this->_types, type, &TypeCast::type) == this->_types.end()) {
+                    this->_types.push_back(TypeCast {
+                        .type = type,
+                        .cast = [](Target *instance) -> void * { return static_cast<Interface *>(instance); },
+                    });
+                }
+
+                return *this;
+            }
+
+            /**
+             * \brief Add dependency of resource, which is not visible from proxies requested by its constructor
+             * \details Resource is initialized after all instances of dependency type and resources they depend on.
+             * \tparam Dependency Type of dependency (may be interface)
+             * \return This instance
+             */
+            template <typename Dependency>
+            Registration &dependsOn() {
+                this->_dependencies.push_back(getResourceTypeId<Dependency>());
+
+                return *this;
+            }
+
+            /**
+             * \brief Require initialization and destruction of resource on main thread
+             * \return This instance
+             */
+            Registration &mainThread() {
+                this->_mainThread = true;
 
                 return *this;
             }
@@ -169,17 +368,54 @@ namespace Penrose {
              * \return Instance of target
              */
             Target *done() {
-                auto instance = this->construct();
+                const auto previousCapture = exchangeCapture(DependencyCapture {
+                    .resources = this->_resources,
+                    .dependencies = &this->_dependencies,
+                });
+
+                Target *instance;
+
+                try {
+                    instance = this->construct();
+                } catch (...) {
+                    std::ignore = exchangeCapture(previousCapture);
+
+                    throw;
+                }
+
+                std::ignore = exchangeCapture(previousCapture);
 
-                this->_resources->insert(std::move(this->_types), this->_group, std::unique_ptr<Target>(instance));
+                auto typedInstances = std::vector<TypedInstance>();
+
+                typedInstances.reserve(this->_types.size());
+
+                for (const auto &[type, cast]: this->_types) {
+                    typedInstances.push_back(TypedInstance {.type = type, .instance = cast(instance)});
+                }
+
+                this->_resources->insert(
+                    std::move(typedInstances), this->_group,
+                    InstanceRecord {
+                        .instance = std::unique_ptr<Target>(instance),
+                        .dependencies = std::move(this->_dependencies),
+                        .mainThread = this->_mainThread,
+                    }
+                );
 
                 return instance;
             }
 
         private:
+            struct TypeCast {
+                ResourceTypeId type;
+                void *(*cast)(Target *);
+            };
+
             ResourceSet *_resources;
             ResourceGroup _group;
-            std::set<std::type_index> _types;
+            std::vector<TypeCast> _types;
+            std::vector<ResourceTypeId> _dependencies;
+            bool _mainThread = false;
 
             [[nodiscard]] constexpr Target *construct() const {
                 if constexpr (std::is_constructible_v<Target, const ResourceSet *>) {
@@ -204,6 +440,8 @@ namespace Penrose {
          */
         template <typename Target>
         [[nodiscard]] Proxy<Target> get() const {
+            this->recordDependency(getResourceTypeId<Target>());
+
             return Proxy<Target>(this);
         }
 
@@ -216,22 +454,36 @@ namespace Penrose {
         template <typename Target>
         [[nodiscard]] std::optional<Target *> tryResolveOne(std::optional<std::type_index> &&type = std::nullopt)
             const noexcept {
-            const auto targetType = type.value_or(typeid(Target));
-            const auto map = this->tryResolveByType(targetType);
+            const auto targetEntry = this->tryGetEntry(getResourceTypeId<Target>());
 
-            if (!map.has_value() || (*map)->empty()) {
-                return std::nullopt;
+            this->recordDependency(getResourceTypeId<Target>());
+
+            if (!type.has_value()) {
+                if (targetEntry == nullptr || targetEntry->instances.empty()) {
+                    return std::nullopt;
+                }
+
+                return static_cast<Target *>(targetEntry->instances.front());
             }
 
-            const auto &list = (*map)->begin()->second;
+            const auto concreteEntry = this->tryGetEntry(getResourceTypeId(*type));
 
-            if (list.empty()) {
+            if (concreteEntry == nullptr || concreteEntry->records.empty()) {
                 return std::nullopt;
             }
 
-            const auto it = list.begin();
+            const auto record = concreteEntry->records.front();
+
+            // concrete type is known only at runtime, so instance is found among instances of target type
+            if (targetEntry != nullptr) {
+                const auto it = std::ranges::find(targetEntry->records, record);
+
+                if (it != targetEntry->records.end()) {
+                    return static_cast<Target *>(targetEntry->instances.at(it - targetEntry->records.begin()));
+                }
+            }
 
-            return dynamic_cast<Target *>((*it)->get());
+            return dynamic_cast<Target *>(this->_instances.at(record).instance.get());
         }
 
         /**
@@ -244,7 +496,7 @@ namespace Penrose {
         [[nodiscard]] Target *resolveOne(std::optional<std::type_index> &&type = std::nullopt) const {
             auto instance = this->tryResolveOne<Target>(std::forward<decltype(type)>(type));
 
-            if (!instance.has_value()) {
+            if (!instance.has_value() || *instance == nullptr) {
                 throw EngineError("No instances of type {} available", getTypeName<Target>());
             }
 
@@ -257,24 +509,62 @@ namespace Penrose {
          * \return Collection of instances of target type
          */
         template <typename Target>
-        [[nodiscard]] std::list<Target *> tryResolveAll() const noexcept {
-            const auto map = this->tryResolveByType(typeid(Target));
+        [[nodiscard]] std::vector<Target *> tryResolveAll() const noexcept {
+            const auto entry = this->tryGetEntry(getResourceTypeId<Target>());
+
+            this->recordDependency(getResourceTypeId<Target>());
 
-            if (!map.has_value()) {
+            if (entry == nullptr) {
                 return {};
             }
 
-            std::list<Target *> instances;
+            auto instances = std::vector<Target *>();
+            instances.reserve(entry->instances.size());
 
-            for (const auto &list: **map | std::views::values) {
-                for (const auto &ptr: list) {
-                    instances.push_back(dynamic_cast<Target *>(ptr->get()));
-                }
+            for (const auto instance: entry->instances) {
+                instances.push_back(static_cast<Target *>(instance));
             }
 
             return instances;
         }
 
+        /**
+         * \brief Build dependency graph of all instances of target type
+         * \details Resource depends on types requested by its constructor and on types added by
+         * Registration::dependsOn, directly or through other resources. Nodes are ordered by group and order of
+         * addition, dependencies on later nodes are omitted, so order of nodes is always a valid order of
+         * initialization.
+         * \tparam Target Target type (may be interface)
+         * \return Nodes of graph
+         */
+        template <typename Target>
+        [[nodiscard]] std::vector<DependencyNode<Target>> getDependencyGraph() const {
+            const auto entry = this->tryGetEntry(getResourceTypeId<Target>());
+
+            if (entry == nullptr) {
+                return {};
+            }
+
+            auto dependencies = this->getDependencies(entry->records);
+            auto nodes = std::vector<DependencyNode<Target>>();
+
+            nodes.reserve(entry->instances.size());
+
+            for (std::size_t nodeIdx = 0; nodeIdx < entry->instances.size(); nodeIdx++) {
+                const auto &record = this->_instances.at(entry->records.at(nodeIdx));
+
+                nodes.push_back(DependencyNode<Target> {
+                    .instance = static_cast<Target *>(entry->instances.at(nodeIdx)),
+                    .type = record.instance->getType(),
+                    .dependencies = std::move(dependencies.at(nodeIdx).earlier),
+                    .laterDependencies = std::move(dependencies.at(nodeIdx).later),
+                    .mainThread = record.mainThread,
+                });
+            }
+
+            return nodes;
+        }
+
         /**
          * \brief Begin addition of resource in dependency container
          * \tparam Target Type of resource
@@ -286,17 +576,22 @@ namespace Penrose {
         }
 
     private:
-        using InstanceList = std::list<std::unique_ptr<ResourceBase>>;
-        using GroupMap = std::map<ResourceGroup, std::list<InstanceList::iterator>>;
+        std::vector<InstanceRecord> _instances;
 
-        InstanceList _instances;
-        std::map<std::type_index, GroupMap> _typeMap;
+        // entries are indexed by resource type identifier, they are allocated separately to keep proxies valid
+        std::vector<std::unique_ptr<TypeEntry>> _entries;
 
-        void insert(
-            std::set<std::type_index> &&types, ResourceGroup group, std::unique_ptr<ResourceBase> &&instance
-        ) noexcept;
+        void insert(std::vector<TypedInstance> &&typedInstances, ResourceGroup group, InstanceRecord &&record) noexcept;
 
-        [[nodiscard]] std::optional<const GroupMap *> tryResolveByType(std::type_index type) const noexcept;
+        [[nodiscard]] static DependencyCapture exchangeCapture(DependencyCapture capture) noexcept;
+
+        void recordDependency(ResourceTypeId type) const noexcept;
+
+        [[nodiscard]] std::vector<NodeDependencies> getDependencies(const std::vector<std::size_t> &records) const;
+
+        [[nodiscard]] const TypeEntry *tryGetEntry(ResourceTypeId type) const noexcept {
+            return type < this->_entries.size() ? this->_entries[type].get() : nullptr;
+        }
     };
 
     //! \copydoc ResourceSet::Proxy
@@ -0,0 +1,22 @@
+#ifndef PENROSE_UI_BINARY_LAYOUT_HPP
+#define PENROSE_UI_BINARY_LAYOUT_HPP
+
+#include <ostream>
+#include <vector>
+
+#include <Penrose/Api.hpp>
+#include <Penrose/UI/Layout.hpp>
+
+namespace Penrose {
+
+    // binary layout keeps widgets in pre-order with their properties already parsed, strings are stored once in
+    // string table and are referenced by index
+
+    [[nodiscard]] PENROSE_API std::vector<unsigned char> writeBinaryLayout(const Widget *root);
+
+    PENROSE_API void writeBinaryLayoutAsset(const Widget *root, std::ostream &stream);
+
+    [[nodiscard]] PENROSE_API Layout *readBinaryLayout(const std::vector<unsigned char> &content);
+}
+
+#endif // PENROSE_UI_BINARY_LAYOUT_HPP
@@ -0,0 +1,141 @@
+#ifndef PENROSE_UI_COMPILED_LAYOUT_HPP
+#define PENROSE_UI_COMPILED_LAYOUT_HPP
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <Penrose/UI/Value.hpp>
+#include <Penrose/UI/ValuePath.hpp>
+#include <Penrose/UI/Widgets/Widget.hpp>
+
+namespace Penrose {
+
+    // kind of value, which is expected in property slot
+    enum class SlotKind : std::uint8_t {
+        None,
+        Boolean,
+        Integer,
+        Float,
+        String,
+        Action,
+        Object,
+        ObjectList,
+        StringList
+    };
+
+    // slots of properties, which are common for every widget
+    inline constexpr std::uint32_t SLOT_VISIBLE = 0;
+    inline constexpr std::uint32_t SLOT_ENABLED = 1;
+
+    // slots of widget properties, their meaning depends on widget type
+    inline constexpr std::uint32_t SLOT_TITLE = 2;
+    inline constexpr std::uint32_t SLOT_TEXT = 2;
+    inline constexpr std::uint32_t SLOT_CONTEXT = 2;
+    inline constexpr std::uint32_t SLOT_ITEMS = 2;
+    inline constexpr std::uint32_t SLOT_WINDOW_CONTEXT = 3;
+    inline constexpr std::uint32_t SLOT_WINDOW_OPENED = 4;
+    inline constexpr std::uint32_t SLOT_ACTION = 3;
+    inline constexpr std::uint32_t SLOT_CHECKED = 3;
+    inline constexpr std::uint32_t SLOT_SELECTION = 3;
+    inline constexpr std::uint32_t SLOT_MENU_ENTRY_ACTION = 4;
+    inline constexpr std::uint32_t SLOT_LIST_VIRTUALIZED = 4;
+
+    inline constexpr std::uint32_t NO_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+    struct LayoutSlot {
+        SlotKind kind;
+
+        // scope of frame, which object is used to resolve binding
+        std::uint32_t scope;
+
+        // scope, which is opened by object of this slot
+        std::uint32_t openedScope;
+
+        // value of constant property, owned by compiled layout
+        Value *constant;
+
+        ValuePath binding;
+    };
+
+    struct LayoutInstruction {
+        WidgetType type;
+
+        // index of instruction next to last descendant of widget
+        std::uint32_t end;
+
+        // index of first slot of widget in its frame
+        std::uint32_t slot;
+
+        // index of item template frame of list widget
+        std::uint32_t frame;
+
+        // index of list widget in its frame
+        std::uint32_t list;
+
+        // ImGui-style identifier of widget, unique within layout
+        std::string tag;
+    };
+
+    // frame is a set of slots resolved against same root object: whole layout or item of list
+    struct LayoutFrame {
+        std::uint32_t begin;
+        std::uint32_t end;
+
+        std::vector<LayoutSlot> slots;
+        std::uint32_t scopeCount;
+        std::uint32_t listCount;
+    };
+
+    class PENROSE_API CompiledLayout {
+    public:
+        static constexpr std::uint32_t ROOT_FRAME = 0;
+
+        CompiledLayout() = default;
+
+        // slots point into constants, which keep their addresses when layout is moved, but not when it is copied
+        CompiledLayout(CompiledLayout &&) = default;
+        CompiledLayout &operator=(CompiledLayout &&) = default;
+
+        CompiledLayout(const CompiledLayout &) = delete;
+        CompiledLayout &operator=(const CompiledLayout &) = delete;
+
+        [[nodiscard]] static CompiledLayout compile(const Widget *root);
+
+        [[nodiscard]] const std::vector<LayoutInstruction> &getInstructions() const { return this->_instructions; }
+
+        [[nodiscard]] const std::vector<LayoutFrame> &getFrames() const { return this->_frames; }
+
+    private:
+        // constant values are allocated in blocks and are never moved, so slots could point into them
+        struct ConstantArena {
+            std::deque<BooleanValue> booleans;
+            std::deque<IntegerValue> integers;
+            std::deque<FloatValue> floats;
+            std::deque<StringValue> strings;
+        };
+
+        std::vector<LayoutInstruction> _instructions;
+        std::vector<LayoutFrame> _frames;
+        ConstantArena _constants;
+
+        void compileWidget(const Widget *widget, std::uint32_t frameIdx, std::uint32_t scope);
+        void compileChildren(const WidgetList &children, std::uint32_t frameIdx, std::uint32_t scope);
+
+        std::uint32_t addFrame();
+
+        template <ValueType Type, typename T>
+        void addSlot(std::uint32_t frameIdx, std::uint32_t scope, const StrongTypedProperty<Type, T> *property);
+
+        template <ValueType Type>
+        void addSlot(
+            std::uint32_t frameIdx, std::uint32_t scope, const BindableProperty<Type> *property, SlotKind kind
+        );
+
+        std::uint32_t openScope(std::uint32_t frameIdx);
+    };
+}
+
+#endif // PENROSE_UI_COMPILED_LAYOUT_HPP
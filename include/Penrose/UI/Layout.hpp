@@ -3,6 +3,7 @@
 
 #include <memory>
 
+#include <Penrose/UI/CompiledLayout.hpp>
 #include <Penrose/UI/Widgets/Widget.hpp>
 
 namespace Penrose {
@@ -13,8 +14,11 @@ namespace Penrose {
 
         [[nodiscard]] const Widget *getRoot() const { return this->_root.get(); }
 
+        [[nodiscard]] const CompiledLayout &getCompiled() const { return this->_compiled; }
+
     private:
         std::unique_ptr<Widget> _root;
+        CompiledLayout _compiled;
     };
 }
 
@@ -0,0 +1,88 @@
+#ifndef PENROSE_UI_LAYOUT_BINDING_HPP
+#define PENROSE_UI_LAYOUT_BINDING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <Penrose/UI/CompiledLayout.hpp>
+#include <Penrose/UI/Value.hpp>
+#include <Penrose/UI/ValuePath.hpp>
+
+namespace Penrose {
+
+    struct ListBinding;
+
+    // copy of slot value kept by widget between frames, it is refreshed only when version of value is changed
+    struct SlotCache {
+        std::uint64_t version = 0;
+        std::string text;
+    };
+
+    // resolved values of frame slots, indexed same as LayoutFrame::slots
+    struct FrameBinding {
+
+        // context and intermediate objects of bound paths, parents go before their children
+        std::vector<ObjectStamp> stamps;
+
+        std::vector<Value *> values;
+        std::vector<SlotCache> caches;
+        std::vector<std::shared_ptr<Value>> owners;
+        std::vector<ListBinding> lists;
+    };
+
+    struct ListBinding {
+        std::vector<std::shared_ptr<ObjectValue>> items;
+        std::vector<FrameBinding> frames;
+    };
+
+    // values of compiled layout slots, resolved once per value context instead of every frame
+    class PENROSE_API LayoutBinding {
+    public:
+        LayoutBinding(const CompiledLayout *layout, const ObjectValue *context);
+
+        [[nodiscard]] const CompiledLayout *getLayout() const { return this->_layout; }
+
+        [[nodiscard]] FrameBinding &getRoot();
+
+        [[nodiscard]] FrameBinding &getItem(
+            FrameBinding &parent, const LayoutInstruction &list, std::size_t idx,
+            const std::shared_ptr<ObjectValue> &item
+        );
+
+        // releases bindings of rows, which are past the end of list
+        void trimItems(FrameBinding &parent, const LayoutInstruction &list, std::size_t count);
+
+        void invalidate();
+
+        template <typename V>
+        requires std::is_base_of_v<Value, V>
+        [[nodiscard]] static V *get(
+            const FrameBinding &binding, const LayoutInstruction &instruction, const std::uint32_t slot
+        ) {
+            return static_cast<V *>(binding.values[instruction.slot + slot]);
+        }
+
+        [[nodiscard]] static SlotCache &getCache(
+            FrameBinding &binding, const LayoutInstruction &instruction, const std::uint32_t slot
+        ) {
+            return binding.caches[instruction.slot + slot];
+        }
+
+    private:
+        const CompiledLayout *_layout;
+        const ObjectValue *_context;
+
+        FrameBinding _root;
+        bool _bound = false;
+
+        [[nodiscard]] static bool isStale(const FrameBinding &binding);
+
+        void bind(FrameBinding &binding, const LayoutFrame &frame, const ObjectValue *context) const;
+    };
+}
+
+#endif // PENROSE_UI_LAYOUT_BINDING_HPP
@@ -1,11 +1,14 @@
 #ifndef PENROSE_UI_VALUE_HPP
 #define PENROSE_UI_VALUE_HPP
 
+#include <cstdint>
 #include <functional>
-#include <map>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include <Penrose/UI/ValueType.hpp>
@@ -25,6 +28,8 @@ namespace Penrose {
         [[nodiscard]] virtual ValueType getType() const = 0;
     };
 
+    // stored values track their changes with version, which is increased on every change of value, so widgets could
+    // skip work for unchanged values; computed values are re-evaluated and compared on every access instead
     template <ValueType Type, typename T>
     class PENROSE_API StrongTypedValue final: public Value {
     public:
@@ -32,22 +37,15 @@ namespace Penrose {
         using Setter = std::function<void(T)>;
 
         explicit StrongTypedValue(T value, bool constant = false)
-            : _value({constant, value}),
-              _getter([this]() { return this->_value->value; }),
-              _setter([this](T value) {
-                  if (this->_value->constant) {
-                      return;
-                  }
-
-                  this->_value->value = value;
-              }) {
+            : _value(std::move(value)),
+              _constant(constant) {
             //
         }
 
         StrongTypedValue(Getter &&getter, Setter &&setter)
-            : _value(std::nullopt),
-              _getter(getter),
-              _setter(setter) {
+            : _value(),
+              _getter(std::forward<decltype(getter)>(getter)),
+              _setter(std::forward<decltype(setter)>(setter)) {
             //
         }
 
@@ -55,19 +53,61 @@ namespace Penrose {
 
         [[nodiscard]] ValueType getType() const override { return Type; }
 
-        [[nodiscard]] T getValue() { return this->_getter(); }
+        [[nodiscard]] const T &getValue() {
+            this->refresh();
 
-        void setValue(T value) { return this->_setter(value); }
+            return this->_value;
+        }
+
+        void setValue(T value) {
+            if (this->_getter) {
+                if (this->_setter) {
+                    this->_setter(std::move(value));
+                }
+
+                this->refresh();
+
+                return;
+            }
+
+            if (this->_constant || this->_value == value) {
+                return;
+            }
+
+            this->_value = std::move(value);
+            this->_version++;
+        }
+
+        [[nodiscard]] std::uint64_t getVersion() {
+            this->refresh();
+
+            return this->_version;
+        }
+
+        [[nodiscard]] bool isConstant() const { return this->_constant; }
 
     private:
-        struct InnerValue {
-            bool constant;
-            T value;
-        };
+        T _value;
+        bool _constant = false;
+        std::uint64_t _version = 1;
 
-        std::optional<InnerValue> _value;
         Getter _getter;
         Setter _setter;
+
+        void refresh() {
+            if (!this->_getter) {
+                return;
+            }
+
+            auto value = this->_getter();
+
+            if (this->_value == value) {
+                return;
+            }
+
+            this->_value = std::move(value);
+            this->_version++;
+        }
     };
 
     using BooleanValue = StrongTypedValue<ValueType::Boolean, bool>;
@@ -91,12 +131,42 @@ namespace Penrose {
         Delegate _delegate;
     };
 
+    // interned name of object property, keys of same name share same storage and are compared by pointer
+    class PENROSE_API ValueKey {
+    public:
+        explicit ValueKey(std::string_view name);
+
+        [[nodiscard]] std::string_view getName() const;
+
+        [[nodiscard]] std::size_t getHash() const;
+
+        [[nodiscard]] bool operator==(const ValueKey &other) const { return this->_key == other._key; }
+
+    private:
+        struct Interned;
+
+        const Interned *_key;
+
+        [[nodiscard]] static const Interned *intern(std::string_view name);
+    };
+
     class PENROSE_API ObjectValue final: public Value {
     public:
-        using Container = std::map<std::string, std::shared_ptr<Value>>;
+        struct Property {
+            ValueKey key;
+            std::shared_ptr<Value> value;
+        };
+
+        using Container = std::vector<std::pair<std::string, std::shared_ptr<Value>>>;
 
         explicit ObjectValue(Container &&properties = {});
 
+        // copy is a different object, so it gets its own stamp
+        ObjectValue(const ObjectValue &other);
+        ObjectValue(ObjectValue &&other) noexcept;
+        ObjectValue &operator=(const ObjectValue &other);
+        ObjectValue &operator=(ObjectValue &&other) noexcept;
+
         ~ObjectValue() override = default;
 
         [[nodiscard]] ValueType getType() const override { return ValueType::Object; }
@@ -114,14 +184,36 @@ namespace Penrose {
 
         [[nodiscard]] ObjectValue &property(std::string_view &&name, std::shared_ptr<Value> &&value);
 
+        bool removeProperty(std::string_view name);
+
         [[nodiscard]] std::optional<std::shared_ptr<Value>> tryGetProperty(const std::string_view &name) const;
 
+        [[nodiscard]] std::optional<std::shared_ptr<Value>> tryGetProperty(const ValueKey &key) const;
+
         [[nodiscard]] std::shared_ptr<Value> getPropertyByPath(const std::string_view &path) const;
 
-        [[nodiscard]] const Container &getProperties() const { return this->_properties; }
+        [[nodiscard]] const std::vector<Property> &getProperties() const { return this->_properties; }
+
+        // stamp is unique per object and is changed on every structural change, so lookups could be cached with it
+        [[nodiscard]] std::uint64_t getStamp() const { return this->_stamp; }
 
     private:
-        Container _properties;
+        friend class ValuePath;
+
+        static constexpr std::uint32_t NO_PROPERTY = std::numeric_limits<std::uint32_t>::max();
+
+        std::vector<Property> _properties;
+
+        // open addressing table of indices into properties, its size is power of two
+        std::vector<std::uint32_t> _table;
+
+        std::uint64_t _stamp;
+
+        [[nodiscard]] std::uint32_t find(std::string_view name) const;
+        [[nodiscard]] std::uint32_t find(const ValueKey &key) const;
+
+        void set(ValueKey key, std::shared_ptr<Value> &&value);
+        void rebuildTable(std::size_t size);
     };
 
     template <typename Item>
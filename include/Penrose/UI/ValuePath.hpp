@@ -0,0 +1,49 @@
+#ifndef PENROSE_UI_VALUE_PATH_HPP
+#define PENROSE_UI_VALUE_PATH_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <Penrose/UI/Value.hpp>
+
+namespace Penrose {
+
+    // object visited by path resolution with its stamp at that moment
+    struct ObjectStamp {
+        const ObjectValue *object;
+        std::uint64_t stamp;
+    };
+
+    // dotted path of property, which is split and interned once; every segment remembers where its property was
+    // found, so repeated resolution against unchanged objects does no lookups
+    class PENROSE_API ValuePath {
+    public:
+        ValuePath() = default;
+        explicit ValuePath(std::string_view path);
+
+        [[nodiscard]] const std::string &getPath() const { return this->_path; }
+
+        [[nodiscard]] bool isEmpty() const { return this->_segments.empty(); }
+
+        // cache of segments is not synchronized, so path should be resolved by one thread at a time. Objects along
+        // the path, which are not yet in visited, are appended to it in order of traversal.
+        [[nodiscard]] std::shared_ptr<Value> resolve(
+            const ObjectValue *root, std::vector<ObjectStamp> *visited = nullptr
+        ) const;
+
+    private:
+        struct Segment {
+            ValueKey key;
+            mutable std::uint64_t stamp;
+            mutable std::uint32_t property;
+        };
+
+        std::string _path;
+        std::vector<Segment> _segments;
+    };
+}
+
+#endif // PENROSE_UI_VALUE_PATH_HPP
@@ -13,6 +13,7 @@ namespace Penrose {
             WidgetInstance itemTemplate;
             ListProperty items;
             IntegerProperty selection;
+            BooleanProperty virtualized;
         };
 
         explicit List(Args &&args)
@@ -22,7 +23,8 @@ namespace Penrose {
               ),
               _itemTemplate(std::forward<decltype(args.itemTemplate)>(args.itemTemplate)),
               _items(std::forward<decltype(args.items)>(args.items)),
-              _selection(std::forward<decltype(args.selection)>(args.selection)) {
+              _selection(std::forward<decltype(args.selection)>(args.selection)),
+              _virtualized(std::forward<decltype(args.virtualized)>(args.virtualized)) {
             //
         }
 
@@ -36,10 +38,13 @@ namespace Penrose {
 
         [[nodiscard]] const IntegerProperty &getSelection() const { return this->_selection; }
 
+        [[nodiscard]] const BooleanProperty &getVirtualized() const { return this->_virtualized; }
+
     private:
         WidgetInstance _itemTemplate;
         ListProperty _items;
         IntegerProperty _selection;
+        BooleanProperty _virtualized;
     };
 }
 
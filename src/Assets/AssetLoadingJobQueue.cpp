@@ -1,5 +1,9 @@
 #include "AssetLoadingJobQueue.hpp"
 
+#include <chrono>
+
+#include <Penrose/Performance/MemoryTracker.hpp>
+
 namespace Penrose {
 
     inline static constexpr std::string_view TAG = "AssetLoadingJobQueue";
@@ -7,17 +11,25 @@ namespace Penrose {
     AssetLoadingJobQueue::AssetLoadingJobQueue(const ResourceSet *resources)
         : _log(resources->get<Log>()),
           _assetIndex(resources->get<AssetIndex>()),
-          _assetLoadingProxy(resources->get<AssetLoadingProxy>()) {
+          _assetLoadingProxy(resources->get<AssetLoadingProxy>()),
+          _profiler(resources->get<Profiler>()),
+          _metrics(resources->get<MetricsRegistry>()),
+          _queueDepthMetric(this->_metrics->gauge("assets.queue.depth")),
+          _loadLatencyMetric(this->_metrics->histogram("assets.load.latency_ms")) {
         //
     }
 
     void AssetLoadingJobQueue::init() {
+        this->_loadTag = this->_profiler->intern("Asset Loading");
+
+        this->_jobQueue.enqueue([this] { this->_profiler->setThreadName("Asset Loading"); }, {.order = -1});
         this->_jobQueue.start();
     }
 
     void AssetLoadingJobQueue::destroy() {
         this->_jobQueue.stop();
         this->_jobQueue.clear();
+        this->_queueDepthMetric->set(0);
     }
 
     void AssetLoadingJobQueue::enqueue(std::string_view &&asset) {
@@ -36,7 +48,14 @@ namespace Penrose {
 
         this->_assetIndex->markLoading(std::string_view(asset));
 
-        this->_jobQueue.enqueue([this, asset = std::string(asset), path = (maybeIndexEntry->path)] {
+        this->_queueDepthMetric->add(1);
+
+        const auto enqueuedAt = std::chrono::steady_clock::now();
+
+        this->_jobQueue.enqueue([this, asset = std::string(asset), path = (maybeIndexEntry->path), enqueuedAt] {
+            auto scope = this->_profiler->begin(this->_loadTag);
+            const auto memoryScope = MemoryTagScope(MemoryTag::Assets);
+
             this->_log->writeDebug(TAG, "Loading asset {}", asset);
 
             try {
@@ -48,6 +67,12 @@ namespace Penrose {
                 this->_assetIndex->markFailed(asset);
                 this->_log->writeError(TAG, "Failed to load asset {}: {}", asset, error.what());
             }
+
+            // latency includes time spent in queue, because that is what waiting side observes
+            this->_queueDepthMetric->add(-1);
+            this->_loadLatencyMetric->record(
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - enqueuedAt).count()
+            );
         });
     }
 }
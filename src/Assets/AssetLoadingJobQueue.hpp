@@ -2,6 +2,8 @@
 #define PENROSE_ASSETS_ASSET_LOADING_JOB_QUEUE_HPP
 
 #include <Penrose/Common/Log.hpp>
+#include <Penrose/Performance/MetricsRegistry.hpp>
+#include <Penrose/Performance/Profiler.hpp>
 #include <Penrose/Resources/Initializable.hpp>
 #include <Penrose/Resources/Resource.hpp>
 #include <Penrose/Resources/ResourceSet.hpp>
@@ -27,8 +29,14 @@ namespace Penrose {
         ResourceProxy<Log> _log;
         ResourceProxy<AssetIndex> _assetIndex;
         ResourceProxy<AssetLoadingProxy> _assetLoadingProxy;
+        ResourceProxy<Profiler> _profiler;
+        ResourceProxy<MetricsRegistry> _metrics;
+
+        MetricGauge *_queueDepthMetric;
+        MetricHistogram *_loadLatencyMetric;
 
         JobQueue _jobQueue;
+        Profiler::TagId _loadTag = 0;
     };
 }
 
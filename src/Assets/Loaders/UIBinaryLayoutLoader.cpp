@@ -0,0 +1,20 @@
+#include "UIBinaryLayoutLoader.hpp"
+
+#include <Penrose/Assets/UILayoutAsset.hpp>
+#include <Penrose/UI/BinaryLayout.hpp>
+
+#include "src/Assets/Structs.hpp"
+
+namespace Penrose {
+
+    Asset *UIBinaryLayoutLoader::fromReader(AssetReader &reader) {
+        const auto [size] = reader.read<UIBinaryLayoutInfo>();
+
+        auto rawData = std::vector<unsigned char>(size);
+        reader.read(size, rawData.data());
+
+        const auto layout = readBinaryLayout(rawData);
+
+        return new UILayoutAsset(std::shared_ptr<Layout>(layout));
+    }
+}
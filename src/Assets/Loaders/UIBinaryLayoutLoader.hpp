@@ -0,0 +1,21 @@
+#ifndef PENROSE_ASSETS_LOADERS_UI_BINARY_LAYOUT_LOADER_HPP
+#define PENROSE_ASSETS_LOADERS_UI_BINARY_LAYOUT_LOADER_HPP
+
+#include <Penrose/Resources/Resource.hpp>
+
+#include "src/Assets/Loaders/TypedAssetLoader.hpp"
+
+namespace Penrose {
+
+    class UIBinaryLayoutLoader final: public Resource<UIBinaryLayoutLoader>,
+                                      public TypedAssetLoader {
+    public:
+        ~UIBinaryLayoutLoader() override = default;
+
+        [[nodiscard]] AssetType getAssetType() const override { return AssetType::UIBinaryLayout; }
+
+        [[nodiscard]] Asset *fromReader(AssetReader &reader) override;
+    };
+}
+
+#endif // PENROSE_ASSETS_LOADERS_UI_BINARY_LAYOUT_LOADER_HPP
@@ -45,6 +45,10 @@ namespace Penrose {
         std::uint32_t size;
     };
 
+    struct UIBinaryLayoutInfo {
+        std::uint32_t size;
+    };
+
 #pragma pack(pop)
 }
 
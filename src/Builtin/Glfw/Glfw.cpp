@@ -11,6 +11,7 @@ namespace Penrose {
                 .implements<VkInstanceExtensionsProvider>()
                 .implements<Initializable>()
                 .implements<Updatable>()
+                .mainThread()
                 .done();
 
         resources.add<GlfwSurfaceController>().group(ResourceGroup::Windowing)
@@ -8,6 +8,11 @@
 
 namespace Penrose {
 
+    GlfwBackend::GlfwBackend(const ResourceSet *resources)
+        : _inputHandler(resources->get<InputHandler>()) {
+        //
+    }
+
     void GlfwBackend::init() {
         if (glfwInit() != GLFW_TRUE) {
             throw EngineError("Failed to initialize GLFW backend");
@@ -20,6 +25,9 @@ namespace Penrose {
 
     void GlfwBackend::update(float) {
         glfwPollEvents();
+
+        // mouse samples of whole poll are coalesced, so they are fired once per frame
+        this->_inputHandler->flushEvents();
     }
 
     std::vector<std::string_view> GlfwBackend::getRequiredInstanceExtensions() const {
@@ -3,21 +3,22 @@
 
 #include <vector>
 
+#include <Penrose/Input/InputHandler.hpp>
 #include <Penrose/Resources/Initializable.hpp>
 #include <Penrose/Resources/Resource.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
 #include <Penrose/Resources/Updatable.hpp>
 
 #include <Penrose/Builtin/Vulkan/VkInstanceExtensionsProvider.hpp>
 
 namespace Penrose {
 
-    class ResourceSet;
-
     class GlfwBackend : public Resource<GlfwBackend>,
                         public Initializable,
                         public Updatable,
                         public VkInstanceExtensionsProvider {
     public:
+        explicit GlfwBackend(const ResourceSet *resources);
         ~GlfwBackend() override = default;
 
         void init() override;
@@ -26,6 +27,9 @@ namespace Penrose {
         void update(float) override;
 
         [[nodiscard]] std::vector<std::string_view> getRequiredInstanceExtensions() const override;
+
+    private:
+        ResourceProxy<InputHandler> _inputHandler;
     };
 }
 
@@ -97,7 +97,7 @@ namespace Penrose {
         auto inputKey = fromGlfwKeyboardKey(key);
         auto inputState = fromGlfwAction(action);
 
-        that->_inputHandler->pushKeyStateUpdate(inputKey, inputState);
+        that->_inputHandler->pushKeyStateUpdate(inputKey, inputState, InputClock::now());
     }
 
     void GlfwSurfaceController::mouseButtonCallback(GLFWwindow *handle, int button, int action, int) {
@@ -106,10 +106,11 @@ namespace Penrose {
         auto inputKey = fromGlfwMouseButton(button);
         auto inputState = fromGlfwAction(action);
 
-        that->_inputHandler->pushKeyStateUpdate(inputKey, inputState);
+        that->_inputHandler->pushKeyStateUpdate(inputKey, inputState, InputClock::now());
     }
 
     void GlfwSurfaceController::cursorPosCallback(GLFWwindow *handle, double x, double y) {
+        const auto timestamp = InputClock::now();
         auto that = reinterpret_cast<GlfwSurfaceController *>(glfwGetWindowUserPointer(handle));
 
         int w, h;
@@ -118,7 +119,7 @@ namespace Penrose {
         auto ndcX = static_cast<float>(x) / (static_cast<float>(w) / 2) - 1;
         auto ndcY = 1 - static_cast<float>(y) / (static_cast<float>(h) / 2);
 
-        that->_inputHandler->pushMouseMove(ndcX, ndcY);
+        that->_inputHandler->pushMouseMove(ndcX, ndcY, timestamp);
 
         if (glfwGetInputMode(handle, GLFW_CURSOR) != GLFW_CURSOR_DISABLED) {
             return;
@@ -130,6 +131,6 @@ namespace Penrose {
     void GlfwSurfaceController::scrollCallback(GLFWwindow *handle, double dx, double dy) {
         auto that = reinterpret_cast<GlfwSurfaceController *>(glfwGetWindowUserPointer(handle));
 
-        that->_inputHandler->pushScroll(static_cast<float>(dx), static_cast<float>(dy));
+        that->_inputHandler->pushScroll(static_cast<float>(dx), static_cast<float>(dy), InputClock::now());
     }
 }
@@ -0,0 +1,32 @@
+#include <Penrose/Builtin/Headless.hpp>
+
+#include "src/Builtin/Headless/Rendering/HeadlessSurfaceController.hpp"
+#include "src/Builtin/Headless/Rendering/PngFrameCaptureWriter.hpp"
+
+namespace Penrose {
+
+    ResourceSet &addHeadless(ResourceSet &resources, const HeadlessInfo &info) {
+
+        auto controller = resources.add<HeadlessSurfaceController>()
+                              .group(ResourceGroup::Windowing)
+                              .implements<SurfaceFactory>()
+                              .implements<SurfaceHook>()
+                              .implements<VkSurfaceProvider>()
+                              .implements<VkInstanceExtensionsProvider>()
+                              .done();
+
+        controller->setInfo(info);
+
+        if (info.captureDirectory.has_value()) {
+            auto writer = resources.add<PngFrameCaptureWriter>()
+                              .group(ResourceGroup::Rendering)
+                              .implements<FrameCaptureHandler>()
+                              .implements<Initializable>()
+                              .done();
+
+            writer->setDirectory(*info.captureDirectory);
+        }
+
+        return resources;
+    }
+}
@@ -0,0 +1,24 @@
+#include "HeadlessSurface.hpp"
+
+#include "src/Builtin/Headless/Rendering/HeadlessSurfaceController.hpp"
+
+namespace Penrose {
+
+    HeadlessSurface::HeadlessSurface(
+        HeadlessSurfaceController *controller, const Size size, const std::uint32_t imageCount
+    )
+        : _controller(controller),
+          _size(size),
+          _imageCount(imageCount) {
+        //
+    }
+
+    void HeadlessSurface::setSize(const Size &size) {
+        if (this->_size == size) {
+            return;
+        }
+
+        this->_size = size;
+        this->_controller->onSurfaceResized(size);
+    }
+}
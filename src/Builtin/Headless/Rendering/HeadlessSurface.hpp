@@ -0,0 +1,38 @@
+#ifndef PENROSE_BUILTIN_HEADLESS_RENDERING_HEADLESS_SURFACE_HPP
+#define PENROSE_BUILTIN_HEADLESS_RENDERING_HEADLESS_SURFACE_HPP
+
+#include <cstdint>
+
+#include <Penrose/Rendering/OffscreenSurface.hpp>
+
+namespace Penrose {
+
+    class HeadlessSurfaceController;
+
+    class HeadlessSurface : public OffscreenSurface {
+    public:
+        HeadlessSurface(HeadlessSurfaceController *controller, Size size, std::uint32_t imageCount);
+        ~HeadlessSurface() override = default;
+
+        [[nodiscard]] Size getSize() const override { return this->_size; }
+
+        void setSize(const Size &size) override;
+
+        [[nodiscard]] bool isCursorLocked() const override { return this->_cursorLocked; }
+
+        void lockCursor() override { this->_cursorLocked = true; }
+
+        void unlockCursor() override { this->_cursorLocked = false; }
+
+        [[nodiscard]] std::uint32_t getImageCount() const override { return this->_imageCount; }
+
+    private:
+        HeadlessSurfaceController *_controller;
+
+        Size _size;
+        std::uint32_t _imageCount;
+        bool _cursorLocked = false;
+    };
+}
+
+#endif // PENROSE_BUILTIN_HEADLESS_RENDERING_HEADLESS_SURFACE_HPP
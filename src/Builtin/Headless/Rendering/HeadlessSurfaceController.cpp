@@ -0,0 +1,39 @@
+#include "HeadlessSurfaceController.hpp"
+
+#include <Penrose/Common/EngineError.hpp>
+
+#include "src/Builtin/Headless/Rendering/HeadlessSurface.hpp"
+
+namespace Penrose {
+
+    HeadlessSurfaceController::HeadlessSurfaceController(const ResourceSet *resources)
+        : _eventQueue(resources->get<SurfaceEventQueue>()),
+          _surfaceManager(resources->get<SurfaceManager>()) {
+        //
+    }
+
+    Surface *HeadlessSurfaceController::makeSurface() {
+        const auto [width, height] = this->_info.size;
+
+        if (width == 0 || height == 0 || this->_info.imageCount == 0) {
+            throw EngineError(
+                "Invalid headless surface: size {}x{}, {} image(s)", width, height, this->_info.imageCount
+            );
+        }
+
+        return new HeadlessSurface(this, this->_info.size, this->_info.imageCount);
+    }
+
+    vk::SurfaceKHR HeadlessSurfaceController::getVkSurfaceFor(Surface *) {
+        throw EngineError("Headless surfaces are rendered offscreen and have no Vulkan surface");
+    }
+
+    void HeadlessSurfaceController::onSurfaceResized(const Size &size) {
+        this->_surfaceManager->invalidate();
+
+        this->_eventQueue->push(SurfaceResizedEvent {
+            .surface = this->_surfaceManager->getSurface(),
+            .size = size,
+        });
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef PENROSE_BUILTIN_HEADLESS_RENDERING_HEADLESS_SURFACE_CONTROLLER_HPP
+#define PENROSE_BUILTIN_HEADLESS_RENDERING_HEADLESS_SURFACE_CONTROLLER_HPP
+
+#include <string_view>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include <Penrose/Builtin/Headless.hpp>
+#include <Penrose/Events/SurfaceEvents.hpp>
+#include <Penrose/Rendering/SurfaceFactory.hpp>
+#include <Penrose/Rendering/SurfaceHook.hpp>
+#include <Penrose/Rendering/SurfaceManager.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+
+#include <Penrose/Builtin/Vulkan/VkInstanceExtensionsProvider.hpp>
+#include <Penrose/Builtin/Vulkan/VkSurfaceProvider.hpp>
+
+namespace Penrose {
+
+    class HeadlessSurfaceController : public Resource<HeadlessSurfaceController>,
+                                      public SurfaceFactory,
+                                      public SurfaceHook,
+                                      public VkSurfaceProvider,
+                                      public VkInstanceExtensionsProvider {
+    public:
+        explicit HeadlessSurfaceController(const ResourceSet *resources);
+        ~HeadlessSurfaceController() override = default;
+
+        [[nodiscard]] Surface *makeSurface() override;
+
+        [[nodiscard]] vk::SurfaceKHR getVkSurfaceFor(Surface *surface) override;
+
+        [[nodiscard]] std::vector<std::string_view> getRequiredInstanceExtensions() const override { return {}; }
+
+        void onSurfaceCreate(Surface *) override { /* nothing to do */ }
+
+        void onSurfaceDestroy(Surface *) override { /* nothing to do */ }
+
+        void onSurfaceInvalidated(Surface *) override { /* nothing to do */ }
+
+        void onSurfaceResized(const Size &size);
+
+        void setInfo(const HeadlessInfo &info) { this->_info = info; }
+
+    private:
+        ResourceProxy<SurfaceEventQueue> _eventQueue;
+        ResourceProxy<SurfaceManager> _surfaceManager;
+
+        HeadlessInfo _info;
+    };
+}
+
+#endif // PENROSE_BUILTIN_HEADLESS_RENDERING_HEADLESS_SURFACE_CONTROLLER_HPP
@@ -0,0 +1,107 @@
+#include "PngFrameCaptureWriter.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <fstream>
+#include <string_view>
+#include <utility>
+
+#include <fmt/core.h>
+
+#include <Penrose/Common/EngineError.hpp>
+
+#include "src/Common/PngEncoder.hpp"
+
+namespace Penrose {
+
+    inline static constexpr std::string_view TAG = "PngFrameCaptureWriter";
+
+    // rendering thread waits for worker only when it falls behind by this count of frames, so no frame is lost
+    inline constexpr std::size_t MAX_PENDING_CAPTURES = 8;
+
+    PngFrameCaptureWriter::PngFrameCaptureWriter(const ResourceSet *resources)
+        : _log(resources->get<Log>()) {
+        //
+    }
+
+    void PngFrameCaptureWriter::init() {
+        this->_stopRequested = false;
+        this->_worker = std::thread([this] { this->runWorker(); });
+    }
+
+    void PngFrameCaptureWriter::destroy() {
+        {
+            auto lock = std::lock_guard(this->_mutex);
+
+            this->_stopRequested = true;
+        }
+
+        this->_condition.notify_all();
+        this->_worker.join();
+    }
+
+    void PngFrameCaptureWriter::onFrameCaptured(const FrameCapture &capture) {
+        auto pending = capture;
+
+        {
+            auto lock = std::unique_lock(this->_mutex);
+
+            this->_condition.wait(lock, [this] { return this->_pending.size() < MAX_PENDING_CAPTURES; });
+
+            this->_pending.push_back(std::move(pending));
+        }
+
+        this->_condition.notify_all();
+    }
+
+    void PngFrameCaptureWriter::setDirectory(const std::filesystem::path &directory) {
+        auto lock = std::lock_guard(this->_mutex);
+
+        this->_directory = directory;
+    }
+
+    void PngFrameCaptureWriter::runWorker() {
+        auto lock = std::unique_lock(this->_mutex);
+
+        while (true) {
+            this->_condition.wait(lock, [this] { return this->_stopRequested || !this->_pending.empty(); });
+
+            if (this->_pending.empty()) {
+                break;
+            }
+
+            const auto capture = std::move(this->_pending.front());
+            const auto directory = this->_directory;
+
+            this->_pending.pop_front();
+
+            lock.unlock();
+            this->_condition.notify_all();
+
+            try {
+                this->write(directory, capture);
+            } catch (const std::exception &error) {
+                this->_log->writeError(TAG, "Failed to write frame {}: {}", capture.frameIdx, error.what());
+            }
+
+            lock.lock();
+        }
+    }
+
+    void PngFrameCaptureWriter::write(const std::filesystem::path &directory, const FrameCapture &capture) {
+        std::filesystem::create_directories(directory);
+
+        const auto path = directory / fmt::format("frame-{:06}.png", capture.frameIdx);
+        const auto png = encodePng(capture.width, capture.height, capture.data);
+
+        auto stream = std::ofstream(path, std::ios::binary | std::ios::trunc);
+
+        if (!stream.is_open()) {
+            throw EngineError("Failed to open {} for writing", path.string());
+        }
+
+        stream.write(reinterpret_cast<const char *>(png.data()), static_cast<std::streamsize>(png.size()));
+
+        this->_log->writeDebug(TAG, "Frame {} written to {}", capture.frameIdx, path.string());
+    }
+}
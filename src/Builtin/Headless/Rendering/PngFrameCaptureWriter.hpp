@@ -0,0 +1,50 @@
+#ifndef PENROSE_BUILTIN_HEADLESS_RENDERING_PNG_FRAME_CAPTURE_WRITER_HPP
+#define PENROSE_BUILTIN_HEADLESS_RENDERING_PNG_FRAME_CAPTURE_WRITER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+#include <Penrose/Common/Log.hpp>
+#include <Penrose/Rendering/FrameCapture.hpp>
+#include <Penrose/Resources/Initializable.hpp>
+#include <Penrose/Resources/Resource.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+
+namespace Penrose {
+
+    // captures are encoded and written by worker thread, so rendering thread only copies them
+    class PngFrameCaptureWriter : public Resource<PngFrameCaptureWriter>,
+                                  public FrameCaptureHandler,
+                                  public Initializable {
+    public:
+        explicit PngFrameCaptureWriter(const ResourceSet *resources);
+        ~PngFrameCaptureWriter() override = default;
+
+        void init() override;
+
+        // pending captures are written before worker is stopped
+        void destroy() override;
+
+        void onFrameCaptured(const FrameCapture &capture) override;
+
+        void setDirectory(const std::filesystem::path &directory);
+
+    private:
+        ResourceProxy<Log> _log;
+
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        std::filesystem::path _directory;
+        std::deque<FrameCapture> _pending;
+        bool _stopRequested = false;
+        std::thread _worker;
+
+        void runWorker();
+        void write(const std::filesystem::path &directory, const FrameCapture &capture);
+    };
+}
+
+#endif // PENROSE_BUILTIN_HEADLESS_RENDERING_PNG_FRAME_CAPTURE_WRITER_HPP
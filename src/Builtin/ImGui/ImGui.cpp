@@ -21,6 +21,7 @@ namespace Penrose {
             .group(ResourceGroup::Rendering)
             .implements<Renderer>()
             .implements<ImGuiRenderer>()
+            .dependsOn<ImGuiBackend>()
             .done();
 
         return resources;
@@ -19,6 +19,11 @@ namespace Penrose {
     void ImGuiBackend::onSurfaceCreate(Surface *surface) {
         auto glfwSurface = dynamic_cast<GlfwSurface *>(surface);
 
+        // surfaces without window, i.e. offscreen ones, have no platform backend
+        if (glfwSurface == nullptr) {
+            return;
+        }
+
         ImGui_ImplGlfw_InitForVulkan(glfwSurface->getHandle(), true);
     }
 
@@ -146,7 +146,15 @@ namespace Penrose {
         }
 
         ImGui_ImplVulkan_NewFrame();
-        ImGui_ImplGlfw_NewFrame();
+
+        if (ImGui::GetIO().BackendPlatformUserData != nullptr) {
+            ImGui_ImplGlfw_NewFrame();
+        } else {
+            const auto extent = vkRecorder->getRenderContext()->getSwapchain().extent;
+
+            ImGui::GetIO().DisplaySize = ImVec2(static_cast<float>(extent.width), static_cast<float>(extent.height));
+        }
+
         ImGui::NewFrame();
 
         this->_uiContextVisitor->visit(context);
@@ -1,223 +1,186 @@
 #include "ImGuiUIContextVisitor.hpp"
 
-#include <fmt/core.h>
 #include <imgui.h>
 #include <misc/cpp/imgui_stdlib.h>
 
 #include <Penrose/Common/EngineError.hpp>
-#include <Penrose/UI/Widgets/Button.hpp>
-#include <Penrose/UI/Widgets/Checkbox.hpp>
-#include <Penrose/UI/Widgets/Group.hpp>
-#include <Penrose/UI/Widgets/Input.hpp>
-#include <Penrose/UI/Widgets/Label.hpp>
-#include <Penrose/UI/Widgets/List.hpp>
-#include <Penrose/UI/Widgets/MenuBar.hpp>
-#include <Penrose/UI/Widgets/MenuEntry.hpp>
-#include <Penrose/UI/Widgets/MenuSection.hpp>
-#include <Penrose/UI/Widgets/Select.hpp>
-#include <Penrose/UI/Widgets/Window.hpp>
 
 namespace Penrose {
 
-    ImGuiUIContextVisitor::ImGuiUIContextVisitor() {
-        this->_widgetVisitors[WidgetType::Window] = [this](WidgetVisitContext &context) {
-            const auto window = dynamic_cast<const Window *>(context.widget);
+    void ImGuiUIContextVisitor::visit(UIContext *uiContext) {
+        for (auto &[layout, valueContext, binding]: uiContext->getLayouts()) {
+            auto &root = binding->getRoot();
+            const auto &rootFrame = layout->getCompiled().getFrames().at(CompiledLayout::ROOT_FRAME);
 
-            const auto title =
-                context.uiContext->resolveProperty<StringValue>(context.valueContext, &window->getTitle())->getValue();
+            // widget tags are unique only within layout
+            ImGui::PushID(binding.get());
 
-            const ObjectValue *nextContext =
-                window->getContext().has_value()
-                    ? context.uiContext->resolveProperty<ObjectValue>(context.valueContext, &(*window->getContext()))
-                    : context.valueContext;
+            this->visitRange(binding.get(), root, rootFrame.begin, rootFrame.end, true);
 
-            const auto opened = window->getOpened().has_value()
-                                    ? std::optional(context.uiContext->resolveProperty<BooleanValue>(
-                                          context.valueContext,
-                                          &(*window->getOpened())
-                                      ))
-                                    : std::nullopt;
+            ImGui::PopID();
+        }
+    }
 
-            bool openedValue = opened.has_value() ? (*opened)->getValue() : true;
-            const bool originalValue = openedValue;
+    void ImGuiUIContextVisitor::visitRange(
+        LayoutBinding *binding, FrameBinding &frame, const std::uint32_t begin, const std::uint32_t end,
+        const bool isTopLevel
+    ) {
+        const auto &instructions = binding->getLayout()->getInstructions();
 
-            if (!openedValue) {
-                return;
-            }
+        for (auto idx = begin; idx < end; idx = instructions[idx].end) {
+            this->visitWidget(binding, frame, idx, isTopLevel);
+        }
+    }
 
-            if (ImGui::Begin(
-                    title.c_str(),
-                    opened.has_value() ? &openedValue : nullptr,
-                    ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_MenuBar
-                )) {
-                for (const auto &child: window->getChildren()) {
-                    auto childContext = WidgetVisitContext {
-                        .uiContext = context.uiContext,
-                        .valueContext = nextContext,
-                        .widget = child.get(),
-                        .isTopLevel = false
-                    };
-
-                    this->visit(childContext);
-                }
-            }
+    void ImGuiUIContextVisitor::visitWidget(
+        LayoutBinding *binding, FrameBinding &frame, const std::uint32_t idx, const bool isTopLevel
+    ) {
+        const auto &instruction = binding->getLayout()->getInstructions()[idx];
 
-            ImGui::End();
+        if (!LayoutBinding::get<BooleanValue>(frame, instruction, SLOT_VISIBLE)->getValue()) {
+            return;
+        }
 
-            if (opened.has_value() && openedValue != originalValue) {
-                (*opened)->setValue(openedValue);
-            }
-        };
+        const bool disabled = !LayoutBinding::get<BooleanValue>(frame, instruction, SLOT_ENABLED)->getValue();
 
-        this->_widgetVisitors[WidgetType::Button] = [](WidgetVisitContext &context) {
-            const auto button = dynamic_cast<const Button *>(context.widget);
+        if (disabled) {
+            ImGui::BeginDisabled();
+        }
 
-            const auto title =
-                context.uiContext->resolveProperty<StringValue>(context.valueContext, &button->getTitle())->getValue();
+        switch (instruction.type) {
+            case WidgetType::Window: {
+                const auto &title = LayoutBinding::get<StringValue>(frame, instruction, SLOT_TITLE)->getValue();
+                const auto opened = LayoutBinding::get<BooleanValue>(frame, instruction, SLOT_WINDOW_OPENED);
 
-            std::optional<ActionValue *> action =
-                button->getAction().has_value()
-                    ? std::optional(
-                          context.uiContext->resolveProperty<ActionValue>(context.valueContext, &*button->getAction())
-                      )
-                    : std::nullopt;
+                bool openedValue = opened != nullptr ? opened->getValue() : true;
+                const bool originalValue = openedValue;
 
-            if (ImGui::Button(title.c_str()) && action.has_value()) {
-                (*action)->invoke();
-            }
-        };
+                if (!openedValue) {
+                    break;
+                }
 
-        this->_widgetVisitors[WidgetType::Checkbox] = [](WidgetVisitContext &context) {
-            const auto checkbox = dynamic_cast<const Checkbox *>(context.widget);
+                if (ImGui::Begin(
+                        title.c_str(),
+                        opened != nullptr ? &openedValue : nullptr,
+                        ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_MenuBar
+                    )) {
+                    this->visitRange(binding, frame, idx + 1, instruction.end, false);
+                }
 
-            const auto text =
-                context.uiContext->resolveProperty<StringValue>(context.valueContext, &checkbox->getText())->getValue();
-            auto checked =
-                context.uiContext->resolveProperty<BooleanValue>(context.valueContext, &checkbox->getChecked());
+                ImGui::End();
 
-            bool state = checked->getValue();
+                if (opened != nullptr && openedValue != originalValue) {
+                    opened->setValue(openedValue);
+                }
 
-            if (ImGui::Checkbox(text.c_str(), &state)) {
-                checked->setValue(state);
+                break;
             }
-        };
-
-        this->_widgetVisitors[WidgetType::Input] = [this](WidgetVisitContext &context) {
-            const auto input = dynamic_cast<const Input *>(context.widget);
-
-            auto text = context.uiContext->resolveProperty<StringValue>(context.valueContext, &input->getText());
-            auto textStr = text->getValue();
 
-            const auto tag = this->getTag(context.valueContext, context.widget);
+            case WidgetType::Label: {
+                const auto &text = LayoutBinding::get<StringValue>(frame, instruction, SLOT_TEXT)->getValue();
 
-            if (ImGui::InputText(tag.c_str(), &textStr)) {
-                text->setValue(textStr);
+                ImGui::LabelText(instruction.tag.c_str(), "%s", text.c_str());
+                break;
             }
-        };
 
-        this->_widgetVisitors[WidgetType::Label] = [this](WidgetVisitContext &context) {
-            const auto label = dynamic_cast<const Label *>(context.widget);
+            case WidgetType::Button: {
+                const auto &title = LayoutBinding::get<StringValue>(frame, instruction, SLOT_TITLE)->getValue();
+                const auto action = LayoutBinding::get<ActionValue>(frame, instruction, SLOT_ACTION);
 
-            const auto text =
-                context.uiContext->resolveProperty<StringValue>(context.valueContext, &label->getText())->getValue();
-
-            const auto tag = this->getTag(context.valueContext, context.widget);
+                if (ImGui::Button(title.c_str()) && action != nullptr) {
+                    action->invoke();
+                }
 
-            ImGui::LabelText(tag.c_str(), "%s", text.c_str());
-        };
+                break;
+            }
 
-        this->_widgetVisitors[WidgetType::Group] = [this](WidgetVisitContext &context) {
-            const auto group = dynamic_cast<const Group *>(context.widget);
+            case WidgetType::Input: {
+                const auto text = LayoutBinding::get<StringValue>(frame, instruction, SLOT_TEXT);
+                auto &cache = LayoutBinding::getCache(frame, instruction, SLOT_TEXT);
 
-            const ObjectValue *nextContext =
-                group->getContext().has_value()
-                    ? context.uiContext->resolveProperty<ObjectValue>(context.valueContext, &(*group->getContext()))
-                    : context.valueContext;
+                // edit buffer is copied from value only when value was changed
+                if (const auto version = text->getVersion(); cache.version != version) {
+                    cache.text = text->getValue();
+                    cache.version = version;
+                }
 
-            for (const auto &child: group->getChildren()) {
-                auto childContext = WidgetVisitContext {
-                    .uiContext = context.uiContext,
-                    .valueContext = nextContext,
-                    .widget = child.get(),
-                    .isTopLevel = false
-                };
+                if (ImGui::InputText(instruction.tag.c_str(), &cache.text)) {
+                    text->setValue(cache.text);
+                    cache.version = text->getVersion();
+                }
 
-                this->visit(childContext);
+                break;
             }
-        };
-
-        this->_widgetVisitors[WidgetType::List] = [this](WidgetVisitContext &context) {
-            const auto list = dynamic_cast<const List *>(context.widget);
 
-            const auto items =
-                context.uiContext->resolveProperty<ListValue<ObjectValue>>(context.valueContext, &list->getItems());
-            const auto selection =
-                context.uiContext->resolveProperty<IntegerValue>(context.valueContext, &list->getSelection());
+            case WidgetType::Checkbox: {
+                const auto &text = LayoutBinding::get<StringValue>(frame, instruction, SLOT_TEXT)->getValue();
+                const auto checked = LayoutBinding::get<BooleanValue>(frame, instruction, SLOT_CHECKED);
 
-            const auto tag = this->getTag(context.valueContext, context.widget);
-            const auto selectedIdx = selection->getValue();
+                bool state = checked->getValue();
 
-            if (ImGui::BeginListBox(tag.c_str())) {
-
-                const auto itemTemplate = list->getItemTemplate().get();
+                if (ImGui::Checkbox(text.c_str(), &state)) {
+                    checked->setValue(state);
+                }
 
-                for (int idx = 0; idx < items->getItems().size(); ++idx) {
-                    const auto &item = items->getItems().at(idx);
+                break;
+            }
 
-                    auto childContext = WidgetVisitContext {
-                        .uiContext = context.uiContext,
-                        .valueContext = item.get(),
-                        .widget = itemTemplate,
-                        .isTopLevel = false
-                    };
+            case WidgetType::List: {
+                const auto items = LayoutBinding::get<ListValue<ObjectValue>>(frame, instruction, SLOT_ITEMS);
+                const auto virtualized = LayoutBinding::get<BooleanValue>(frame, instruction, SLOT_LIST_VIRTUALIZED);
+                const auto itemCount = items->getItems().size();
 
-                    this->visit(childContext);
+                binding->trimItems(frame, instruction, itemCount);
 
-                    const auto isSelected = idx == selectedIdx;
+                if (!ImGui::BeginListBox(instruction.tag.c_str())) {
+                    break;
+                }
 
-                    ImGui::SameLine();
+                if (virtualized->getValue()) {
+                    // rows are expected to have same height, so only rows on screen are bound and visited
+                    ImGuiListClipper clipper;
+                    clipper.Begin(static_cast<int>(itemCount));
 
-                    if (ImGui::Selectable(
-                            this->getTag(item.get(), itemTemplate).c_str(),
-                            isSelected,
-                            ImGuiSelectableFlags_SpanAllColumns | ImGuiSelectableFlags_AllowItemOverlap
-                        )) {
-                        selection->setValue(idx);
+                    while (clipper.Step()) {
+                        for (auto itemIdx = clipper.DisplayStart; itemIdx < clipper.DisplayEnd; ++itemIdx) {
+                            this->visitListRow(binding, frame, idx, static_cast<std::size_t>(itemIdx));
+                        }
                     }
 
-                    if (isSelected) {
-                        ImGui::SetItemDefaultFocus();
+                    clipper.End();
+                } else {
+                    for (std::size_t itemIdx = 0; itemIdx < itemCount; ++itemIdx) {
+                        this->visitListRow(binding, frame, idx, itemIdx);
                     }
                 }
 
                 ImGui::EndListBox();
+                break;
             }
-        };
-
-        this->_widgetVisitors[WidgetType::Select] = [this](WidgetVisitContext &context) {
-            const auto select = dynamic_cast<const Select *>(context.widget);
 
-            const auto items =
-                context.uiContext->resolveProperty<ListValue<StringValue>>(context.valueContext, &select->getItems());
-            const auto selection =
-                context.uiContext->resolveProperty<IntegerValue>(context.valueContext, &select->getSelection());
+            case WidgetType::Group:
+                this->visitRange(binding, frame, idx + 1, instruction.end, false);
+                break;
 
-            const auto selectionIdx = selection->getValue();
+            case WidgetType::Select: {
+                const auto items = LayoutBinding::get<ListValue<StringValue>>(frame, instruction, SLOT_ITEMS);
+                const auto selection = LayoutBinding::get<IntegerValue>(frame, instruction, SLOT_SELECTION);
 
-            const auto tag = this->getTag(context.valueContext, context.widget);
-            const auto previewValue = selectionIdx >= 0 && selectionIdx < items->getItems().size()
-                                          ? items->getItems().at(selectionIdx)->getValue()
-                                          : "None";
+                const auto selectionIdx = selection->getValue();
+                const auto previewValue = selectionIdx >= 0 && selectionIdx < items->getItems().size()
+                                              ? items->getItems().at(selectionIdx)->getValue().c_str()
+                                              : "None";
 
-            if (ImGui::BeginCombo(tag.c_str(), previewValue.c_str())) {
-
-                for (int idx = 0; idx < items->getItems().size(); ++idx) {
-                    const auto &item = items->getItems().at(idx);
+                if (!ImGui::BeginCombo(instruction.tag.c_str(), previewValue)) {
+                    break;
+                }
 
-                    const auto isSelected = selectionIdx == idx;
+                for (int itemIdx = 0; itemIdx < items->getItems().size(); ++itemIdx) {
+                    const auto &item = items->getItems().at(itemIdx);
+                    const auto isSelected = selectionIdx == itemIdx;
 
                     if (ImGui::Selectable(item->getValue().c_str(), isSelected)) {
-                        selection->setValue(idx);
+                        selection->setValue(itemIdx);
                     }
 
                     if (isSelected) {
@@ -226,138 +189,90 @@ namespace Penrose {
                 }
 
                 ImGui::EndCombo();
+                break;
             }
-        };
 
-        this->_widgetVisitors[WidgetType::Separator] = [](WidgetVisitContext &) { ImGui::Separator(); };
+            case WidgetType::MenuBar:
+                if (isTopLevel ? ImGui::BeginMainMenuBar() : ImGui::BeginMenuBar()) {
+                    this->visitRange(binding, frame, idx + 1, instruction.end, false);
 
-        this->_widgetVisitors[WidgetType::MenuBar] = [this](WidgetVisitContext &context) {
-            const auto menuBar = dynamic_cast<const MenuBar *>(context.widget);
-
-            if (context.isTopLevel ? ImGui::BeginMainMenuBar() : ImGui::BeginMenuBar()) {
-
-                for (const auto &child: menuBar->getChildren()) {
-                    auto childContext = WidgetVisitContext {
-                        .uiContext = context.uiContext,
-                        .valueContext = context.valueContext,
-                        .widget = child.get(),
-                        .isTopLevel = false
-                    };
-
-                    this->visit(childContext);
+                    isTopLevel ? ImGui::EndMainMenuBar() : ImGui::EndMenuBar();
                 }
 
-                context.isTopLevel ? ImGui::EndMainMenuBar() : ImGui::EndMenuBar();
-            }
-        };
-
-        this->_widgetVisitors[WidgetType::MenuEntry] = [this](WidgetVisitContext &context) {
-            const auto menuEntry = dynamic_cast<const MenuEntry *>(context.widget);
-
-            const auto title =
-                context.uiContext->resolveProperty<StringValue>(context.valueContext, &menuEntry->getTitle())
-                    ->getValue();
+                break;
 
-            const auto checked =
-                context.uiContext->resolveProperty<BooleanValue>(context.valueContext, &menuEntry->getChecked());
-            auto checkedValue = checked->getValue();
+            case WidgetType::MenuSection: {
+                const auto &title = LayoutBinding::get<StringValue>(frame, instruction, SLOT_TITLE)->getValue();
 
-            const auto action = menuEntry->getAction().has_value()
-                                    ? std::optional(context.uiContext->resolveProperty<ActionValue>(
-                                          context.valueContext,
-                                          &(*menuEntry->getAction())
-                                      ))
-                                    : std::nullopt;
+                if (ImGui::BeginMenu(title.c_str())) {
+                    this->visitRange(binding, frame, idx + 1, instruction.end, false);
 
-            if (ImGui::MenuItem(title.c_str(), nullptr, &checkedValue)) {
-                checked->setValue(checkedValue);
-
-                if (action.has_value()) {
-                    (*action)->invoke();
+                    ImGui::EndMenu();
                 }
-            }
-        };
 
-        this->_widgetVisitors[WidgetType::MenuSection] = [this](WidgetVisitContext &context) {
-            const auto menuSection = dynamic_cast<const MenuSection *>(context.widget);
+                break;
+            }
 
-            const auto title =
-                context.uiContext->resolveProperty<StringValue>(context.valueContext, &menuSection->getTitle())
-                    ->getValue();
+            case WidgetType::MenuEntry: {
+                const auto &title = LayoutBinding::get<StringValue>(frame, instruction, SLOT_TITLE)->getValue();
+                const auto checked = LayoutBinding::get<BooleanValue>(frame, instruction, SLOT_CHECKED);
+                const auto action = LayoutBinding::get<ActionValue>(frame, instruction, SLOT_MENU_ENTRY_ACTION);
 
-            if (ImGui::BeginMenu(title.c_str())) {
+                auto checkedValue = checked->getValue();
 
-                for (const auto &child: menuSection->getChildren()) {
-                    auto childContext = WidgetVisitContext {
-                        .uiContext = context.uiContext,
-                        .valueContext = context.valueContext,
-                        .widget = child.get(),
-                        .isTopLevel = false
-                    };
+                if (ImGui::MenuItem(title.c_str(), nullptr, &checkedValue)) {
+                    checked->setValue(checkedValue);
 
-                    this->visit(childContext);
+                    if (action != nullptr) {
+                        action->invoke();
+                    }
                 }
 
-                ImGui::EndMenu();
+                break;
             }
-        };
-    }
 
-    void ImGuiUIContextVisitor::visit(UIContext *uiContext) {
-        for (const auto &[layout, valueContext]: uiContext->getLayouts()) {
-            auto context = WidgetVisitContext {
-                .uiContext = uiContext,
-                .valueContext = valueContext.get(),
-                .widget = layout->getRoot(),
-                .isTopLevel = true
-            };
-
-            this->visit(context);
-        }
-    }
-
-    void ImGuiUIContextVisitor::visit(WidgetVisitContext &context) {
-
-        const auto visible =
-            context.uiContext->resolveProperty<BooleanValue>(context.valueContext, &context.widget->getVisible());
-        const auto enabled =
-            context.uiContext->resolveProperty<BooleanValue>(context.valueContext, &context.widget->getEnabled());
+            case WidgetType::Separator:
+                ImGui::Separator();
+                break;
 
-        if (!visible->getValue()) {
-            return;
+            default:
+                throw EngineError("Unable to render widget");
         }
 
-        const bool disabled = !enabled->getValue();
-
         if (disabled) {
-            ImGui::BeginDisabled();
+            ImGui::EndDisabled();
         }
+    }
 
-        const auto it = this->_widgetVisitors.find(context.widget->getType());
+    void ImGuiUIContextVisitor::visitListRow(
+        LayoutBinding *binding, FrameBinding &frame, const std::uint32_t idx, const std::size_t itemIdx
+    ) {
+        const auto &instruction = binding->getLayout()->getInstructions()[idx];
+        const auto &itemFrame = binding->getLayout()->getFrames().at(instruction.frame);
+        const auto items = LayoutBinding::get<ListValue<ObjectValue>>(frame, instruction, SLOT_ITEMS);
+        const auto selection = LayoutBinding::get<IntegerValue>(frame, instruction, SLOT_SELECTION);
 
-        if (it == this->_widgetVisitors.end()) {
-            throw EngineError("Unable to render widget");
-        }
+        const auto &item = items->getItems().at(itemIdx);
+        auto &itemBinding = binding->getItem(frame, instruction, itemIdx, item);
+        const auto isSelected = static_cast<int>(itemIdx) == selection->getValue();
 
-        it->second(context);
+        // row identifier follows item, so widget state is kept when rows are inserted or removed before it
+        ImGui::PushID(item.get());
 
-        if (disabled) {
-            ImGui::EndDisabled();
-        }
-    }
+        this->visitRange(binding, itemBinding, itemFrame.begin, itemFrame.end, false);
 
-    const std::string &ImGuiUIContextVisitor::getTag(const ObjectValue *valueContext, const Widget *widget) {
-        auto tag = Tag(valueContext, widget);
+        ImGui::SameLine();
 
-        if (const auto it = this->_tags.find(tag); it != this->_tags.end()) {
-            return it->second;
+        if (ImGui::Selectable(
+                "##item", isSelected, ImGuiSelectableFlags_SpanAllColumns | ImGuiSelectableFlags_AllowItemOverlap
+            )) {
+            selection->setValue(static_cast<int>(itemIdx));
         }
 
-        auto [newIt, _] = this->_tags.emplace(
-            tag,
-            fmt::format("##{}{}", reinterpret_cast<std::size_t>(valueContext), reinterpret_cast<std::size_t>(widget))
-        );
+        if (isSelected) {
+            ImGui::SetItemDefaultFocus();
+        }
 
-        return newIt->second;
+        ImGui::PopID();
     }
 }
@@ -1,41 +1,30 @@
 #ifndef PENROSE_BUILTIN_IMGUI_UI_IMGUI_UI_CONTEXT_VISITOR_HPP
 #define PENROSE_BUILTIN_IMGUI_UI_IMGUI_UI_CONTEXT_VISITOR_HPP
 
-#include <functional>
-#include <map>
-#include <string>
-#include <tuple>
+#include <cstddef>
+#include <cstdint>
 
 #include <Penrose/Resources/ResourceSet.hpp>
+#include <Penrose/UI/LayoutBinding.hpp>
 #include <Penrose/UI/UIContext.hpp>
-#include <Penrose/UI/Widgets/Widget.hpp>
 
 namespace Penrose {
 
     class ImGuiUIContextVisitor final: public Resource<ImGuiUIContextVisitor> {
     public:
-        ImGuiUIContextVisitor();
+        ImGuiUIContextVisitor() = default;
         ~ImGuiUIContextVisitor() override = default;
 
         void visit(UIContext *uiContext);
 
     private:
-        struct WidgetVisitContext {
-            UIContext *uiContext;
-            const ObjectValue *valueContext;
-            const Widget *widget;
-            bool isTopLevel;
-        };
+        void visitRange(
+            LayoutBinding *binding, FrameBinding &frame, std::uint32_t begin, std::uint32_t end, bool isTopLevel
+        );
 
-        using WidgetVisitor = std::function<void(WidgetVisitContext &)>;
-        using Tag = std::tuple<const ObjectValue *, const Widget *>;
+        void visitWidget(LayoutBinding *binding, FrameBinding &frame, std::uint32_t idx, bool isTopLevel);
 
-        std::map<WidgetType, WidgetVisitor> _widgetVisitors;
-        std::map<Tag, std::string> _tags;
-
-        void visit(WidgetVisitContext &context);
-
-        [[nodiscard]] const std::string &getTag(const ObjectValue *valueContext, const Widget *widget);
+        void visitListRow(LayoutBinding *binding, FrameBinding &frame, std::uint32_t idx, std::size_t itemIdx);
     };
 }
 
@@ -7,7 +7,12 @@
 
 namespace Penrose {
 
-    static constexpr std::uint32_t INFLIGHT_FRAME_COUNT = 2;
+    // frames in flight are configurable, this is upper bound of their count
+    static constexpr std::uint32_t MAX_INFLIGHT_FRAME_COUNT = 4;
+
+    static constexpr std::uint32_t BINDLESS_IMAGE_COUNT = 16 * 1024;
+    static constexpr std::uint32_t BINDLESS_SAMPLER_COUNT = 256;
+    static constexpr std::uint32_t BINDLESS_STORAGE_BUFFER_COUNT = 4 * 1024;
 
     static constexpr std::array<std::string_view, 2> REQUIRED_DEVICE_EXTENSIONS = {
         VK_KHR_SWAPCHAIN_EXTENSION_NAME, VK_KHR_SHADER_NON_SEMANTIC_INFO_EXTENSION_NAME
@@ -1,27 +1,37 @@
 #ifndef PENROSE_BUILTIN_VULKAN_RENDERING_OBJECTS_VK_BUFFER_HPP
 #define PENROSE_BUILTIN_VULKAN_RENDERING_OBJECTS_VK_BUFFER_HPP
 
+#include <optional>
+
 #include <vulkan/vulkan.hpp>
 
 #include <Penrose/Rendering/Objects/Buffer.hpp>
 
+#include "src/Builtin/Vulkan/Rendering/VkBindlessDescriptorSet.hpp"
+
 namespace Penrose {
 
     class VkBuffer final: public Buffer {
     public:
         VkBuffer(
             const BufferType type, const std::uint64_t size, const DataPtr data, vk::UniqueBuffer &&buffer,
-            vk::UniqueDeviceMemory &&bufferMemory
+            vk::UniqueDeviceMemory &&bufferMemory, std::optional<VkBindlessSlot> &&bindlessSlot = std::nullopt
         )
             : _type(type),
               _size(size),
               _data(data),
               _buffer(std::forward<decltype(buffer)>(buffer)),
-              _bufferMemory(std::forward<decltype(bufferMemory)>(bufferMemory)) {
+              _bufferMemory(std::forward<decltype(bufferMemory)>(bufferMemory)),
+              _bindlessSlot(std::forward<decltype(bindlessSlot)>(bindlessSlot)) {
             //
         }
 
-        ~VkBuffer() override = default;
+        // buffer could be still read by frames in flight through bindless descriptor
+        ~VkBuffer() override {
+            if (this->_bindlessSlot.has_value()) {
+                this->_bindlessSlot->retire(std::move(this->_buffer), std::move(this->_bufferMemory));
+            }
+        }
 
         [[nodiscard]] BufferType getType() const override { return this->_type; }
 
@@ -29,6 +39,14 @@ namespace Penrose {
 
         [[nodiscard]] DataPtr getData() const override { return this->_data; }
 
+        [[nodiscard]] std::optional<std::uint32_t> getBindlessIndex() const override {
+            if (!this->_bindlessSlot.has_value()) {
+                return std::nullopt;
+            }
+
+            return this->_bindlessSlot->getIndex();
+        }
+
         [[nodiscard]] const vk::Buffer &getHandle() const { return this->_buffer.get(); }
 
     private:
@@ -38,6 +56,8 @@ namespace Penrose {
 
         vk::UniqueBuffer _buffer;
         vk::UniqueDeviceMemory _bufferMemory;
+
+        std::optional<VkBindlessSlot> _bindlessSlot;
     };
 }
 
@@ -8,7 +8,8 @@ namespace Penrose {
     VkBufferFactory::VkBufferFactory(const ResourceSet *resources)
         : _physicalDeviceProvider(resources->get<VkPhysicalDeviceProvider>()),
           _logicalDeviceProvider(resources->get<VkLogicalDeviceProvider>()),
-          _memoryAllocator(resources->get<VkMemoryAllocator>()) {
+          _memoryAllocator(resources->get<VkMemoryAllocator>()),
+          _bindlessDescriptorSet(resources->get<VkBindlessDescriptorSet>()) {
         //
     }
 
@@ -27,8 +28,9 @@ namespace Penrose {
 
     Buffer *VkBufferFactory::makeBuffer(const BufferType type, const std::uint64_t size, const bool map) {
         auto [buffer, bufferMemory, data] = this->makeBuffer(mapBufferType(type), size, map);
+        auto bindlessSlot = this->registerBuffer(type, buffer.get(), size);
 
-        return new VkBuffer(type, size, data, std::move(buffer), std::move(bufferMemory));
+        return new VkBuffer(type, size, data, std::move(buffer), std::move(bufferMemory), std::move(bindlessSlot));
     }
 
     Buffer *VkBufferFactory::makeBuffer(
@@ -60,7 +62,11 @@ namespace Penrose {
             transferQueue.waitIdle();
         }
 
-        return new VkBuffer(type, size, destData, std::move(destBuffer), std::move(destBufferMemory));
+        auto bindlessSlot = this->registerBuffer(type, destBuffer.get(), size);
+
+        return new VkBuffer(
+            type, size, destData, std::move(destBuffer), std::move(destBufferMemory), std::move(bindlessSlot)
+        );
     }
 
     VkBufferInternal VkBufferFactory::makeBuffer(
@@ -80,4 +86,14 @@ namespace Penrose {
             data,
         };
     }
+
+    std::optional<VkBindlessSlot> VkBufferFactory::registerBuffer(
+        const BufferType type, const vk::Buffer buffer, const std::uint64_t size
+    ) {
+        if (type != BufferType::Storage) {
+            return std::nullopt;
+        }
+
+        return this->_bindlessDescriptorSet->registerBuffer(buffer, size);
+    }
 }
@@ -1,6 +1,7 @@
 #ifndef PENROSE_BUILTIN_VULKAN_RENDERING_OBJECTS_VK_BUFFER_FACTORY_HPP
 #define PENROSE_BUILTIN_VULKAN_RENDERING_OBJECTS_VK_BUFFER_FACTORY_HPP
 
+#include <optional>
 #include <tuple>
 
 #include <vulkan/vulkan.hpp>
@@ -11,6 +12,7 @@
 
 #include "src/Builtin/Vulkan/Rendering/Objects/VkLogicalDeviceProvider.hpp"
 #include "src/Builtin/Vulkan/Rendering/Objects/VkPhysicalDeviceProvider.hpp"
+#include "src/Builtin/Vulkan/Rendering/VkBindlessDescriptorSet.hpp"
 #include "src/Builtin/Vulkan/Rendering/VkMemoryAllocator.hpp"
 
 namespace Penrose {
@@ -35,8 +37,13 @@ namespace Penrose {
         ResourceProxy<VkPhysicalDeviceProvider> _physicalDeviceProvider;
         ResourceProxy<VkLogicalDeviceProvider> _logicalDeviceProvider;
         ResourceProxy<VkMemoryAllocator> _memoryAllocator;
+        ResourceProxy<VkBindlessDescriptorSet> _bindlessDescriptorSet;
 
         vk::UniqueCommandPool _commandPool;
+
+        [[nodiscard]] std::optional<VkBindlessSlot> registerBuffer(
+            BufferType type, vk::Buffer buffer, std::uint64_t size
+        );
     };
 }
 
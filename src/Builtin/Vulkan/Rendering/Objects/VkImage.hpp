@@ -5,24 +5,32 @@
 
 #include <Penrose/Rendering/Objects/Image.hpp>
 
+#include "src/Builtin/Vulkan/Rendering/VkBindlessDescriptorSet.hpp"
+
 namespace Penrose {
 
     class VkImage final: public Image {
     public:
         VkImage(
             const ImageFormat format, const std::uint32_t width, const std::uint32_t height, vk::UniqueImage &&image,
-            vk::UniqueDeviceMemory &&imageMemory, vk::UniqueImageView &&imageView
+            vk::UniqueDeviceMemory &&imageMemory, vk::UniqueImageView &&imageView, VkBindlessSlot &&bindlessSlot
         )
             : _format(format),
               _width(width),
               _height(height),
               _image(std::forward<decltype(image)>(image)),
               _imageMemory(std::forward<decltype(imageMemory)>(imageMemory)),
-              _imageView(std::forward<decltype(imageView)>(imageView)) {
+              _imageView(std::forward<decltype(imageView)>(imageView)),
+              _bindlessSlot(std::forward<decltype(bindlessSlot)>(bindlessSlot)) {
             //
         }
 
-        ~VkImage() override = default;
+        // view and memory could be still read by frames in flight through bindless descriptor
+        ~VkImage() override {
+            this->_bindlessSlot.retire(
+                std::move(this->_imageView), std::move(this->_image), std::move(this->_imageMemory)
+            );
+        }
 
         [[nodiscard]] ImageFormat getFormat() const override { return this->_format; }
 
@@ -30,6 +38,8 @@ namespace Penrose {
 
         [[nodiscard]] std::uint32_t getHeight() const override { return this->_height; }
 
+        [[nodiscard]] std::uint32_t getBindlessIndex() const override { return this->_bindlessSlot.getIndex(); }
+
         [[nodiscard]] const vk::Image &getHandle() const { return this->_image.get(); }
 
         [[nodiscard]] const vk::ImageView &getViewHandle() const { return this->_imageView.get(); }
@@ -42,6 +52,8 @@ namespace Penrose {
         vk::UniqueImage _image;
         vk::UniqueDeviceMemory _imageMemory;
         vk::UniqueImageView _imageView;
+
+        VkBindlessSlot _bindlessSlot;
     };
 }
 
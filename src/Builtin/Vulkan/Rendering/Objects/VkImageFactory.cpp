@@ -9,7 +9,8 @@ namespace Penrose {
         : _physicalDeviceProvider(resources->get<VkPhysicalDeviceProvider>()),
           _logicalDeviceProvider(resources->get<VkLogicalDeviceProvider>()),
           _memoryAllocator(resources->get<VkMemoryAllocator>()),
-          _bufferFactory(resources->get<VkBufferFactory>()) {
+          _bufferFactory(resources->get<VkBufferFactory>()),
+          _bindlessDescriptorSet(resources->get<VkBindlessDescriptorSet>()) {
         //
     }
 
@@ -55,8 +56,12 @@ namespace Penrose {
                                              .setComponents(vk::ComponentMapping());
 
         auto [image, imageMemory, imageView] = this->makeImage(imageCreateInfo, imageViewCreateInfo);
+        auto bindlessSlot = this->_bindlessDescriptorSet->registerImage(imageView.get());
 
-        return new VkImage(format, width, height, std::move(image), std::move(imageMemory), std::move(imageView));
+        return new VkImage(
+            format, width, height, std::move(image), std::move(imageMemory), std::move(imageView),
+            std::move(bindlessSlot)
+        );
     }
 
     Image *VkImageFactory::makeImage(
@@ -160,10 +165,67 @@ namespace Penrose {
             transferQueue.waitIdle();
         }
 
-        return new VkImage(format, width, height, std::move(image), std::move(imageMemory), std::move(imageView));
+        auto bindlessSlot = this->_bindlessDescriptorSet->registerImage(imageView.get());
+
+        return new VkImage(
+            format, width, height, std::move(image), std::move(imageMemory), std::move(imageView),
+            std::move(bindlessSlot)
+        );
     }
 
     VkImageInternal VkImageFactory::makeImage(const TargetInfo &target, const VkSwapchain &swapchain) {
+        const auto [imageCreateInfo, imageViewCreateInfo] = makeTargetCreateInfo(target, swapchain);
+
+        return this->makeImage(imageCreateInfo, imageViewCreateInfo);
+    }
+
+    VkAliasedImageSet VkImageFactory::makeAliasedImages(
+        const std::vector<TargetInfo> &targets, const VkSwapchain &swapchain
+    ) {
+        auto &device = this->_logicalDeviceProvider->getLogicalDevice().handle;
+
+        auto images = std::vector<vk::UniqueImage>(targets.size());
+        auto imageHandles = std::vector<vk::Image>(targets.size());
+
+        for (std::uint32_t idx = 0; idx < targets.size(); idx++) {
+            const auto [imageCreateInfo, _] = makeTargetCreateInfo(targets.at(idx), swapchain);
+
+            images[idx] = device->createImageUnique(imageCreateInfo);
+            imageHandles[idx] = images[idx].get();
+        }
+
+        auto memory = this->_memoryAllocator->allocateAliasedImages(imageHandles);
+        auto aliasedImages = std::vector<VkAliasedImageInternal>(targets.size());
+
+        for (std::uint32_t idx = 0; idx < targets.size(); idx++) {
+            auto [_, imageViewCreateInfo] = makeTargetCreateInfo(targets.at(idx), swapchain);
+            auto imageView = device->createImageViewUnique(imageViewCreateInfo.setImage(imageHandles.at(idx)));
+
+            aliasedImages[idx] = VkAliasedImageInternal {std::move(images[idx]), std::move(imageView)};
+        }
+
+        return {std::move(memory), std::move(aliasedImages)};
+    }
+
+    VkImageInternal VkImageFactory::makeImage(
+        const vk::ImageCreateInfo &imageCreateInfo, vk::ImageViewCreateInfo imageViewCreateInfo
+    ) {
+        auto &device = this->_logicalDeviceProvider->getLogicalDevice().handle;
+
+        auto image = device->createImageUnique(imageCreateInfo);
+        auto imageMemory = this->_memoryAllocator->allocateImage(image.get());
+        auto imageView = device->createImageViewUnique(imageViewCreateInfo.setImage(image.get()));
+
+        return {
+            std::move(image),
+            std::move(imageMemory),
+            std::move(imageView),
+        };
+    }
+
+    std::tuple<vk::ImageCreateInfo, vk::ImageViewCreateInfo> VkImageFactory::makeTargetCreateInfo(
+        const TargetInfo &target, const VkSwapchain &swapchain
+    ) {
         const auto format = mapRenderFormat(target.format, swapchain.format);
         const auto extent = vk::Extent3D(mapSize(target.size, swapchain.extent));
 
@@ -189,22 +251,6 @@ namespace Penrose {
                                                                       .setBaseMipLevel(0))
                                              .setComponents(vk::ComponentMapping());
 
-        return this->makeImage(imageCreateInfo, imageViewCreateInfo);
-    }
-
-    VkImageInternal VkImageFactory::makeImage(
-        const vk::ImageCreateInfo &imageCreateInfo, vk::ImageViewCreateInfo imageViewCreateInfo
-    ) {
-        auto &device = this->_logicalDeviceProvider->getLogicalDevice().handle;
-
-        auto image = device->createImageUnique(imageCreateInfo);
-        auto imageMemory = this->_memoryAllocator->allocateImage(image.get());
-        auto imageView = device->createImageViewUnique(imageViewCreateInfo.setImage(image.get()));
-
-        return {
-            std::move(image),
-            std::move(imageMemory),
-            std::move(imageView),
-        };
+        return {imageCreateInfo, imageViewCreateInfo};
     }
 }
@@ -2,6 +2,7 @@
 #define PENROSE_BUILTIN_VULKAN_RENDERING_OBJECTS_VK_IMAGE_FACTORY_HPP
 
 #include <tuple>
+#include <vector>
 
 #include <Penrose/Rendering/Graph/TargetInfo.hpp>
 #include <Penrose/Rendering/Objects/ImageFactory.hpp>
@@ -12,11 +13,14 @@
 #include "src/Builtin/Vulkan/Rendering/Objects/VkLogicalDeviceProvider.hpp"
 #include "src/Builtin/Vulkan/Rendering/Objects/VkPhysicalDeviceProvider.hpp"
 #include "src/Builtin/Vulkan/Rendering/Objects/VkSwapchain.hpp"
+#include "src/Builtin/Vulkan/Rendering/VkBindlessDescriptorSet.hpp"
 #include "src/Builtin/Vulkan/Rendering/VkMemoryAllocator.hpp"
 
 namespace Penrose {
 
     using VkImageInternal = std::tuple<vk::UniqueImage, vk::UniqueDeviceMemory, vk::UniqueImageView>;
+    using VkAliasedImageInternal = std::tuple<vk::UniqueImage, vk::UniqueImageView>;
+    using VkAliasedImageSet = std::tuple<vk::UniqueDeviceMemory, std::vector<VkAliasedImageInternal>>;
 
     class VkImageFactory final: public Resource<VkImageFactory>,
                                 public ImageFactory {
@@ -33,17 +37,25 @@ namespace Penrose {
         ) override;
 
         [[nodiscard]] VkImageInternal makeImage(const TargetInfo &target, const VkSwapchain &swapchain);
+        [[nodiscard]] VkAliasedImageSet makeAliasedImages(
+            const std::vector<TargetInfo> &targets, const VkSwapchain &swapchain
+        );
 
     private:
         ResourceProxy<VkPhysicalDeviceProvider> _physicalDeviceProvider;
         ResourceProxy<VkLogicalDeviceProvider> _logicalDeviceProvider;
         ResourceProxy<VkMemoryAllocator> _memoryAllocator;
         ResourceProxy<VkBufferFactory> _bufferFactory;
+        ResourceProxy<VkBindlessDescriptorSet> _bindlessDescriptorSet;
 
         [[nodiscard]] VkImageInternal makeImage(
             const vk::ImageCreateInfo &imageCreateInfo, vk::ImageViewCreateInfo imageViewCreateInfo
         );
 
+        [[nodiscard]] static std::tuple<vk::ImageCreateInfo, vk::ImageViewCreateInfo> makeTargetCreateInfo(
+            const TargetInfo &target, const VkSwapchain &swapchain
+        );
+
         vk::UniqueCommandPool _commandPool;
     };
 }
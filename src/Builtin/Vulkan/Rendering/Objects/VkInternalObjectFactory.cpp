@@ -1,31 +1,111 @@
 #include "VkInternalObjectFactory.hpp"
 
+#include <list>
+#include <map>
+#include <tuple>
+
 #include "src/Builtin/Vulkan/Rendering/VkUtils.hpp"
 
 namespace Penrose {
 
+    using DependencyKey = std::tuple<std::uint32_t, std::uint32_t>;
+
+    struct UsageAccess {
+        vk::PipelineStageFlags stage;
+        vk::AccessFlags access;
+        vk::AccessFlags writeAccess;
+    };
+
+    [[nodiscard]] constexpr UsageAccess mapUsageAccess(const TargetUsageFlags usage) {
+        auto result = UsageAccess {};
+
+        if (usage & TargetUsage::Input) {
+            result.stage |= vk::PipelineStageFlagBits::eFragmentShader;
+            result.access |= vk::AccessFlagBits::eInputAttachmentRead;
+        }
+
+        if (usage & TargetUsage::Color) {
+            result.stage |= vk::PipelineStageFlagBits::eColorAttachmentOutput;
+            result.access |= vk::AccessFlagBits::eColorAttachmentRead | vk::AccessFlagBits::eColorAttachmentWrite;
+            result.writeAccess |= vk::AccessFlagBits::eColorAttachmentWrite;
+        }
+
+        if (usage & TargetUsage::DepthStencil) {
+            result.stage |= vk::PipelineStageFlagBits::eEarlyFragmentTests
+                            | vk::PipelineStageFlagBits::eLateFragmentTests;
+            result.access |= vk::AccessFlagBits::eDepthStencilAttachmentRead
+                             | vk::AccessFlagBits::eDepthStencilAttachmentWrite;
+            result.writeAccess |= vk::AccessFlagBits::eDepthStencilAttachmentWrite;
+        }
+
+        return result;
+    }
+
     VkInternalObjectFactory::VkInternalObjectFactory(const ResourceSet *resources)
         : _logicalDeviceProvider(resources->get<VkLogicalDeviceProvider>()) {
         //
     }
 
-    vk::UniqueRenderPass VkInternalObjectFactory::makeRenderPass(const GraphInfo &graph, const VkSwapchain &swapchain) {
-        auto attachments = std::vector<vk::AttachmentDescription>(graph.attachments.size());
-        std::ranges::transform(graph.attachments, attachments.begin(), [&](const AttachmentInfo &attachment) {
-            return vk::AttachmentDescription()
-                .setFormat(mapRenderFormat(attachment.format, swapchain.format))
-                .setLoadOp(mapLoadOp(attachment.loadOp))
-                .setStoreOp(mapStoreOp(attachment.storeOp))
-                .setInitialLayout(mapLayout(attachment.initialLayout))
-                .setFinalLayout(mapLayout(attachment.finalLayout));
-        });
+    vk::UniqueRenderPass VkInternalObjectFactory::makeRenderPass(
+        const GraphInfo &graph, const CompiledGraph &compiled, const VkSwapchain &swapchain
+    ) {
+        const auto attachmentCount = static_cast<std::uint32_t>(graph.attachments.size());
+        const auto subpassCount = static_cast<std::uint32_t>(compiled.passes.size());
+
+        // transient attachments sharing alias slot inside one graph
+        auto slotUsers = std::vector<std::vector<std::uint32_t>>(compiled.aliasSlotCount);
+
+        for (std::uint32_t attachmentIdx = 0; attachmentIdx < attachmentCount; attachmentIdx++) {
+            const auto &aliasSlot = compiled.attachments.at(attachmentIdx).aliasSlot;
+
+            if (aliasSlot.has_value()) {
+                slotUsers[*aliasSlot].push_back(attachmentIdx);
+            }
+        }
+
+        auto attachments = std::vector<vk::AttachmentDescription>(attachmentCount);
+
+        for (std::uint32_t attachmentIdx = 0; attachmentIdx < attachmentCount; attachmentIdx++) {
+            const auto &attachment = graph.attachments.at(attachmentIdx);
+            const auto &aliasSlot = compiled.attachments.at(attachmentIdx).aliasSlot;
+
+            attachments[attachmentIdx] = vk::AttachmentDescription()
+                                             .setFormat(mapRenderFormat(attachment.format, swapchain.format))
+                                             .setLoadOp(mapLoadOp(attachment.loadOp))
+                                             .setStoreOp(mapStoreOp(attachment.storeOp))
+                                             .setInitialLayout(mapLayout(attachment.initialLayout))
+                                             .setFinalLayout(mapLayout(attachment.finalLayout));
+
+            if (aliasSlot.has_value() && slotUsers.at(*aliasSlot).size() > 1) {
+                attachments[attachmentIdx].setFlags(vk::AttachmentDescriptionFlagBits::eMayAlias);
+            }
+        }
 
         auto refsList = std::list<std::vector<vk::AttachmentReference>>();
-        auto subpasses = std::vector<vk::SubpassDescription>(graph.passes.size());
-        auto dependencies = std::vector<vk::SubpassDependency>();
+        auto subpasses = std::vector<vk::SubpassDescription>(subpassCount);
+        auto dependencies = std::map<DependencyKey, vk::SubpassDependency>();
+
+        const auto addDependency = [&](const std::uint32_t srcSubpass, const std::uint32_t dstSubpass,
+                                       const vk::PipelineStageFlags srcStage, const vk::AccessFlags srcAccess,
+                                       const vk::PipelineStageFlags dstStage, const vk::AccessFlags dstAccess) {
+            auto [it, inserted] = dependencies.try_emplace(
+                DependencyKey {srcSubpass, dstSubpass},
+                vk::SubpassDependency().setSrcSubpass(srcSubpass).setDstSubpass(dstSubpass)
+            );
+
+            it->second.srcStageMask |= srcStage;
+            it->second.srcAccessMask |= srcAccess;
+            it->second.dstStageMask |= dstStage;
+            it->second.dstAccessMask |= dstAccess;
+
+            if (inserted && srcSubpass != VK_SUBPASS_EXTERNAL && dstSubpass != VK_SUBPASS_EXTERNAL) {
+                it->second.dependencyFlags = vk::DependencyFlagBits::eByRegion;
+            }
+        };
 
-        for (std::uint32_t passIdx = 0; passIdx < graph.passes.size(); passIdx++) {
-            auto pass = graph.passes.at(passIdx);
+        for (std::uint32_t subpassIdx = 0; subpassIdx < subpassCount; subpassIdx++) {
+            const auto &compiledPass = compiled.passes.at(subpassIdx);
+            const auto &pass = graph.passes.at(compiledPass.passIdx);
 
             const auto inputCount = pass.inputTargets.size();
             const auto colorCount = pass.colorTargets.size();
@@ -51,52 +131,119 @@ namespace Penrose {
             }
 
             const auto ptr = refs.data();
-            subpasses[passIdx] = vk::SubpassDescription()
-                                     .setInputAttachmentCount(inputCount)
-                                     .setPInputAttachments(inputCount > 0 ? &ptr[0] : nullptr)
-                                     .setColorAttachmentCount(colorCount)
-                                     .setPColorAttachments(colorCount > 0 ? &ptr[inputCount] : nullptr)
-                                     .setPDepthStencilAttachment(
-                                         pass.depthStencilTarget.has_value() ? &ptr[inputCount + colorCount] : nullptr
-                                     );
-
-            if (!pass.dependsOn.empty()) {
-                std::ranges::for_each(pass.dependsOn, [&](const std::uint32_t &srcIdx) {
-                    dependencies.push_back(
-                        vk::SubpassDependency()
-                            .setSrcSubpass(srcIdx)
-                            .setDstSubpass(passIdx)
-                            .setSrcStageMask(vk::PipelineStageFlagBits::eColorAttachmentOutput)
-                            .setDstStageMask(vk::PipelineStageFlagBits::eColorAttachmentOutput)
-                            .setSrcAccessMask(
-                                vk::AccessFlagBits::eColorAttachmentWrite | vk::AccessFlagBits::eColorAttachmentRead
-                            )
-                            .setDstAccessMask(
-                                vk::AccessFlagBits::eColorAttachmentWrite | vk::AccessFlagBits::eColorAttachmentRead
-                            )
-                    );
-                });
-            } else {
-                dependencies.push_back(
-                    vk::SubpassDependency()
-                        .setSrcSubpass(VK_SUBPASS_EXTERNAL)
-                        .setDstSubpass(passIdx)
-                        .setSrcStageMask(vk::PipelineStageFlagBits::eColorAttachmentOutput)
-                        .setDstStageMask(vk::PipelineStageFlagBits::eColorAttachmentOutput)
-                        .setSrcAccessMask(
-                            vk::AccessFlagBits::eColorAttachmentWrite | vk::AccessFlagBits::eColorAttachmentRead
-                        )
-                        .setDstAccessMask(
-                            vk::AccessFlagBits::eColorAttachmentWrite | vk::AccessFlagBits::eColorAttachmentRead
-                        )
+            subpasses[subpassIdx] = vk::SubpassDescription()
+                                        .setInputAttachmentCount(inputCount)
+                                        .setPInputAttachments(inputCount > 0 ? &ptr[0] : nullptr)
+                                        .setColorAttachmentCount(colorCount)
+                                        .setPColorAttachments(colorCount > 0 ? &ptr[inputCount] : nullptr)
+                                        .setPDepthStencilAttachment(
+                                            pass.depthStencilTarget.has_value() ? &ptr[inputCount + colorCount]
+                                                                                : nullptr
+                                        )
+                                        .setPreserveAttachments(compiledPass.preserveAttachments);
+
+            for (std::uint32_t attachmentIdx = 0; attachmentIdx < attachmentCount; attachmentIdx++) {
+                const auto usage = compiledPass.usages.at(attachmentIdx);
+
+                if (usage == 0) {
+                    continue;
+                }
+
+                const auto &attachment = compiled.attachments.at(attachmentIdx);
+                const auto dst = mapUsageAccess(usage);
+
+                // hazard on previous use of same attachment inside graph
+                if (*attachment.firstSubpass != subpassIdx) {
+                    auto prevSubpassIdx = subpassIdx - 1;
+
+                    while (compiled.passes.at(prevSubpassIdx).usages.at(attachmentIdx) == 0) {
+                        prevSubpassIdx--;
+                    }
+
+                    const auto src = mapUsageAccess(compiled.passes.at(prevSubpassIdx).usages.at(attachmentIdx));
+
+                    // read after read in same layout requires nothing
+                    if (src.writeAccess || dst.writeAccess) {
+                        addDependency(prevSubpassIdx, subpassIdx, src.stage, src.writeAccess, dst.stage, dst.access);
+                    }
+
+                    continue;
+                }
+
+                // hazard on previous attachment aliased into same memory inside graph
+                std::optional<std::uint32_t> aliasedIdx;
+
+                if (attachment.aliasSlot.has_value()) {
+                    for (const auto &otherIdx: slotUsers.at(*attachment.aliasSlot)) {
+                        const auto &other = compiled.attachments.at(otherIdx);
+
+                        if (*other.lastSubpass < subpassIdx
+                            && (!aliasedIdx.has_value()
+                                || *compiled.attachments.at(*aliasedIdx).lastSubpass < *other.lastSubpass)) {
+                            aliasedIdx = otherIdx;
+                        }
+                    }
+                }
+
+                if (aliasedIdx.has_value()) {
+                    const auto aliasedSubpassIdx = *compiled.attachments.at(*aliasedIdx).lastSubpass;
+                    const auto src = mapUsageAccess(compiled.passes.at(aliasedSubpassIdx).usages.at(*aliasedIdx));
+
+                    addDependency(aliasedSubpassIdx, subpassIdx, src.stage, src.writeAccess, dst.stage, dst.access);
+
+                    continue;
+                }
+
+                // first use inside graph waits for writes of previous graphs and swapchain acquire
+                auto srcStage = vk::PipelineStageFlags(vk::PipelineStageFlagBits::eColorAttachmentOutput)
+                                | vk::PipelineStageFlagBits::eLateFragmentTests;
+
+                if (attachment.transient) {
+                    srcStage |= vk::PipelineStageFlagBits::eFragmentShader;
+                }
+
+                addDependency(
+                    VK_SUBPASS_EXTERNAL, subpassIdx, srcStage,
+                    vk::AccessFlagBits::eColorAttachmentWrite | vk::AccessFlagBits::eDepthStencilAttachmentWrite,
+                    dst.stage, dst.access
                 );
             }
         }
 
+        // stored attachments are made visible to sampling and transfers after graph
+        for (std::uint32_t attachmentIdx = 0; attachmentIdx < attachmentCount; attachmentIdx++) {
+            const auto &info = graph.attachments.at(attachmentIdx);
+            const auto &attachment = compiled.attachments.at(attachmentIdx);
+
+            if (!attachment.lastSubpass.has_value() || info.storeOp != AttachmentStoreOp::Store
+                || info.finalLayout == AttachmentLayout::Present) {
+                continue;
+            }
+
+            const auto src = mapUsageAccess(compiled.passes.at(*attachment.lastSubpass).usages.at(attachmentIdx));
+
+            if (!src.writeAccess) {
+                continue;
+            }
+
+            addDependency(
+                *attachment.lastSubpass, VK_SUBPASS_EXTERNAL, src.stage, src.writeAccess,
+                vk::PipelineStageFlagBits::eFragmentShader | vk::PipelineStageFlagBits::eTransfer,
+                vk::AccessFlagBits::eShaderRead | vk::AccessFlagBits::eTransferRead
+            );
+        }
+
+        auto dependencyList = std::vector<vk::SubpassDependency>();
+        dependencyList.reserve(dependencies.size());
+
+        std::ranges::transform(dependencies, std::back_inserter(dependencyList), [](const auto &entry) {
+            return entry.second;
+        });
+
         const auto createInfo = vk::RenderPassCreateInfo()
                                     .setAttachments(attachments)
                                     .setSubpasses(subpasses)
-                                    .setDependencies(dependencies);
+                                    .setDependencies(dependencyList);
 
         return this->_logicalDeviceProvider->getLogicalDevice().handle->createRenderPassUnique(createInfo);
     }
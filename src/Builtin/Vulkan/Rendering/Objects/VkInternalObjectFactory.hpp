@@ -10,6 +10,8 @@
 #include <Penrose/Resources/Resource.hpp>
 #include <Penrose/Resources/ResourceSet.hpp>
 
+#include "src/Rendering/Graph/GraphCompiler.hpp"
+
 #include "src/Builtin/Vulkan/Rendering/Objects/VkLogicalDeviceProvider.hpp"
 #include "src/Builtin/Vulkan/Rendering/Objects/VkSwapchain.hpp"
 
@@ -20,7 +22,9 @@ namespace Penrose {
         explicit VkInternalObjectFactory(const ResourceSet *resources);
         ~VkInternalObjectFactory() override = default;
 
-        [[nodiscard]] vk::UniqueRenderPass makeRenderPass(const GraphInfo &graph, const VkSwapchain &swapchain);
+        [[nodiscard]] vk::UniqueRenderPass makeRenderPass(
+            const GraphInfo &graph, const CompiledGraph &compiled, const VkSwapchain &swapchain
+        );
         [[nodiscard]] vk::UniqueFramebuffer makeFramebuffer(
             const vk::RenderPass &renderPass, const std::vector<vk::ImageView> &imageViews, std::uint32_t width,
             std::uint32_t height
@@ -38,10 +38,26 @@ namespace Penrose {
             [](const std::string_view &extension) { return extension.data(); }
         );
 
+        auto descriptorIndexingFeatures = vk::PhysicalDeviceDescriptorIndexingFeatures()
+                                              .setRuntimeDescriptorArray(true)
+                                              .setDescriptorBindingPartiallyBound(true)
+                                              .setDescriptorBindingUpdateUnusedWhilePending(true)
+                                              .setDescriptorBindingSampledImageUpdateAfterBind(true)
+                                              .setDescriptorBindingStorageBufferUpdateAfterBind(true)
+                                              .setShaderSampledImageArrayNonUniformIndexing(true);
+
+        const auto timelineSemaphoreFeatures = vk::PhysicalDeviceTimelineSemaphoreFeatures()
+                                                   .setTimelineSemaphore(true)
+                                                   .setPNext(
+                                                       physicalDevice.descriptorIndexing ? &descriptorIndexingFeatures
+                                                                                         : nullptr
+                                                   );
+
         const auto createInfo = vk::DeviceCreateInfo()
                                     .setQueueCreateInfos(queueCreateInfos)
                                     .setPEnabledFeatures(&enabledFeatures)
-                                    .setPEnabledExtensionNames(enabledExtensions);
+                                    .setPEnabledExtensionNames(enabledExtensions)
+                                    .setPNext(&timelineSemaphoreFeatures);
 
         auto handle = physicalDevice.handle.createDeviceUnique(createInfo);
 
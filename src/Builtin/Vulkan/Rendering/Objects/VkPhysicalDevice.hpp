@@ -18,6 +18,8 @@ namespace Penrose {
         std::uint32_t presentFamilyIdx;
         std::vector<std::string> extensions;
         std::uint32_t priority;
+        bool descriptorIndexing;
+        std::uint32_t timestampValidBits;
     };
 }
 
@@ -3,6 +3,7 @@
 #include <string_view>
 
 #include <Penrose/Common/EngineError.hpp>
+#include <Penrose/Rendering/OffscreenSurface.hpp>
 #include <Penrose/Utils/CollectionUtils.hpp>
 
 #include "src/Builtin/Vulkan/Constants.hpp"
@@ -27,7 +28,12 @@ namespace Penrose {
 
     VkPhysicalDevice VkPhysicalDeviceSelector::selectPhysicalDevice() {
         const auto devices = this->_vulkanBackend->getInstance().enumeratePhysicalDevices();
-        const auto surface = this->_vkSurfaceProvider->getVkSurfaceFor(this->_surfaceManager->getSurface().get());
+        const auto managedSurface = this->_surfaceManager->getSurface();
+
+        // offscreen surfaces are never presented, so any graphics queue fits for presentation
+        const auto surface = dynamic_cast<OffscreenSurface *>(managedSurface.get()) == nullptr
+                                 ? this->_vkSurfaceProvider->getVkSurfaceFor(managedSurface.get())
+                                 : vk::SurfaceKHR();
 
         std::vector<VkPhysicalDevice> availableDevices;
 
@@ -85,7 +91,10 @@ namespace Penrose {
                 transferIdx = idx;
             }
 
-            if (!presentIdx.has_value() && device.getSurfaceSupportKHR(idx, surface)) {
+            const auto presentSupported = surface ? device.getSurfaceSupportKHR(idx, surface) == VK_TRUE
+                                                  : graphicsIdx == idx;
+
+            if (!presentIdx.has_value() && presentSupported) {
                 presentIdx = idx;
             }
 
@@ -104,6 +113,9 @@ namespace Penrose {
         }
 
         deviceInfo.graphicsFamilyIdx = *graphicsIdx;
+        deviceInfo.timestampValidBits = deviceInfo.properties.limits.timestampPeriod > 0
+                                            ? queueFamilyProperties[*graphicsIdx].timestampValidBits
+                                            : 0;
         deviceInfo.transferFamilyIdx = *transferIdx;
         deviceInfo.presentFamilyIdx = *presentIdx;
 
@@ -133,6 +145,28 @@ namespace Penrose {
             return std::nullopt;
         }
 
+        const auto features = device.getFeatures2<
+            vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceDescriptorIndexingFeatures,
+            vk::PhysicalDeviceTimelineSemaphoreFeatures>();
+
+        if (!features.get<vk::PhysicalDeviceTimelineSemaphoreFeatures>().timelineSemaphore) {
+            this->_log->writeDebug(
+                TAG, "Device {} discarded: timeline semaphores are not supported",
+                static_cast<const char *>(deviceInfo.properties.deviceName)
+            );
+
+            return std::nullopt;
+        }
+
+        const auto &descriptorIndexingFeatures = features.get<vk::PhysicalDeviceDescriptorIndexingFeatures>();
+
+        deviceInfo.descriptorIndexing = descriptorIndexingFeatures.runtimeDescriptorArray
+                                        && descriptorIndexingFeatures.descriptorBindingPartiallyBound
+                                        && descriptorIndexingFeatures.descriptorBindingUpdateUnusedWhilePending
+                                        && descriptorIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind
+                                        && descriptorIndexingFeatures.descriptorBindingStorageBufferUpdateAfterBind
+                                        && descriptorIndexingFeatures.shaderSampledImageArrayNonUniformIndexing;
+
         for (std::uint32_t priorityIdx = 0; priorityIdx < DEVICE_PRIORITY.size(); ++priorityIdx) {
             if (deviceInfo.properties.deviceType == DEVICE_PRIORITY.at(priorityIdx)) {
                 deviceInfo.priority = priorityIdx;
@@ -1,35 +1,55 @@
 #include "VkPipelineFactory.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <future>
+#include <thread>
 
 #include <Penrose/Assets/ShaderAsset.hpp>
 
 #include "src/Builtin/Vulkan/Rendering/VkUtils.hpp"
+#include "src/Rendering/PipelineCacheFile.hpp"
 
 namespace Penrose {
 
     inline static constexpr std::string_view TAG = "VkPipelineFactory";
 
     inline static constexpr std::string_view PIPELINE_CACHE_FILENAME = ".vk-pipeline-cache";
+    inline static constexpr std::string_view PIPELINE_CACHE_TEMP_FILENAME = ".vk-pipeline-cache.tmp";
+
+    [[nodiscard]] PipelineCacheDevice makePipelineCacheDevice(const vk::PhysicalDeviceProperties &properties) {
+        auto device = PipelineCacheDevice {
+            .vendorId = properties.vendorID,
+            .deviceId = properties.deviceID,
+            .driverVersion = properties.driverVersion,
+            .cacheUuid = {},
+        };
+
+        static_assert(std::tuple_size_v<decltype(device.cacheUuid)> == VK_UUID_SIZE);
+        std::ranges::copy(properties.pipelineCacheUUID, device.cacheUuid.begin());
+
+        return device;
+    }
 
     VkPipelineFactory::VkPipelineFactory(const ResourceSet *resources)
         : _log(resources->get<Log>()),
           _assetManager(resources->get<AssetManager>()),
-          _logicalDeviceProvider(resources->get<VkLogicalDeviceProvider>()) {
+          _physicalDeviceProvider(resources->get<VkPhysicalDeviceProvider>()),
+          _logicalDeviceProvider(resources->get<VkLogicalDeviceProvider>()),
+          _bindlessDescriptorSet(resources->get<VkBindlessDescriptorSet>()) {
         //
     }
 
     void VkPipelineFactory::init() {
-        auto createInfo = vk::PipelineCacheCreateInfo();
+        const auto data = this->loadCache();
 
-        std::vector<char> data;
-        auto stream = std::ifstream(std::filesystem::path(PIPELINE_CACHE_FILENAME), std::ios::in | std::ios::binary);
-
-        if (stream.is_open() && stream.good()) {
-            std::copy(std::istream_iterator<char>(stream), std::istream_iterator<char>(), std::back_inserter(data));
+        auto createInfo = vk::PipelineCacheCreateInfo();
 
+        if (!data.empty()) {
             createInfo = createInfo.setPInitialData(data.data()).setInitialDataSize(data.size());
         }
 
@@ -37,23 +57,91 @@ namespace Penrose {
     }
 
     void VkPipelineFactory::destroy() {
-        auto &device = this->_logicalDeviceProvider->getLogicalDevice().handle;
+        this->saveCache();
+
+        this->_cache.reset();
+    }
 
-        const auto data = device->getPipelineCacheData(this->_cache.get());
-        auto stream = std::ofstream(
-            std::filesystem::path(PIPELINE_CACHE_FILENAME), std::ios::out | std::ios::binary | std::ios::trunc
+    void VkPipelineFactory::saveCache() {
+        if (!this->_cache) {
+            return;
+        }
+
+        const auto data = this->_logicalDeviceProvider->getLogicalDevice().handle->getPipelineCacheData(
+            this->_cache.get()
         );
 
-        if (stream.is_open() && stream.good()) {
-            std::ranges::copy(std::as_const(data), std::ostream_iterator<char>(stream));
+        // cache is written into temporary file first, so interrupted write never leaves truncated cache behind
+        {
+            auto stream = std::ofstream(
+                std::filesystem::path(PIPELINE_CACHE_TEMP_FILENAME), std::ios::out | std::ios::binary | std::ios::trunc
+            );
+
+            PipelineCacheFile::write(
+                stream, makePipelineCacheDevice(this->_physicalDeviceProvider->getPhysicalDevice().properties),
+                reinterpret_cast<const std::byte *>(data.data()), data.size()
+            );
+
+            if (!stream.good()) {
+                this->_log->writeWarning(TAG, "Failed to write pipeline cache, serialization skipped");
+
+                return;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(PIPELINE_CACHE_TEMP_FILENAME, PIPELINE_CACHE_FILENAME, error);
+
+        if (error) {
+            this->_log->writeWarning(TAG, "Failed to replace pipeline cache: {}", error.message());
         } else {
-            this->_log->writeWarning(TAG, "Failed to write pipeline cache, serialization skipped");
+            this->_log->writeDebug(TAG, "Pipeline cache saved, {} byte(s)", data.size());
         }
+    }
 
-        this->_cache.reset();
+    std::vector<std::byte> VkPipelineFactory::loadCache() const {
+        auto stream = std::ifstream(std::filesystem::path(PIPELINE_CACHE_FILENAME), std::ios::in | std::ios::binary);
+
+        if (!stream.is_open()) {
+            return {};
+        }
+
+        auto data = std::vector<std::byte>();
+        const auto status = PipelineCacheFile::read(
+            stream, makePipelineCacheDevice(this->_physicalDeviceProvider->getPhysicalDevice().properties), data
+        );
+
+        switch (status) {
+            case PipelineCacheStatus::Loaded:
+                break;
+
+            case PipelineCacheStatus::Truncated:
+                this->_log->writeWarning(TAG, "Pipeline cache is discarded: header is truncated");
+                return {};
+
+            case PipelineCacheStatus::UnknownFormat:
+                this->_log->writeWarning(TAG, "Pipeline cache is discarded: unknown format");
+                return {};
+
+            case PipelineCacheStatus::OtherDevice:
+                this->_log->writeInfo(TAG, "Pipeline cache is discarded: it was created for another device or driver");
+                return {};
+
+            case PipelineCacheStatus::Corrupted:
+                this->_log->writeWarning(TAG, "Pipeline cache is discarded: data is corrupted");
+                return {};
+        }
+
+        this->_log->writeDebug(TAG, "Pipeline cache loaded, {} byte(s)", data.size());
+
+        return data;
     }
 
     Pipeline *VkPipelineFactory::makePipeline(PipelineInfo &&pipelineInfo) {
+        if (pipelineInfo.bindless && !this->_bindlessDescriptorSet->isSupported()) {
+            throw EngineError("Pipeline {} requires bindless descriptors, which are not supported", pipelineInfo.name);
+        }
+
         auto &device = this->_logicalDeviceProvider->getLogicalDevice().handle;
 
         auto descriptorBindings = std::vector<vk::DescriptorSetLayoutBinding>(pipelineInfo.objects.size());
@@ -78,9 +166,17 @@ namespace Penrose {
         const auto descriptorSetLayoutCreateInfo = vk::DescriptorSetLayoutCreateInfo().setBindings(descriptorBindings);
         auto descriptorSetLayout = device->createDescriptorSetLayoutUnique(descriptorSetLayoutCreateInfo);
 
+        auto setLayouts = std::vector<vk::DescriptorSetLayout>();
+
+        if (pipelineInfo.bindless) {
+            setLayouts.push_back(this->_bindlessDescriptorSet->getLayoutHandle());
+        }
+
+        setLayouts.push_back(descriptorSetLayout.get());
+
         const auto pipelineLayoutCreateInfo = vk::PipelineLayoutCreateInfo()
                                                   .setPushConstantRanges(constants)
-                                                  .setSetLayouts(descriptorSetLayout.get());
+                                                  .setSetLayouts(setLayouts);
         auto pipelineLayout = device->createPipelineLayoutUnique(pipelineLayoutCreateInfo);
 
         std::vector<vk::VertexInputBindingDescription> bindings;
@@ -156,6 +252,77 @@ namespace Penrose {
     VkPipelineInstance *VkPipelineFactory::makePipelineInstance(
         const VkPipeline *pipeline, const vk::RenderPass pass, const std::uint32_t subpass
     ) {
+        const auto request = VkPipelineInstanceRequest {pipeline, pass, subpass};
+        auto handle = this->compile(request, this->makeShaderStages(pipeline));
+
+        return new VkPipelineInstance(pipeline, pass, subpass, std::move(handle));
+    }
+
+    std::vector<VkPipelineInstance *> VkPipelineFactory::makePipelineInstances(
+        const std::vector<VkPipelineInstanceRequest> &requests
+    ) {
+        if (requests.empty()) {
+            return {};
+        }
+
+        // shaders are resolved on calling thread, only compilation itself is spread across workers
+        auto shaderStages = std::vector<std::vector<vk::PipelineShaderStageCreateInfo>>();
+        shaderStages.reserve(requests.size());
+
+        for (const auto &request: requests) {
+            shaderStages.push_back(this->makeShaderStages(request.pipeline));
+        }
+
+        auto handles = std::vector<vk::UniquePipeline>(requests.size());
+        auto nextIdx = std::atomic_size_t(0);
+
+        const auto workerCount = std::min<std::size_t>(
+            std::max<std::size_t>(std::thread::hardware_concurrency(), 1), requests.size()
+        );
+
+        auto workers = std::vector<std::future<void>>();
+        workers.reserve(workerCount);
+
+        for (std::size_t workerIdx = 0; workerIdx < workerCount; workerIdx++) {
+            workers.push_back(std::async(std::launch::async, [&] {
+                for (auto idx = nextIdx++; idx < requests.size(); idx = nextIdx++) {
+                    handles.at(idx) = this->compile(requests.at(idx), shaderStages.at(idx));
+                }
+            }));
+        }
+
+        // every worker is awaited before error is rethrown, because workers reference local state
+        std::exception_ptr error;
+
+        for (auto &worker: workers) {
+            try {
+                worker.get();
+            } catch (...) {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        auto instances = std::vector<VkPipelineInstance *>();
+        instances.reserve(requests.size());
+
+        for (std::size_t idx = 0; idx < requests.size(); idx++) {
+            const auto &request = requests.at(idx);
+
+            instances.push_back(
+                new VkPipelineInstance(request.pipeline, request.pass, request.subpass, std::move(handles.at(idx)))
+            );
+        }
+
+        return instances;
+    }
+
+    std::vector<vk::PipelineShaderStageCreateInfo> VkPipelineFactory::makeShaderStages(const VkPipeline *pipeline) {
         std::vector<vk::PipelineShaderStageCreateInfo> shaderStages;
 
         for (const auto &pipelineShader: pipeline->getPipelineInfo().shaders) {
@@ -167,6 +334,14 @@ namespace Penrose {
                                           .setPName("main"));
         }
 
+        return shaderStages;
+    }
+
+    vk::UniquePipeline VkPipelineFactory::compile(
+        const VkPipelineInstanceRequest &request, const std::vector<vk::PipelineShaderStageCreateInfo> &shaderStages
+    ) {
+        const auto pipeline = request.pipeline;
+
         const auto vertexInputState = vk::PipelineVertexInputStateCreateInfo()
                                           .setVertexBindingDescriptions(pipeline->getVertexInputBindings())
                                           .setVertexAttributeDescriptions(pipeline->getVertexInputAttributes());
@@ -177,8 +352,8 @@ namespace Penrose {
         const auto dynamicState = vk::PipelineDynamicStateCreateInfo().setDynamicStates(pipeline->getDynamicStates());
 
         const auto createInfo = vk::GraphicsPipelineCreateInfo()
-                                    .setRenderPass(pass)
-                                    .setSubpass(subpass)
+                                    .setRenderPass(request.pass)
+                                    .setSubpass(request.subpass)
                                     .setLayout(pipeline->getPipelineLayoutHandle())
                                     .setStages(shaderStages)
                                     .setPVertexInputState(&vertexInputState)
@@ -190,6 +365,7 @@ namespace Penrose {
                                     .setPColorBlendState(&colorBlendState)
                                     .setPDynamicState(&dynamicState);
 
+        // pipeline cache is internally synchronized, so it is shared by concurrent compilations
         auto [result, handle] = this->_logicalDeviceProvider->getLogicalDevice().handle->createGraphicsPipelineUnique(
             this->_cache.get(), createInfo
         );
@@ -201,6 +377,6 @@ namespace Penrose {
             );
         }
 
-        return new VkPipelineInstance(pipeline, pass, subpass, std::move(handle));
+        return std::move(handle);
     }
 }
@@ -1,6 +1,9 @@
 #ifndef PENROSE_BUILTIN_VULKAN_RENDERING_OBJECTS_VK_PIPELINE_FACTORY_HPP
 #define PENROSE_BUILTIN_VULKAN_RENDERING_OBJECTS_VK_PIPELINE_FACTORY_HPP
 
+#include <cstdint>
+#include <vector>
+
 #include <Penrose/Assets/AssetManager.hpp>
 #include <Penrose/Common/Log.hpp>
 #include <Penrose/Rendering/Objects/PipelineFactory.hpp>
@@ -8,11 +11,19 @@
 #include <Penrose/Resources/ResourceSet.hpp>
 
 #include "src/Builtin/Vulkan/Rendering/Objects/VkLogicalDeviceProvider.hpp"
+#include "src/Builtin/Vulkan/Rendering/Objects/VkPhysicalDeviceProvider.hpp"
 #include "src/Builtin/Vulkan/Rendering/Objects/VkPipeline.hpp"
 #include "src/Builtin/Vulkan/Rendering/Objects/VkPipelineInstance.hpp"
+#include "src/Builtin/Vulkan/Rendering/VkBindlessDescriptorSet.hpp"
 
 namespace Penrose {
 
+    struct VkPipelineInstanceRequest {
+        const VkPipeline *pipeline;
+        vk::RenderPass pass;
+        std::uint32_t subpass;
+    };
+
     class VkPipelineFactory final: public Resource<VkPipelineFactory>,
                                    public PipelineFactory {
     public:
@@ -28,12 +39,28 @@ namespace Penrose {
             const VkPipeline *pipeline, vk::RenderPass pass, std::uint32_t subpass
         );
 
+        [[nodiscard]] std::vector<VkPipelineInstance *> makePipelineInstances(
+            const std::vector<VkPipelineInstanceRequest> &requests
+        );
+
+        void saveCache();
+
     private:
         ResourceProxy<Log> _log;
         ResourceProxy<AssetManager> _assetManager;
+        ResourceProxy<VkPhysicalDeviceProvider> _physicalDeviceProvider;
         ResourceProxy<VkLogicalDeviceProvider> _logicalDeviceProvider;
+        ResourceProxy<VkBindlessDescriptorSet> _bindlessDescriptorSet;
 
         vk::UniquePipelineCache _cache;
+
+        [[nodiscard]] std::vector<std::byte> loadCache() const;
+
+        [[nodiscard]] std::vector<vk::PipelineShaderStageCreateInfo> makeShaderStages(const VkPipeline *pipeline);
+
+        [[nodiscard]] vk::UniquePipeline compile(
+            const VkPipelineInstanceRequest &request, const std::vector<vk::PipelineShaderStageCreateInfo> &shaderStages
+        );
     };
 }
 
@@ -5,23 +5,28 @@
 
 #include <Penrose/Rendering/Objects/Sampler.hpp>
 
+#include "src/Builtin/Vulkan/Rendering/VkBindlessDescriptorSet.hpp"
+
 namespace Penrose {
 
     class VkSampler final: public Sampler {
     public:
         VkSampler(
             const SamplerAddressMode addressMode, const SamplerFilteringMode minFilter,
-            const SamplerFilteringMode magFilter, const SamplerBorderColor borderColor, vk::UniqueSampler &&sampler
+            const SamplerFilteringMode magFilter, const SamplerBorderColor borderColor, vk::UniqueSampler &&sampler,
+            VkBindlessSlot &&bindlessSlot
         )
             : _addressMode(addressMode),
               _minFilter(minFilter),
               _magFilter(magFilter),
               _borderColor(borderColor),
-              _sampler(std::forward<decltype(sampler)>(sampler)) {
+              _sampler(std::forward<decltype(sampler)>(sampler)),
+              _bindlessSlot(std::forward<decltype(bindlessSlot)>(bindlessSlot)) {
             //
         }
 
-        ~VkSampler() override = default;
+        // sampler could be still read by frames in flight through bindless descriptor
+        ~VkSampler() override { this->_bindlessSlot.retire(std::move(this->_sampler)); }
 
         [[nodiscard]] SamplerAddressMode getAddressMode() const override { return this->_addressMode; }
 
@@ -31,6 +36,8 @@ namespace Penrose {
 
         [[nodiscard]] SamplerBorderColor getBorderColor() const override { return this->_borderColor; }
 
+        [[nodiscard]] std::uint32_t getBindlessIndex() const override { return this->_bindlessSlot.getIndex(); }
+
         [[nodiscard]] const vk::Sampler &getHandle() const { return this->_sampler.get(); }
 
     private:
@@ -40,6 +47,8 @@ namespace Penrose {
         SamplerBorderColor _borderColor;
 
         vk::UniqueSampler _sampler;
+
+        VkBindlessSlot _bindlessSlot;
     };
 }
 
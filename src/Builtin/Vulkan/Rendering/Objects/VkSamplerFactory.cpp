@@ -6,7 +6,8 @@
 namespace Penrose {
 
     VkSamplerFactory::VkSamplerFactory(const ResourceSet *resources)
-        : _logicalDeviceProvider(resources->get<VkLogicalDeviceProvider>()) {
+        : _logicalDeviceProvider(resources->get<VkLogicalDeviceProvider>()),
+          _bindlessDescriptorSet(resources->get<VkBindlessDescriptorSet>()) {
         //
     }
 
@@ -32,7 +33,10 @@ namespace Penrose {
                                     .setMipmapMode(vk::SamplerMipmapMode::eLinear);
 
         auto sampler = this->_logicalDeviceProvider->getLogicalDevice().handle->createSamplerUnique(createInfo);
+        auto bindlessSlot = this->_bindlessDescriptorSet->registerSampler(sampler.get());
 
-        return new VkSampler(addressMode, minFilter, magFilter, borderColor, std::move(sampler));
+        return new VkSampler(
+            addressMode, minFilter, magFilter, borderColor, std::move(sampler), std::move(bindlessSlot)
+        );
     }
 }
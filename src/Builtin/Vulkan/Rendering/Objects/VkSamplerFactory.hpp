@@ -6,6 +6,7 @@
 #include <Penrose/Resources/ResourceSet.hpp>
 
 #include "src/Builtin/Vulkan/Rendering/Objects/VkLogicalDeviceProvider.hpp"
+#include "src/Builtin/Vulkan/Rendering/VkBindlessDescriptorSet.hpp"
 
 namespace Penrose {
 
@@ -22,6 +23,7 @@ namespace Penrose {
 
     private:
         ResourceProxy<VkLogicalDeviceProvider> _logicalDeviceProvider;
+        ResourceProxy<VkBindlessDescriptorSet> _bindlessDescriptorSet;
     };
 }
 
@@ -2,6 +2,7 @@
 #define PENROSE_BUILTIN_VULKAN_RENDERING_OBJECTS_VK_SWAPCHAIN_HPP
 
 #include <memory>
+#include <vector>
 
 #include <vulkan/vulkan.hpp>
 
@@ -13,7 +14,14 @@ namespace Penrose {
         std::shared_ptr<Surface> surface;
         vk::Extent2D extent;
         vk::Format format;
+
+        // offscreen surfaces are rendered into owned images instead of swapchain images
+        bool offscreen = false;
         vk::UniqueSwapchainKHR handle;
+        std::vector<vk::UniqueDeviceMemory> offscreenImageMemory;
+        std::vector<vk::UniqueImage> offscreenImages;
+
+        std::vector<vk::Image> images;
         std::vector<vk::UniqueImageView> imageViews;
     };
 }
@@ -1,17 +1,26 @@
 #include "VkSwapchainFactory.hpp"
 
+#include <Penrose/Rendering/OffscreenSurface.hpp>
+
 namespace Penrose {
 
     VkSwapchainFactory::VkSwapchainFactory(const ResourceSet *resources)
         : _logicalDeviceProvider(resources->get<VkLogicalDeviceProvider>()),
           _surfaceProvider(resources->get<VkSurfaceProvider>()),
-          _surfacePreferencesProvider(resources->get<VkSurfacePreferencesProvider>()) {
+          _surfacePreferencesProvider(resources->get<VkSurfacePreferencesProvider>()),
+          _memoryAllocator(resources->get<VkMemoryAllocator>()) {
         //
     }
 
-    VkSwapchain VkSwapchainFactory::makeSwapchain(const std::shared_ptr<Surface> &surface) {
+    VkSwapchain VkSwapchainFactory::makeSwapchain(
+        const std::shared_ptr<Surface> &surface, const FramePacingMode pacingMode
+    ) {
+        if (dynamic_cast<OffscreenSurface *>(surface.get()) != nullptr) {
+            return this->makeOffscreenSwapchain(surface);
+        }
+
         const auto vkSurface = this->_surfaceProvider->getVkSurfaceFor(surface.get());
-        const auto preferences = this->_surfacePreferencesProvider->getPreferencesFor(surface, vkSurface);
+        const auto preferences = this->_surfacePreferencesProvider->getPreferencesFor(surface, vkSurface, pacingMode);
 
         const auto swapchainCreateInfo = vk::SwapchainCreateInfoKHR()
                                              .setSurface(vkSurface)
@@ -26,11 +35,16 @@ namespace Penrose {
         return this->makeSwapchain(surface, swapchainCreateInfo);
     }
 
-    VkSwapchain VkSwapchainFactory::makeSwapchain(const VkSwapchain &oldSwapchain) {
+    VkSwapchain VkSwapchainFactory::makeSwapchain(const VkSwapchain &oldSwapchain, const FramePacingMode pacingMode) {
+        if (oldSwapchain.offscreen) {
+            return this->makeOffscreenSwapchain(oldSwapchain.surface);
+        }
+
         const auto vkSurface = this->_surfaceProvider->getVkSurfaceFor(oldSwapchain.surface.get());
         const auto [extent, format, colorSpace, imageCount, presentMode] = this->_surfacePreferencesProvider
                                                                                ->getPreferencesFor(
-                                                                                   oldSwapchain.surface, vkSurface
+                                                                                   oldSwapchain.surface, vkSurface,
+                                                                                   pacingMode
                                                                                );
 
         const auto swapchainCreateInfo = vk::SwapchainCreateInfoKHR()
@@ -55,6 +69,76 @@ namespace Penrose {
         auto swapchain = device->createSwapchainKHRUnique(swapchainCreateInfo);
         const auto images = device->getSwapchainImagesKHR(swapchain.get());
 
+        auto imageViews = this->makeImageViews(images, swapchainCreateInfo.imageFormat);
+
+        return VkSwapchain {
+            .surface = surface,
+            .extent = swapchainCreateInfo.imageExtent,
+            .format = swapchainCreateInfo.imageFormat,
+            .offscreen = false,
+            .handle = std::move(swapchain),
+            .offscreenImageMemory = {},
+            .offscreenImages = {},
+            .images = images,
+            .imageViews = std::move(imageViews),
+        };
+    }
+
+    VkSwapchain VkSwapchainFactory::makeOffscreenSwapchain(const std::shared_ptr<Surface> &surface) {
+        auto &device = this->_logicalDeviceProvider->getLogicalDevice().handle;
+
+        const auto offscreenSurface = dynamic_cast<OffscreenSurface *>(surface.get());
+        const auto [width, height] = offscreenSurface->getSize();
+        const auto extent = vk::Extent2D(width, height);
+        constexpr auto format = vk::Format::eR8G8B8A8Unorm;
+
+        const auto imageCreateInfo = vk::ImageCreateInfo()
+                                         .setImageType(vk::ImageType::e2D)
+                                         .setFormat(format)
+                                         .setExtent(vk::Extent3D(extent, 1))
+                                         .setMipLevels(1)
+                                         .setArrayLayers(1)
+                                         .setSamples(vk::SampleCountFlagBits::e1)
+                                         .setTiling(vk::ImageTiling::eOptimal)
+                                         .setUsage(
+                                             vk::ImageUsageFlagBits::eColorAttachment
+                                             | vk::ImageUsageFlagBits::eTransferSrc
+                                         )
+                                         .setSharingMode(vk::SharingMode::eExclusive)
+                                         .setInitialLayout(vk::ImageLayout::eUndefined);
+
+        std::vector<vk::Image> images;
+        std::vector<vk::UniqueImage> offscreenImages;
+        std::vector<vk::UniqueDeviceMemory> offscreenImageMemory;
+
+        for (std::uint32_t imageIdx = 0; imageIdx < offscreenSurface->getImageCount(); imageIdx++) {
+            auto image = device->createImageUnique(imageCreateInfo);
+
+            images.push_back(image.get());
+            offscreenImageMemory.push_back(this->_memoryAllocator->allocateImage(image.get()));
+            offscreenImages.push_back(std::move(image));
+        }
+
+        auto imageViews = this->makeImageViews(images, format);
+
+        return VkSwapchain {
+            .surface = surface,
+            .extent = extent,
+            .format = format,
+            .offscreen = true,
+            .handle = {},
+            .offscreenImageMemory = std::move(offscreenImageMemory),
+            .offscreenImages = std::move(offscreenImages),
+            .images = std::move(images),
+            .imageViews = std::move(imageViews),
+        };
+    }
+
+    std::vector<vk::UniqueImageView> VkSwapchainFactory::makeImageViews(
+        const std::vector<vk::Image> &images, const vk::Format format
+    ) {
+        auto &device = this->_logicalDeviceProvider->getLogicalDevice().handle;
+
         constexpr auto imageSubresourceRange = vk::ImageSubresourceRange()
                                                    .setAspectMask(vk::ImageAspectFlagBits::eColor)
                                                    .setBaseMipLevel(0)
@@ -63,7 +147,7 @@ namespace Penrose {
                                                    .setLayerCount(1);
 
         auto imageViewCreateInfo = vk::ImageViewCreateInfo()
-                                       .setFormat(swapchainCreateInfo.imageFormat)
+                                       .setFormat(format)
                                        .setViewType(vk::ImageViewType::e2D)
                                        .setSubresourceRange(imageSubresourceRange);
 
@@ -74,12 +158,6 @@ namespace Penrose {
             imageViews.push_back(device->createImageViewUnique(imageViewCreateInfo));
         }
 
-        return VkSwapchain {
-            .surface = surface,
-            .extent = swapchainCreateInfo.imageExtent,
-            .format = swapchainCreateInfo.imageFormat,
-            .handle = std::move(swapchain),
-            .imageViews = std::move(imageViews)
-        };
+        return imageViews;
     }
 }
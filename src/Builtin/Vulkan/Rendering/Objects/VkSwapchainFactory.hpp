@@ -3,6 +3,7 @@
 
 #include <memory>
 
+#include <Penrose/Rendering/FramePacing.hpp>
 #include <Penrose/Rendering/Surface.hpp>
 #include <Penrose/Resources/Resource.hpp>
 #include <Penrose/Resources/ResourceSet.hpp>
@@ -11,6 +12,7 @@
 
 #include "src/Builtin/Vulkan/Rendering/Objects/VkLogicalDeviceProvider.hpp"
 #include "src/Builtin/Vulkan/Rendering/Objects/VkSwapchain.hpp"
+#include "src/Builtin/Vulkan/Rendering/VkMemoryAllocator.hpp"
 #include "src/Builtin/Vulkan/Rendering/VkSurfacePreferencesProvider.hpp"
 
 namespace Penrose {
@@ -20,18 +22,25 @@ namespace Penrose {
         explicit VkSwapchainFactory(const ResourceSet *resources);
         ~VkSwapchainFactory() override = default;
 
-        [[nodiscard]] VkSwapchain makeSwapchain(const std::shared_ptr<Surface> &surface);
+        [[nodiscard]] VkSwapchain makeSwapchain(const std::shared_ptr<Surface> &surface, FramePacingMode pacingMode);
 
-        [[nodiscard]] VkSwapchain makeSwapchain(const VkSwapchain &oldSwapchain);
+        [[nodiscard]] VkSwapchain makeSwapchain(const VkSwapchain &oldSwapchain, FramePacingMode pacingMode);
 
     private:
         ResourceProxy<VkLogicalDeviceProvider> _logicalDeviceProvider;
         ResourceProxy<VkSurfaceProvider> _surfaceProvider;
         ResourceProxy<VkSurfacePreferencesProvider> _surfacePreferencesProvider;
+        ResourceProxy<VkMemoryAllocator> _memoryAllocator;
 
         [[nodiscard]] VkSwapchain makeSwapchain(
             const std::shared_ptr<Surface> &surface, const vk::SwapchainCreateInfoKHR &swapchainCreateInfo
         );
+
+        [[nodiscard]] VkSwapchain makeOffscreenSwapchain(const std::shared_ptr<Surface> &surface);
+
+        [[nodiscard]] std::vector<vk::UniqueImageView> makeImageViews(
+            const std::vector<vk::Image> &images, vk::Format format
+        );
     };
 }
 
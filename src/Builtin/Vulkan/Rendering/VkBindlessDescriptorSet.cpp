@@ -0,0 +1,318 @@
+#include "VkBindlessDescriptorSet.hpp"
+
+#include <algorithm>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <Penrose/Common/EngineError.hpp>
+
+#include "src/Builtin/Vulkan/Constants.hpp"
+
+namespace Penrose {
+
+    inline static constexpr std::string_view TAG = "VkBindlessDescriptorSet";
+
+    inline static constexpr auto BINDLESS_BINDING_FLAGS = vk::DescriptorBindingFlagBits::ePartiallyBound
+                                                          | vk::DescriptorBindingFlagBits::eUpdateAfterBind
+                                                          | vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending;
+
+    [[nodiscard]] constexpr std::string_view toString(const VkBindlessTable table) {
+        switch (table) {
+            case VkBindlessTable::Image:
+                return "image";
+
+            case VkBindlessTable::Sampler:
+                return "sampler";
+
+            case VkBindlessTable::StorageBuffer:
+                return "storage buffer";
+
+            default:
+                throw EngineError::notImplemented();
+        }
+    }
+
+    VkBindlessSlot::VkBindlessSlot(VkBindlessDescriptorSet *set, const VkBindlessTable table, const std::uint32_t index)
+        : _set(set),
+          _table(table),
+          _index(index) {
+        //
+    }
+
+    VkBindlessSlot::VkBindlessSlot(VkBindlessSlot &&other) noexcept
+        : _set(std::exchange(other._set, nullptr)),
+          _table(other._table),
+          _index(other._index) {
+        //
+    }
+
+    VkBindlessSlot::~VkBindlessSlot() {
+        this->release();
+    }
+
+    VkBindlessSlot &VkBindlessSlot::operator=(VkBindlessSlot &&other) noexcept {
+        if (this != &other) {
+            this->release();
+
+            this->_set = std::exchange(other._set, nullptr);
+            this->_table = other._table;
+            this->_index = other._index;
+        }
+
+        return *this;
+    }
+
+    void VkBindlessSlot::release() {
+        if (this->_set == nullptr) {
+            return;
+        }
+
+        this->_set->release(this->_table, this->_index);
+        this->_set = nullptr;
+    }
+
+    VkBindlessDescriptorSet::VkBindlessDescriptorSet(const ResourceSet *resources)
+        : _log(resources->get<Log>()),
+          _physicalDeviceProvider(resources->get<VkPhysicalDeviceProvider>()),
+          _logicalDeviceProvider(resources->get<VkLogicalDeviceProvider>()) {
+        //
+    }
+
+    void VkBindlessDescriptorSet::init() {
+        const auto &physicalDevice = this->_physicalDeviceProvider->getPhysicalDevice();
+
+        this->_tables[static_cast<std::uint32_t>(VkBindlessTable::Image)].capacity = BINDLESS_IMAGE_COUNT;
+        this->_tables[static_cast<std::uint32_t>(VkBindlessTable::Sampler)].capacity = BINDLESS_SAMPLER_COUNT;
+        this->_tables[static_cast<std::uint32_t>(VkBindlessTable::StorageBuffer)].capacity =
+            BINDLESS_STORAGE_BUFFER_COUNT;
+
+        if (!physicalDevice.descriptorIndexing) {
+            // indices are still handed out, so objects keep their identity, but bindless pipelines are rejected
+            this->_log->writeWarning(TAG, "Descriptor indexing is not supported, bindless descriptors are disabled");
+
+            return;
+        }
+
+        const auto properties = physicalDevice.handle
+                                    .getProperties2<
+                                        vk::PhysicalDeviceProperties2, vk::PhysicalDeviceDescriptorIndexingProperties>()
+                                    .get<vk::PhysicalDeviceDescriptorIndexingProperties>();
+
+        auto &images = this->_tables[static_cast<std::uint32_t>(VkBindlessTable::Image)];
+        auto &samplers = this->_tables[static_cast<std::uint32_t>(VkBindlessTable::Sampler)];
+        auto &buffers = this->_tables[static_cast<std::uint32_t>(VkBindlessTable::StorageBuffer)];
+
+        images.capacity = std::min({
+            images.capacity,
+            properties.maxDescriptorSetUpdateAfterBindSampledImages,
+            properties.maxPerStageDescriptorUpdateAfterBindSampledImages,
+        });
+        samplers.capacity = std::min({
+            samplers.capacity,
+            properties.maxDescriptorSetUpdateAfterBindSamplers,
+            properties.maxPerStageDescriptorUpdateAfterBindSamplers,
+        });
+        buffers.capacity = std::min({
+            buffers.capacity,
+            properties.maxDescriptorSetUpdateAfterBindStorageBuffers,
+            properties.maxPerStageDescriptorUpdateAfterBindStorageBuffers,
+        });
+
+        auto &device = this->_logicalDeviceProvider->getLogicalDevice().handle;
+
+        const auto bindings = {
+            vk::DescriptorSetLayoutBinding()
+                .setBinding(static_cast<std::uint32_t>(VkBindlessTable::Image))
+                .setDescriptorType(vk::DescriptorType::eSampledImage)
+                .setDescriptorCount(images.capacity)
+                .setStageFlags(vk::ShaderStageFlagBits::eAll),
+            vk::DescriptorSetLayoutBinding()
+                .setBinding(static_cast<std::uint32_t>(VkBindlessTable::Sampler))
+                .setDescriptorType(vk::DescriptorType::eSampler)
+                .setDescriptorCount(samplers.capacity)
+                .setStageFlags(vk::ShaderStageFlagBits::eAll),
+            vk::DescriptorSetLayoutBinding()
+                .setBinding(static_cast<std::uint32_t>(VkBindlessTable::StorageBuffer))
+                .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                .setDescriptorCount(buffers.capacity)
+                .setStageFlags(vk::ShaderStageFlagBits::eAll),
+        };
+
+        const auto bindingFlags = {BINDLESS_BINDING_FLAGS, BINDLESS_BINDING_FLAGS, BINDLESS_BINDING_FLAGS};
+        const auto bindingFlagsCreateInfo = vk::DescriptorSetLayoutBindingFlagsCreateInfo().setBindingFlags(bindingFlags
+        );
+
+        const auto layoutCreateInfo = vk::DescriptorSetLayoutCreateInfo()
+                                          .setFlags(vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool)
+                                          .setBindings(bindings)
+                                          .setPNext(&bindingFlagsCreateInfo);
+
+        this->_layout = device->createDescriptorSetLayoutUnique(layoutCreateInfo);
+
+        const auto poolSizes = {
+            vk::DescriptorPoolSize(vk::DescriptorType::eSampledImage, images.capacity),
+            vk::DescriptorPoolSize(vk::DescriptorType::eSampler, samplers.capacity),
+            vk::DescriptorPoolSize(vk::DescriptorType::eStorageBuffer, buffers.capacity),
+        };
+
+        const auto poolCreateInfo = vk::DescriptorPoolCreateInfo()
+                                        .setFlags(vk::DescriptorPoolCreateFlagBits::eUpdateAfterBind)
+                                        .setMaxSets(1)
+                                        .setPoolSizes(poolSizes);
+
+        this->_pool = device->createDescriptorPoolUnique(poolCreateInfo);
+
+        const auto allocateInfo = vk::DescriptorSetAllocateInfo()
+                                      .setDescriptorPool(this->_pool.get())
+                                      .setSetLayouts(this->_layout.get())
+                                      .setDescriptorSetCount(1);
+
+        this->_descriptorSet = device->allocateDescriptorSets(allocateInfo).at(0);
+
+        this->_log->writeInfo(
+            TAG, "Bindless set created: {} image(s), {} sampler(s), {} storage buffer(s)", images.capacity,
+            samplers.capacity, buffers.capacity
+        );
+    }
+
+    void VkBindlessDescriptorSet::destroy() {
+        std::lock_guard guard(this->_mutex);
+
+        this->_descriptorSet = nullptr;
+        this->_pool.reset();
+        this->_layout.reset();
+
+        // render context waits for device on destruction, so retired objects are not used by any frame anymore
+        this->_retired.clear();
+
+        this->_tables = {};
+        this->_frameValue = 0;
+        this->_completedValue = 0;
+    }
+
+    VkBindlessSlot VkBindlessDescriptorSet::registerImage(const vk::ImageView imageView) {
+        std::lock_guard guard(this->_mutex);
+
+        const auto index = this->acquire(VkBindlessTable::Image);
+
+        if (this->_descriptorSet) {
+            const auto imageInfo = vk::DescriptorImageInfo()
+                                       .setImageView(imageView)
+                                       .setImageLayout(vk::ImageLayout::eShaderReadOnlyOptimal);
+
+            const auto write = vk::WriteDescriptorSet()
+                                   .setDstSet(this->_descriptorSet)
+                                   .setDstBinding(static_cast<std::uint32_t>(VkBindlessTable::Image))
+                                   .setDstArrayElement(index)
+                                   .setDescriptorType(vk::DescriptorType::eSampledImage)
+                                   .setImageInfo(imageInfo);
+
+            this->_logicalDeviceProvider->getLogicalDevice().handle->updateDescriptorSets(write, {});
+        }
+
+        return {this, VkBindlessTable::Image, index};
+    }
+
+    VkBindlessSlot VkBindlessDescriptorSet::registerSampler(const vk::Sampler sampler) {
+        std::lock_guard guard(this->_mutex);
+
+        const auto index = this->acquire(VkBindlessTable::Sampler);
+
+        if (this->_descriptorSet) {
+            const auto imageInfo = vk::DescriptorImageInfo().setSampler(sampler);
+
+            const auto write = vk::WriteDescriptorSet()
+                                   .setDstSet(this->_descriptorSet)
+                                   .setDstBinding(static_cast<std::uint32_t>(VkBindlessTable::Sampler))
+                                   .setDstArrayElement(index)
+                                   .setDescriptorType(vk::DescriptorType::eSampler)
+                                   .setImageInfo(imageInfo);
+
+            this->_logicalDeviceProvider->getLogicalDevice().handle->updateDescriptorSets(write, {});
+        }
+
+        return {this, VkBindlessTable::Sampler, index};
+    }
+
+    VkBindlessSlot VkBindlessDescriptorSet::registerBuffer(const vk::Buffer buffer, const vk::DeviceSize size) {
+        std::lock_guard guard(this->_mutex);
+
+        const auto index = this->acquire(VkBindlessTable::StorageBuffer);
+
+        if (this->_descriptorSet) {
+            const auto bufferInfo = vk::DescriptorBufferInfo().setBuffer(buffer).setOffset(0).setRange(size);
+
+            const auto write = vk::WriteDescriptorSet()
+                                   .setDstSet(this->_descriptorSet)
+                                   .setDstBinding(static_cast<std::uint32_t>(VkBindlessTable::StorageBuffer))
+                                   .setDstArrayElement(index)
+                                   .setDescriptorType(vk::DescriptorType::eStorageBuffer)
+                                   .setBufferInfo(bufferInfo);
+
+            this->_logicalDeviceProvider->getLogicalDevice().handle->updateDescriptorSets(write, {});
+        }
+
+        return {this, VkBindlessTable::StorageBuffer, index};
+    }
+
+    void VkBindlessDescriptorSet::release(
+        const VkBindlessTable table, const std::uint32_t index, std::unique_ptr<VkRetiredObjects> &&objects
+    ) {
+        std::lock_guard guard(this->_mutex);
+
+        auto &data = this->_tables.at(static_cast<std::uint32_t>(table));
+
+        // objects could outlive render system, tables are already reset then
+        if (index >= data.next) {
+            return;
+        }
+
+        // slot could be used by frame being recorded, so it is retired until that frame is finished
+        data.released.emplace_back(index, this->_frameValue);
+
+        if (objects != nullptr) {
+            this->_retired.emplace_back(this->_frameValue, std::forward<decltype(objects)>(objects));
+        }
+    }
+
+    void VkBindlessDescriptorSet::beginFrame(const std::uint64_t frameValue, const std::uint64_t completedValue) {
+        auto finished = std::vector<std::unique_ptr<VkRetiredObjects>>();
+
+        {
+            std::lock_guard guard(this->_mutex);
+
+            this->_frameValue = frameValue;
+            this->_completedValue = completedValue;
+
+            while (!this->_retired.empty() && std::get<0>(this->_retired.front()) <= completedValue) {
+                finished.push_back(std::move(std::get<1>(this->_retired.front())));
+                this->_retired.pop_front();
+            }
+        }
+
+        // objects are destroyed without lock, so slots could be registered and released meanwhile
+        finished.clear();
+    }
+
+    std::uint32_t VkBindlessDescriptorSet::acquire(const VkBindlessTable table) {
+        auto &data = this->_tables.at(static_cast<std::uint32_t>(table));
+
+        // released index could still be read by frames in flight, so it is reused only after they are finished
+        if (!data.released.empty()) {
+            const auto [index, frame] = data.released.front();
+
+            if (frame <= this->_completedValue) {
+                data.released.pop_front();
+
+                return index;
+            }
+        }
+
+        if (data.next == data.capacity) {
+            throw EngineError("Bindless {} table is full, capacity is {}", toString(table), data.capacity);
+        }
+
+        return data.next++;
+    }
+}
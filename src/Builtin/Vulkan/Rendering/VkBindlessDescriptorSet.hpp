@@ -0,0 +1,142 @@
+#ifndef PENROSE_BUILTIN_VULKAN_RENDERING_VK_BINDLESS_DESCRIPTOR_SET_HPP
+#define PENROSE_BUILTIN_VULKAN_RENDERING_VK_BINDLESS_DESCRIPTOR_SET_HPP
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <vulkan/vulkan.hpp>
+
+#include <Penrose/Common/Log.hpp>
+#include <Penrose/Resources/Resource.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+
+#include "src/Builtin/Vulkan/Rendering/Objects/VkLogicalDeviceProvider.hpp"
+#include "src/Builtin/Vulkan/Rendering/Objects/VkPhysicalDeviceProvider.hpp"
+
+namespace Penrose {
+
+    enum class VkBindlessTable : std::uint32_t {
+        Image = 0,
+        Sampler = 1,
+        StorageBuffer = 2
+    };
+
+    class VkBindlessDescriptorSet;
+
+    // objects referenced by released bindless descriptor, which are kept alive until frames using it are finished
+    class VkRetiredObjects {
+    public:
+        virtual ~VkRetiredObjects() = default;
+    };
+
+    template <typename... Objects>
+    class VkRetiredObjectsOf final: public VkRetiredObjects {
+    public:
+        explicit VkRetiredObjectsOf(Objects &&...objects)
+            : _objects(std::move(objects)...) {
+            //
+        }
+
+        // objects are destroyed in order of declaration, so views are destroyed before their images and memory
+        ~VkRetiredObjectsOf() override {
+            std::apply([](auto &...objects) { (objects.reset(), ...); }, this->_objects);
+        }
+
+    private:
+        std::tuple<Objects...> _objects;
+    };
+
+    class VkBindlessSlot {
+    public:
+        VkBindlessSlot() = default;
+        VkBindlessSlot(VkBindlessDescriptorSet *set, VkBindlessTable table, std::uint32_t index);
+        VkBindlessSlot(VkBindlessSlot &&other) noexcept;
+        VkBindlessSlot(const VkBindlessSlot &) = delete;
+        ~VkBindlessSlot();
+
+        VkBindlessSlot &operator=(VkBindlessSlot &&other) noexcept;
+        VkBindlessSlot &operator=(const VkBindlessSlot &) = delete;
+
+        [[nodiscard]] std::uint32_t getIndex() const { return this->_index; }
+
+        // releases slot, objects are destroyed after frames, which could still use slot, are finished
+        template <typename... Objects>
+        void retire(Objects &&...objects);
+
+    private:
+        VkBindlessDescriptorSet *_set = nullptr;
+        VkBindlessTable _table = VkBindlessTable::Image;
+        std::uint32_t _index = 0;
+
+        void release();
+    };
+
+    class VkBindlessDescriptorSet final: public Resource<VkBindlessDescriptorSet> {
+    public:
+        explicit VkBindlessDescriptorSet(const ResourceSet *resources);
+        ~VkBindlessDescriptorSet() override = default;
+
+        void init();
+        void destroy();
+
+        [[nodiscard]] bool isSupported() const { return this->_descriptorSet != nullptr; }
+
+        [[nodiscard]] VkBindlessSlot registerImage(vk::ImageView imageView);
+        [[nodiscard]] VkBindlessSlot registerSampler(vk::Sampler sampler);
+        [[nodiscard]] VkBindlessSlot registerBuffer(vk::Buffer buffer, vk::DeviceSize size);
+
+        void release(VkBindlessTable table, std::uint32_t index, std::unique_ptr<VkRetiredObjects> &&objects = nullptr);
+
+        // frame value is timeline value, which is signaled by frame being recorded, completed value is timeline value
+        // of last finished frame
+        void beginFrame(std::uint64_t frameValue, std::uint64_t completedValue);
+
+        [[nodiscard]] vk::DescriptorSetLayout getLayoutHandle() const { return this->_layout.get(); }
+
+        [[nodiscard]] vk::DescriptorSet getHandle() const { return this->_descriptorSet; }
+
+    private:
+        struct Table {
+            std::uint32_t capacity = 0;
+            std::uint32_t next = 0;
+            std::deque<std::tuple<std::uint32_t, std::uint64_t>> released;
+        };
+
+        ResourceProxy<Log> _log;
+        ResourceProxy<VkPhysicalDeviceProvider> _physicalDeviceProvider;
+        ResourceProxy<VkLogicalDeviceProvider> _logicalDeviceProvider;
+
+        vk::UniqueDescriptorSetLayout _layout;
+        vk::UniqueDescriptorPool _pool;
+        vk::DescriptorSet _descriptorSet;
+
+        std::mutex _mutex;
+        std::uint64_t _frameValue = 0;
+        std::uint64_t _completedValue = 0;
+        std::array<Table, 3> _tables;
+        std::deque<std::tuple<std::uint64_t, std::unique_ptr<VkRetiredObjects>>> _retired;
+
+        [[nodiscard]] std::uint32_t acquire(VkBindlessTable table);
+    };
+
+    template <typename... Objects>
+    void VkBindlessSlot::retire(Objects &&...objects) {
+        auto retired = std::make_unique<VkRetiredObjectsOf<std::remove_cvref_t<Objects>...>>(std::move(objects)...);
+
+        // objects, which are not referenced by any descriptor, are destroyed right away
+        if (this->_set == nullptr) {
+            return;
+        }
+
+        this->_set->release(this->_table, this->_index, std::move(retired));
+        this->_set = nullptr;
+    }
+}
+
+#endif // PENROSE_BUILTIN_VULKAN_RENDERING_VK_BINDLESS_DESCRIPTOR_SET_HPP
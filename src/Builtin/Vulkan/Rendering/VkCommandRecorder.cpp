@@ -49,7 +49,9 @@ namespace Penrose {
     }
 
     void VkCommandRecorder::bindPipeline(Pipeline *pipeline, const PipelineBindingInfo &bindingInfo) {
-        if (this->_currentPipeline != pipeline) {
+        const auto pipelineChanged = this->_currentPipeline != pipeline;
+
+        if (pipelineChanged) {
             this->_currentPipeline = asVkPipeline(pipeline);
 
             this->_commandBuffer.bindPipeline(
@@ -63,6 +65,14 @@ namespace Penrose {
         }
 
         const auto &pipelineInfo = this->_currentPipeline->getPipelineInfo();
+
+        // global bindless set is updated in place, so it is bound once per pipeline
+        if (pipelineChanged && pipelineInfo.bindless) {
+            this->_commandBuffer.bindDescriptorSets(
+                vk::PipelineBindPoint::eGraphics, this->_currentPipeline->getPipelineLayoutHandle(), 0,
+                this->_renderContext->getBindlessDescriptorSet(), {}
+            );
+        }
         const auto constantsCount = pipelineInfo.constants.size();
         if (constantsCount != bindingInfo.constants.size()) {
             throw EngineError(
@@ -79,12 +89,17 @@ namespace Penrose {
             );
         }
 
+        if (pipelineInfo.objects.empty() && bindingInfo.objects.empty()) {
+            return;
+        }
+
         const auto descriptorSets = this->_renderContext->useDescriptor(
             this->_currentPipeline, this->_pass, this->_subpass, bindingInfo
         );
 
         this->_commandBuffer.bindDescriptorSets(
-            vk::PipelineBindPoint::eGraphics, this->_currentPipeline->getPipelineLayoutHandle(), 0, descriptorSets, {}
+            vk::PipelineBindPoint::eGraphics, this->_currentPipeline->getPipelineLayoutHandle(),
+            pipelineInfo.bindless ? 1 : 0, descriptorSets, {}
         );
     }
 
@@ -1,5 +1,7 @@
 #include "VkMemoryAllocator.hpp"
 
+#include <algorithm>
+
 #include <Penrose/Common/EngineError.hpp>
 
 namespace Penrose {
@@ -32,6 +34,33 @@ namespace Penrose {
         return memory;
     }
 
+    vk::UniqueDeviceMemory VkMemoryAllocator::allocateAliasedImages(const std::vector<vk::Image> &images) {
+        auto &device = this->_logicalDeviceProvider->getLogicalDevice().handle;
+
+        auto requirements = vk::MemoryRequirements();
+        requirements.memoryTypeBits = ~0U;
+
+        for (const auto &image: images) {
+            const auto imageRequirements = device->getImageMemoryRequirements(image);
+
+            requirements.size = std::max(requirements.size, imageRequirements.size);
+            requirements.alignment = std::max(requirements.alignment, imageRequirements.alignment);
+            requirements.memoryTypeBits &= imageRequirements.memoryTypeBits;
+        }
+
+        if (requirements.memoryTypeBits == 0) {
+            throw EngineError("No memory type is shared by aliased images");
+        }
+
+        auto memory = this->allocate(requirements, true);
+
+        for (const auto &image: images) {
+            device->bindImageMemory(image, memory.get(), 0);
+        }
+
+        return memory;
+    }
+
     vk::UniqueDeviceMemory VkMemoryAllocator::allocate(const vk::MemoryRequirements &requirements, const bool local) {
         const vk::MemoryPropertyFlags flags = local ? vk::MemoryPropertyFlagBits::eDeviceLocal
                                                     : vk::MemoryPropertyFlagBits::eHostVisible
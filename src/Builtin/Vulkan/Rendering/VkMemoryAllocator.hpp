@@ -1,6 +1,8 @@
 #ifndef PENROSE_BUILTIN_VULKAN_RENDERING_VK_MEMORY_ALLOCATOR_HPP
 #define PENROSE_BUILTIN_VULKAN_RENDERING_VK_MEMORY_ALLOCATOR_HPP
 
+#include <vector>
+
 #include <vulkan/vulkan.hpp>
 
 #include <Penrose/Resources/ResourceSet.hpp>
@@ -17,6 +19,7 @@ namespace Penrose {
 
         [[nodiscard]] vk::UniqueDeviceMemory allocateBuffer(const vk::Buffer &buffer, bool local);
         [[nodiscard]] vk::UniqueDeviceMemory allocateImage(const vk::Image &image);
+        [[nodiscard]] vk::UniqueDeviceMemory allocateAliasedImages(const std::vector<vk::Image> &images);
 
     private:
         ResourceProxy<VkLogicalDeviceProvider> _logicalDeviceProvider;
@@ -1,8 +1,16 @@
 #include "VkRenderContext.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
 #include <list>
+#include <ranges>
+
+#include <fmt/core.h>
 
 #include <Penrose/Common/EngineError.hpp>
+#include <Penrose/Performance/Profiler.hpp>
 
 #include "src/Utils/RangeUtils.hpp"
 
@@ -13,31 +21,56 @@ namespace Penrose {
 
     inline static constexpr std::string_view TAG = "VkRenderContext";
 
-    inline constexpr std::uint64_t MAX_FENCE_TIMEOUT = std::numeric_limits<std::uint64_t>::max();
+    inline constexpr std::uint64_t MAX_FRAME_TIMEOUT = std::numeric_limits<std::uint64_t>::max();
     inline constexpr std::uint64_t MAX_ACQUIRE_TIMEOUT = std::numeric_limits<std::uint64_t>::max();
 
+    inline constexpr std::uint32_t FRAME_TIMESTAMP_COUNT = 2;
+    inline constexpr std::uint32_t MAX_GPU_SCOPES_PER_FRAME = 64;
+    inline constexpr std::uint32_t TIMESTAMPS_PER_FRAME = FRAME_TIMESTAMP_COUNT + 2 * MAX_GPU_SCOPES_PER_FRAME;
+
     static constexpr std::array<vk::PipelineStageFlags, 1> WAIT_DST_STAGE_MASK = {
         vk::PipelineStageFlagBits::eColorAttachmentOutput
     };
 
     VkRenderContext::VkRenderContext(
-        ResourceProxy<Log> log, ResourceProxy<VkLogicalDeviceProvider> logicalDeviceProvider,
+        ResourceProxy<Log> log, ResourceProxy<VkPhysicalDeviceProvider> physicalDeviceProvider,
+        ResourceProxy<VkLogicalDeviceProvider> logicalDeviceProvider,
         ResourceProxy<VkInternalObjectFactory> internalObjectFactory, ResourceProxy<VkImageFactory> imageFactory,
         ResourceProxy<VkPipelineFactory> pipelineFactory, ResourceProxy<VkSwapchainFactory> swapchainFactory,
-        VkSwapchain &&swapchain, vk::UniqueCommandPool &&commandPool, vk::UniqueDescriptorPool &&descriptorPool,
-        std::array<FrameData, INFLIGHT_FRAME_COUNT> &&frameData
+        ResourceProxy<VkBindlessDescriptorSet> bindlessDescriptorSet, ResourceProxy<VkBufferFactory> bufferFactory,
+        ResourceProxy<FrameCaptureHandler> frameCaptureHandlers, ResourceProxy<MetricsRegistry> metrics,
+        ResourceProxy<Profiler> profiler, const FramePacingInfo &pacingInfo, VkSwapchain &&swapchain,
+        vk::UniqueCommandPool &&commandPool, vk::UniqueDescriptorPool &&descriptorPool
     )
         : _log(std::move(log)),
+          _physicalDeviceProvider(std::move(physicalDeviceProvider)),
           _logicalDeviceProvider(std::move(logicalDeviceProvider)),
           _internalObjectFactory(std::move(internalObjectFactory)),
           _imageFactory(std::move(imageFactory)),
           _pipelineFactory(std::move(pipelineFactory)),
           _swapchainFactory(std::move(swapchainFactory)),
+          _bindlessDescriptorSet(std::move(bindlessDescriptorSet)),
+          _bufferFactory(std::move(bufferFactory)),
+          _frameCaptureHandlers(std::move(frameCaptureHandlers)),
+          _metrics(std::move(metrics)),
+          _profiler(std::move(profiler)),
+          _descriptorWriteMetric(this->_metrics->counter("vk.descriptor.writes")),
+          _framebufferMissMetric(this->_metrics->counter("vk.framebuffer.misses")),
+          _pipelineMissMetric(this->_metrics->counter("vk.pipeline.misses")),
+          _frameWaitMetric(this->_metrics->histogram("vk.frame.wait_ms")),
           _commandPool(std::forward<decltype(commandPool)>(commandPool)),
           _descriptorPool(std::forward<decltype(descriptorPool)>(descriptorPool)),
-          _swapchain(std::forward<decltype(swapchain)>(swapchain)),
-          _frameData(std::forward<decltype(frameData)>(frameData)) {
-        //
+          _swapchain(std::forward<decltype(swapchain)>(swapchain)) {
+        const auto timelineCreateInfo = vk::SemaphoreTypeCreateInfo()
+                                            .setSemaphoreType(vk::SemaphoreType::eTimeline)
+                                            .setInitialValue(this->_timelineValue);
+
+        this->_timeline = this->_logicalDeviceProvider->getLogicalDevice().handle->createSemaphoreUnique(
+            vk::SemaphoreCreateInfo().setPNext(&timelineCreateInfo)
+        );
+
+        this->setPacingInfo(pacingInfo);
+        this->makeFrameData();
     }
 
     VkRenderContext::~VkRenderContext() {
@@ -48,36 +81,69 @@ namespace Penrose {
         auto &device = this->_logicalDeviceProvider->getLogicalDevice().handle;
         auto &frameData = this->_frameData.at(this->_currentFrameIdx);
 
-        vk::Result acquireResult;
-        std::uint32_t imageIdx;
+        // frame resources are waited before image acquisition, so frame is recorded as late as possible
+        const auto waitInfo = vk::SemaphoreWaitInfo()
+                                  .setSemaphores(this->_timeline.get())
+                                  .setValues(frameData.timelineValue);
 
-        try {
-            std::tie(acquireResult, imageIdx) = device->acquireNextImageKHR(
-                this->_swapchain.handle.get(), MAX_ACQUIRE_TIMEOUT, frameData.imageReady.get()
-            );
-        } catch (const vk::OutOfDateKHRError &) {
-            return false;
-        }
+        const auto waitStart = std::chrono::steady_clock::now();
 
-        if (acquireResult != vk::Result::eSuccess) {
+        if (device->waitSemaphores(waitInfo, MAX_FRAME_TIMEOUT) == vk::Result::eTimeout) {
             return false;
         }
 
-        const auto fenceResult = device->waitForFences(frameData.fence.get(), true, MAX_FENCE_TIMEOUT);
+        this->_frameWaitMetric->record(
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - waitStart).count()
+        );
+
+        this->resolveGpuTime(this->_currentFrameIdx);
+        this->deliverFrameCapture(this->_currentFrameIdx);
 
-        if (fenceResult == vk::Result::eTimeout) {
-            return false;
+        this->_retiredResources.at(this->_currentFrameIdx) = {};
+
+        std::uint32_t imageIdx;
+
+        if (this->_swapchain.offscreen) {
+            imageIdx = this->_offscreenImageIdx;
+            this->_offscreenImageIdx = (imageIdx + 1) % this->_swapchain.images.size();
+        } else {
+            vk::Result acquireResult;
+
+            try {
+                std::tie(acquireResult, imageIdx) = device->acquireNextImageKHR(
+                    this->_swapchain.handle.get(), MAX_ACQUIRE_TIMEOUT, frameData.imageReady.get()
+                );
+            } catch (const vk::OutOfDateKHRError &) {
+                return false;
+            }
+
+            // suboptimal image still signals semaphore, so it is rendered and swapchain is recreated on present
+            if (acquireResult != vk::Result::eSuccess && acquireResult != vk::Result::eSuboptimalKHR) {
+                return false;
+            }
         }
 
-        device->resetFences(frameData.fence.get());
+        // frames are finished in order of submission, so every frame up to waited one is finished
+        this->_bindlessDescriptorSet->beginFrame(this->_timelineValue + 1, frameData.timelineValue);
 
         frameData.commandBuffer->reset();
         frameData.commandBuffer->begin(vk::CommandBufferBeginInfo());
 
+        frameData.gpuScopes.clear();
+        this->_gpuScopeStack.clear();
+
+        if (this->_queryPool) {
+            const auto firstQuery = this->_currentFrameIdx * TIMESTAMPS_PER_FRAME;
+
+            frameData.commandBuffer->resetQueryPool(this->_queryPool.get(), firstQuery, TIMESTAMPS_PER_FRAME);
+            frameData.commandBuffer->writeTimestamp(
+                vk::PipelineStageFlagBits::eTopOfPipe, this->_queryPool.get(), firstQuery
+            );
+        }
+
         this->_currentState = State {
             .imageIdx = imageIdx,
             .commandBuffer = frameData.commandBuffer.get(),
-            .fence = frameData.fence.get(),
             .imageReady = frameData.imageReady.get(),
             .renderFinished = frameData.renderFinished.get(),
         };
@@ -90,31 +156,88 @@ namespace Penrose {
             throw EngineError("Render is not started");
         }
 
+        auto &frameData = this->_frameData.at(this->_currentFrameIdx);
+        auto &logicalDevice = this->_logicalDeviceProvider->getLogicalDevice();
+
+        // scopes, which were left open, are ended by end of frame
+        while (!this->_gpuScopeStack.empty()) {
+            this->endGpuScope();
+        }
+
+        if (this->_swapchain.offscreen && this->_frameCaptureHandlers.isPresent()) {
+            this->recordFrameCapture();
+        }
+
+        if (this->_queryPool) {
+            this->_currentState->commandBuffer.writeTimestamp(
+                vk::PipelineStageFlagBits::eBottomOfPipe, this->_queryPool.get(),
+                this->_currentFrameIdx * TIMESTAMPS_PER_FRAME + 1
+            );
+
+            frameData.timestampsWritten = true;
+        }
+
         this->_currentState->commandBuffer.end();
 
-        const auto submits = {
-            vk::SubmitInfo()
-                .setCommandBuffers(this->_currentState->commandBuffer)
-                .setWaitDstStageMask(WAIT_DST_STAGE_MASK)
-                .setWaitSemaphores(this->_currentState->imageReady)
-                .setSignalSemaphores(this->_currentState->renderFinished),
-        };
+        frameData.submitTime = Profiler::now();
 
-        this->_logicalDeviceProvider->getLogicalDevice().graphicsQueue.submit(submits, this->_currentState->fence);
+        frameData.timelineValue = ++this->_timelineValue;
 
-        const auto presentInfo = vk::PresentInfoKHR()
-                                     .setSwapchains(this->_swapchain.handle.get())
-                                     .setWaitSemaphores(this->_currentState->renderFinished)
-                                     .setImageIndices(this->_currentState->imageIdx);
+        if (this->_swapchain.offscreen) {
+            const auto signalSemaphores = std::array {this->_timeline.get()};
+            const auto signalValues = std::array {frameData.timelineValue};
 
-        const auto presentResult = this->_logicalDeviceProvider->getLogicalDevice().presentQueue.presentKHR(presentInfo
-        );
+            const auto timelineSubmitInfo = vk::TimelineSemaphoreSubmitInfo().setSignalSemaphoreValues(signalValues);
+
+            const auto submits = {
+                vk::SubmitInfo()
+                    .setCommandBuffers(this->_currentState->commandBuffer)
+                    .setSignalSemaphores(signalSemaphores)
+                    .setPNext(&timelineSubmitInfo),
+            };
+
+            logicalDevice.graphicsQueue.submit(submits);
+        } else {
+            // values of binary semaphores are ignored
+            const auto waitValues = std::array<std::uint64_t, 1> {0};
+            const auto signalSemaphores = std::array {this->_timeline.get(), this->_currentState->renderFinished};
+            const auto signalValues = std::array<std::uint64_t, 2> {frameData.timelineValue, 0};
+
+            const auto timelineSubmitInfo = vk::TimelineSemaphoreSubmitInfo()
+                                                .setWaitSemaphoreValues(waitValues)
+                                                .setSignalSemaphoreValues(signalValues);
+
+            const auto submits = {
+                vk::SubmitInfo()
+                    .setCommandBuffers(this->_currentState->commandBuffer)
+                    .setWaitDstStageMask(WAIT_DST_STAGE_MASK)
+                    .setWaitSemaphores(this->_currentState->imageReady)
+                    .setSignalSemaphores(signalSemaphores)
+                    .setPNext(&timelineSubmitInfo),
+            };
+
+            logicalDevice.graphicsQueue.submit(submits);
 
-        if (presentResult != vk::Result::eSuccess) {
-            this->invalidate();
+            const auto presentInfo = vk::PresentInfoKHR()
+                                         .setSwapchains(this->_swapchain.handle.get())
+                                         .setWaitSemaphores(this->_currentState->renderFinished)
+                                         .setImageIndices(this->_currentState->imageIdx);
+
+            vk::Result presentResult;
+
+            try {
+                presentResult = logicalDevice.presentQueue.presentKHR(presentInfo);
+            } catch (const vk::OutOfDateKHRError &) {
+                presentResult = vk::Result::eErrorOutOfDateKHR;
+            }
+
+            if (presentResult != vk::Result::eSuccess) {
+                this->invalidate();
+            }
         }
 
-        this->_currentFrameIdx = (this->_currentFrameIdx + 1) % INFLIGHT_FRAME_COUNT;
+        this->_frameCounter++;
+        this->_currentFrameIdx = (this->_currentFrameIdx + 1) % this->_frameData.size();
 
         this->_currentState = std::nullopt;
     }
@@ -123,15 +246,97 @@ namespace Penrose {
         return new VkRendererContext(this, this->_log);
     }
 
+    void VkRenderContext::beginGpuScope(const Profiler::TagId tag) {
+        if (!this->_queryPool || !this->_currentState.has_value()) {
+            return;
+        }
+
+        auto &frameData = this->_frameData.at(this->_currentFrameIdx);
+
+        if (frameData.gpuScopes.size() >= MAX_GPU_SCOPES_PER_FRAME) {
+            if (!this->_gpuScopeOverflowReported) {
+                this->_gpuScopeOverflowReported = true;
+                this->_log->writeWarning(
+                    TAG, "Frame has more than {} GPU scopes, exceeding scopes are not measured",
+                    MAX_GPU_SCOPES_PER_FRAME
+                );
+            }
+
+            this->_gpuScopeStack.emplace_back(std::nullopt);
+
+            return;
+        }
+
+        const auto scopeIdx = static_cast<std::uint32_t>(frameData.gpuScopes.size());
+
+        frameData.gpuScopes.push_back(GpuScope {
+            .tag = tag,
+            .depth = static_cast<std::uint32_t>(this->_gpuScopeStack.size()),
+        });
+
+        this->_gpuScopeStack.emplace_back(scopeIdx);
+
+        this->_currentState->commandBuffer.writeTimestamp(
+            vk::PipelineStageFlagBits::eTopOfPipe, this->_queryPool.get(),
+            this->_currentFrameIdx * TIMESTAMPS_PER_FRAME + FRAME_TIMESTAMP_COUNT + 2 * scopeIdx
+        );
+    }
+
+    void VkRenderContext::endGpuScope() {
+        if (this->_gpuScopeStack.empty()) {
+            return;
+        }
+
+        const auto scopeIdx = this->_gpuScopeStack.back();
+        this->_gpuScopeStack.pop_back();
+
+        if (!scopeIdx.has_value() || !this->_currentState.has_value()) {
+            return;
+        }
+
+        this->_currentState->commandBuffer.writeTimestamp(
+            vk::PipelineStageFlagBits::eBottomOfPipe, this->_queryPool.get(),
+            this->_currentFrameIdx * TIMESTAMPS_PER_FRAME + FRAME_TIMESTAMP_COUNT + 2 * *scopeIdx + 1
+        );
+    }
+
     void VkRenderContext::invalidate() {
         this->_logicalDeviceProvider->getLogicalDevice().handle->waitIdle();
 
+        // all frames are finished, so pending results are delivered before their buffers are dropped
+        for (std::uint32_t frameIdx = 0; frameIdx < this->_frameData.size(); frameIdx++) {
+            this->resolveGpuTime(frameIdx);
+            this->deliverFrameCapture(frameIdx);
+        }
+
         for (auto &passInfo: this->_passes | std::views::values) {
             passInfo.framebuffers.clear();
+            passInfo.transientSlots = std::vector<TransientSlot>(passInfo.compiled.aliasSlotCount);
         }
 
         this->_imageTargets.clear();
-        this->_swapchain = this->_swapchainFactory->makeSwapchain(this->_swapchain);
+        this->_offscreenImageIdx = 0;
+
+        if (this->_frameData.size() != this->_pacingInfo.framesInFlight) {
+            this->makeFrameData();
+        } else {
+            this->_retiredResources = std::vector<RetiredResources>(this->_frameData.size());
+            this->_frameCaptures = std::vector<FrameCaptureData>(this->_frameData.size());
+        }
+
+        this->_swapchain = this->_swapchainFactory->makeSwapchain(this->_swapchain, this->_pacingInfo.mode);
+    }
+
+    void VkRenderContext::setPacingInfo(const FramePacingInfo &pacingInfo) {
+        this->_pacingInfo = pacingInfo;
+        this->_pacingInfo.framesInFlight = std::clamp(pacingInfo.framesInFlight, 1u, MAX_INFLIGHT_FRAME_COUNT);
+
+        if (this->_pacingInfo.framesInFlight != pacingInfo.framesInFlight) {
+            this->_log->writeWarning(
+                TAG, "{} frame(s) in flight requested, {} frame(s) are used", pacingInfo.framesInFlight,
+                this->_pacingInfo.framesInFlight
+            );
+        }
     }
 
     vk::ImageView VkRenderContext::useTarget(const TargetInfo &target) {
@@ -172,11 +377,37 @@ namespace Penrose {
         auto it = this->_passes.find(graph.name);
 
         if (it == this->_passes.end()) {
+            auto compiled = compileGraph(graph);
+
+            this->_log->writeDebug(
+                TAG, "Graph {} compiled into {} of {} pass(es) with {} transient alias slot(s)", graph.name,
+                compiled.passes.size(), graph.passes.size(), compiled.aliasSlotCount
+            );
+
+            auto pass = this->_internalObjectFactory->makeRenderPass(graph, compiled, this->_swapchain);
+            auto transientSlots = std::vector<TransientSlot>(compiled.aliasSlotCount);
+            auto gpuPassTags = std::vector<Profiler::TagId>();
+
+            gpuPassTags.reserve(graph.passes.size());
+
+            for (std::uint32_t passIdx = 0; passIdx < graph.passes.size(); passIdx++) {
+                const auto &function = graph.passes.at(passIdx).function;
+
+                gpuPassTags.push_back(this->_profiler->intern(
+                    function.has_value() ? fmt::format("GPU Pass {}", *function) : fmt::format("GPU Pass #{}", passIdx)
+                ));
+            }
+
             std::tie(it, std::ignore) = this->_passes.emplace(
                 graph.name,
                 Pass {
                     .info = graph,
-                    .pass = this->_internalObjectFactory->makeRenderPass(graph, this->_swapchain),
+                    .compiled = std::move(compiled),
+                    .pass = std::move(pass),
+                    .gpuTag = this->_profiler->intern(fmt::format("GPU Graph {}", graph.name)),
+                    .gpuPassTags = std::move(gpuPassTags),
+                    .framebuffers = {},
+                    .transientSlots = std::move(transientSlots),
                 }
             );
         }
@@ -184,19 +415,66 @@ namespace Penrose {
         return it->second.pass.get();
     }
 
+    const CompiledGraph &VkRenderContext::getCompiledGraph(const GraphInfo &graph) const {
+        return this->_passes.at(graph.name).compiled;
+    }
+
+    Profiler::TagId VkRenderContext::getGraphGpuTag(const GraphInfo &graph) const {
+        return this->_passes.at(graph.name).gpuTag;
+    }
+
+    Profiler::TagId VkRenderContext::getPassGpuTag(const GraphInfo &graph, const std::uint32_t passIdx) const {
+        return this->_passes.at(graph.name).gpuPassTags.at(passIdx);
+    }
+
     vk::Framebuffer VkRenderContext::useFramebuffer(
         const std::initializer_list<TargetInfo> &targets, const GraphInfo &graph, const vk::Extent2D &extent
     ) {
+        if (targets.size() != graph.attachments.size()) {
+            throw EngineError(
+                "Graph {} expects {} target(s), got {} target(s)", graph.name, graph.attachments.size(), targets.size()
+            );
+        }
+
         auto &passInfo = this->_passes.at(graph.name);
-        auto targetViews = std::vector<vk::ImageView>(targets.size());
+        const auto &compiled = passInfo.compiled;
 
-        std::ranges::transform(targets, targetViews.begin(), [&](const auto &target) {
-            return this->useTarget(target);
-        });
+        const auto isTransient = [&](const TargetInfo &target, const std::uint32_t attachmentIdx) {
+            return target.type == TargetType::Image && compiled.attachments.at(attachmentIdx).aliasSlot.has_value();
+        };
+
+        // transient targets are resolved before collecting views, because new transient target rebuilds its slot
+        std::uint32_t attachmentIdx = 0;
+        for (const auto &target: targets) {
+            if (isTransient(target, attachmentIdx)) {
+                std::ignore =
+                    this->useTransientTarget(passInfo, target, *compiled.attachments.at(attachmentIdx).aliasSlot);
+            }
+
+            attachmentIdx++;
+        }
+
+        auto targetViews = std::vector<vk::ImageView>();
+        targetViews.reserve(targets.size());
+
+        attachmentIdx = 0;
+        for (const auto &target: targets) {
+            if (isTransient(target, attachmentIdx)) {
+                targetViews.push_back(
+                    this->useTransientTarget(passInfo, target, *compiled.attachments.at(attachmentIdx).aliasSlot)
+                );
+            } else {
+                targetViews.push_back(this->useTarget(target));
+            }
+
+            attachmentIdx++;
+        }
 
         auto it = passInfo.framebuffers.find(targetViews);
 
         if (it == passInfo.framebuffers.end()) {
+            this->_framebufferMissMetric->add();
+
             std::tie(it, std::ignore) = passInfo.framebuffers.emplace(
                 targetViews, this->_internalObjectFactory->makeFramebuffer(
                                  passInfo.pass.get(), targetViews, extent.width, extent.height
@@ -215,6 +493,14 @@ namespace Penrose {
         auto it = this->_pipelines.find(key);
 
         if (it == this->_pipelines.end()) {
+            const auto count = ++this->_midFramePipelineCount;
+            this->_pipelineMissMetric->add();
+
+            this->_log->writeWarning(
+                TAG, "Pipeline {} is compiled while recording frame ({} in total), it should be declared for warm-up",
+                pipeline->getPipelineInfo().name, count
+            );
+
             const auto pipelineInstance = this->_pipelineFactory->makePipelineInstance(pipeline, pass, subpass);
 
             auto pipelineData = PipelineData {
@@ -228,6 +514,66 @@ namespace Penrose {
         return it->second.instance->getHandle();
     }
 
+    void VkRenderContext::warmUpPipelines(const std::vector<PipelineWarmUpInfo> &warmUp) {
+        auto requests = std::vector<VkPipelineInstanceRequest>();
+        auto keys = std::set<PipelineKey>();
+
+        for (const auto &info: warmUp) {
+            const auto pipeline = asVkPipeline(info.pipeline);
+            const auto pass = this->usePass(info.graph);
+            const auto &compiled = this->getCompiledGraph(info.graph);
+
+            const auto subpassIt = std::ranges::find_if(compiled.passes, [&](const auto &compiledPass) {
+                return info.graph.passes.at(compiledPass.passIdx).function == info.function;
+            });
+
+            if (subpassIt == compiled.passes.end()) {
+                this->_log->writeWarning(
+                    TAG, "Pipeline {} is not warmed up: graph {} has no pass with function {}",
+                    pipeline->getPipelineInfo().name, info.graph.name, info.function
+                );
+
+                continue;
+            }
+
+            const auto subpass = static_cast<std::uint32_t>(std::distance(compiled.passes.begin(), subpassIt));
+            const auto key = PipelineKey {pipeline->getPipelineInfo().name, pass, subpass};
+
+            if (this->_pipelines.contains(key) || !keys.insert(key).second) {
+                continue;
+            }
+
+            requests.push_back(VkPipelineInstanceRequest {pipeline, pass, subpass});
+        }
+
+        if (requests.empty()) {
+            return;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const auto instances = this->_pipelineFactory->makePipelineInstances(requests);
+
+        for (const auto instance: instances) {
+            const auto &name = instance->getPipeline()->getPipelineInfo().name;
+
+            this->_pipelines.emplace(
+                PipelineKey {name, instance->getPass(), instance->getSubpass()},
+                PipelineData {
+                    .instance = std::unique_ptr<VkPipelineInstance>(instance),
+                    .descriptors = {},
+                }
+            );
+        }
+
+        this->_log->writeInfo(
+            TAG, "Warmed up {} pipeline(s) in {:.3f} s", instances.size(),
+            std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count()
+        );
+
+        // freshly compiled pipelines are persisted at once, so they are not lost if engine is not stopped gracefully
+        this->_pipelineFactory->saveCache();
+    }
+
     vk::DescriptorSet VkRenderContext::useDescriptor(
         const VkPipeline *pipeline, vk::RenderPass pass, std::uint32_t subpass, const PipelineBindingInfo &binding
     ) {
@@ -262,15 +608,19 @@ namespace Penrose {
             auto it = pipelineData.descriptors.find(*binding.tag);
 
             if (it == pipelineData.descriptors.end()) {
+                const auto frameCount = static_cast<std::uint32_t>(this->_frameData.size());
+                const auto layouts = std::vector<vk::DescriptorSetLayout>(
+                    frameCount, pipeline->getDescriptorSetLayoutHandle()
+                );
+
                 const auto allocateInfo = vk::DescriptorSetAllocateInfo()
                                               .setDescriptorPool(this->_descriptorPool.get())
-                                              .setSetLayouts(pipeline->getDescriptorSetLayoutHandle())
-                                              .setDescriptorSetCount(INFLIGHT_FRAME_COUNT);
+                                              .setSetLayouts(layouts);
 
                 auto newDescriptors = device->allocateDescriptorSetsUnique(allocateInfo);
-                std::array<PipelineDescriptorData, INFLIGHT_FRAME_COUNT> descriptorData;
+                auto descriptorData = std::vector<PipelineDescriptorData>(frameCount);
 
-                for (std::uint32_t descriptorIdx = 0; descriptorIdx < INFLIGHT_FRAME_COUNT; descriptorIdx++) {
+                for (std::uint32_t descriptorIdx = 0; descriptorIdx < frameCount; descriptorIdx++) {
                     descriptorData[descriptorIdx].info = {};
                     descriptorData[descriptorIdx].descriptor = std::move(newDescriptors.at(descriptorIdx));
                 }
@@ -278,8 +628,14 @@ namespace Penrose {
                 std::tie(it, std::ignore) = pipelineData.descriptors.emplace(*binding.tag, std::move(descriptorData));
             }
 
-            descriptor = it->second.at(this->_currentFrameIdx).descriptor.get();
-            update = it->second.at(this->_currentFrameIdx).info == binding.objects;
+            auto &descriptorData = it->second.at(this->_currentFrameIdx);
+
+            descriptor = descriptorData.descriptor.get();
+            update = descriptorData.info != binding.objects;
+
+            if (update) {
+                descriptorData.info = binding.objects;
+            }
         }
 
         if (update) {
@@ -351,8 +707,264 @@ namespace Penrose {
             }
 
             device->updateDescriptorSets(writes, {});
+            this->_descriptorWriteMetric->add(writes.size());
         }
 
         return descriptor;
     }
+
+    vk::ImageView VkRenderContext::useTransientTarget(
+        Pass &passInfo, const TargetInfo &target, const std::uint32_t aliasSlot
+    ) {
+        auto &slot = passInfo.transientSlots.at(aliasSlot);
+
+        for (std::uint32_t idx = 0; idx < slot.targets.size(); idx++) {
+            const auto &storedTarget = slot.targets.at(idx);
+
+            if (storedTarget.name != target.name) {
+                continue;
+            }
+
+            if (storedTarget != target) {
+                this->_log->writeWarning(
+                    TAG, "Attempt to use target {} with different target info, old target info is preserved",
+                    target.name
+                );
+            }
+
+            const auto &[memory, images] = slot.images;
+            const auto &[image, imageView] = images.at(idx);
+
+            return imageView.get();
+        }
+
+        // images of slot are bound to single allocation, so whole slot is rebuilt on new target. Previous images
+        // and framebuffers could be still used by frames in flight, so they are retired until frame fence is waited.
+        auto &retired = this->_retiredResources.at(this->_currentFrameIdx);
+
+        for (auto &framebuffer: passInfo.framebuffers | std::views::values) {
+            retired.framebuffers.push_back(std::move(framebuffer));
+        }
+
+        passInfo.framebuffers.clear();
+
+        retired.images.push_back(std::move(slot.images));
+        slot.targets.push_back(target);
+        slot.images = this->_imageFactory->makeAliasedImages(slot.targets, this->_swapchain);
+
+        const auto &[memory, images] = slot.images;
+        const auto &[image, imageView] = images.back();
+
+        return imageView.get();
+    }
+
+    void VkRenderContext::makeFrameData() {
+        auto &device = this->_logicalDeviceProvider->getLogicalDevice().handle;
+        const auto frameCount = this->_pacingInfo.framesInFlight;
+
+        const auto commandBufferAllocateInfo = vk::CommandBufferAllocateInfo()
+                                                   .setLevel(vk::CommandBufferLevel::ePrimary)
+                                                   .setCommandPool(this->_commandPool.get())
+                                                   .setCommandBufferCount(frameCount);
+
+        auto commandBuffers = device->allocateCommandBuffersUnique(commandBufferAllocateInfo);
+
+        this->_frameData.clear();
+
+        for (std::uint32_t idx = 0; idx < frameCount; ++idx) {
+            this->_frameData.push_back(FrameData {
+                .commandBuffer = std::move(commandBuffers.at(idx)),
+                .imageReady = device->createSemaphoreUnique(vk::SemaphoreCreateInfo()),
+                .renderFinished = device->createSemaphoreUnique(vk::SemaphoreCreateInfo()),
+                .timelineValue = this->_timelineValue,
+                .timestampsWritten = false,
+                .gpuScopes = {},
+                .submitTime = 0,
+            });
+        }
+
+        // descriptors of tagged bindings are allocated per frame, so they are recreated on next use
+        for (auto &pipelineData: this->_pipelines | std::views::values) {
+            pipelineData.descriptors.clear();
+        }
+
+        this->_retiredResources = std::vector<RetiredResources>(frameCount);
+        this->_frameCaptures = std::vector<FrameCaptureData>(frameCount);
+        this->_currentFrameIdx = 0;
+
+        if (this->_physicalDeviceProvider->getPhysicalDevice().timestampValidBits > 0) {
+            const auto queryPoolCreateInfo = vk::QueryPoolCreateInfo()
+                                                 .setQueryType(vk::QueryType::eTimestamp)
+                                                 .setQueryCount(frameCount * TIMESTAMPS_PER_FRAME);
+
+            this->_queryPool = device->createQueryPoolUnique(queryPoolCreateInfo);
+        } else {
+            this->_queryPool.reset();
+        }
+
+        this->_log->writeDebug(
+            TAG, "Frame data created for {} frame(s) in flight, GPU timestamps are {}", frameCount,
+            this->_queryPool ? "enabled" : "disabled"
+        );
+    }
+
+    void VkRenderContext::resolveGpuTime(const std::uint32_t frameIdx) {
+        auto &frameData = this->_frameData.at(frameIdx);
+
+        if (!this->_queryPool || !frameData.timestampsWritten) {
+            return;
+        }
+
+        frameData.timestampsWritten = false;
+
+        // frame is already finished, so results are available without waiting
+        const auto queryCount = FRAME_TIMESTAMP_COUNT + 2 * static_cast<std::uint32_t>(frameData.gpuScopes.size());
+        auto timestamps = std::vector<std::uint64_t>(queryCount);
+
+        const auto result = this->_logicalDeviceProvider->getLogicalDevice().handle->getQueryPoolResults(
+            this->_queryPool.get(), frameIdx * TIMESTAMPS_PER_FRAME, queryCount,
+            timestamps.size() * sizeof(std::uint64_t), timestamps.data(), sizeof(std::uint64_t),
+            vk::QueryResultFlagBits::e64
+        );
+
+        if (result != vk::Result::eSuccess) {
+            return;
+        }
+
+        const auto &physicalDevice = this->_physicalDeviceProvider->getPhysicalDevice();
+        const auto mask = physicalDevice.timestampValidBits >= 64
+                              ? std::numeric_limits<std::uint64_t>::max()
+                              : (std::uint64_t {1} << physicalDevice.timestampValidBits) - 1;
+
+        const auto toSeconds = [&](const std::uint64_t from, const std::uint64_t to) {
+            return static_cast<float>(
+                static_cast<double>((to - from) & mask) * physicalDevice.properties.limits.timestampPeriod * 1e-9
+            );
+        };
+
+        this->_gpuTime = toSeconds(timestamps[0], timestamps[1]);
+
+        auto timings = GpuFrameTimings {
+            .submitTime = frameData.submitTime,
+            .scopes = {},
+        };
+
+        timings.scopes.reserve(frameData.gpuScopes.size());
+
+        for (std::uint32_t scopeIdx = 0; scopeIdx < frameData.gpuScopes.size(); scopeIdx++) {
+            const auto &scope = frameData.gpuScopes.at(scopeIdx);
+
+            timings.scopes.push_back(GpuScopeTiming {
+                .tag = scope.tag,
+                .depth = scope.depth,
+                .begin = toSeconds(timestamps[0], timestamps[FRAME_TIMESTAMP_COUNT + 2 * scopeIdx]),
+                .end = toSeconds(timestamps[0], timestamps[FRAME_TIMESTAMP_COUNT + 2 * scopeIdx + 1]),
+            });
+        }
+
+        frameData.gpuScopes.clear();
+
+        this->_gpuTimings = std::move(timings);
+    }
+
+    void VkRenderContext::recordFrameCapture() {
+        auto &capture = this->_frameCaptures.at(this->_currentFrameIdx);
+        const auto extent = this->_swapchain.extent;
+        const auto size = static_cast<vk::DeviceSize>(extent.width) * extent.height * 4;
+
+        if (!capture.buffer || capture.extent != extent) {
+            auto [buffer, bufferMemory, data] = this->_bufferFactory->makeBuffer(
+                vk::BufferUsageFlagBits::eTransferDst, size, true
+            );
+
+            capture.extent = extent;
+            capture.buffer = std::move(buffer);
+            capture.bufferMemory = std::move(bufferMemory);
+            capture.data = data;
+        }
+
+        const auto &commandBuffer = this->_currentState->commandBuffer;
+        const auto image = this->_swapchain.images.at(this->_currentState->imageIdx);
+
+        constexpr auto subresourceRange = vk::ImageSubresourceRange()
+                                              .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                                              .setBaseMipLevel(0)
+                                              .setLevelCount(1)
+                                              .setBaseArrayLayer(0)
+                                              .setLayerCount(1);
+
+        const auto toTransfer = vk::ImageMemoryBarrier()
+                                    .setImage(image)
+                                    .setSubresourceRange(subresourceRange)
+                                    .setOldLayout(vk::ImageLayout::ePresentSrcKHR)
+                                    .setNewLayout(vk::ImageLayout::eTransferSrcOptimal)
+                                    .setSrcAccessMask(vk::AccessFlagBits::eColorAttachmentWrite)
+                                    .setDstAccessMask(vk::AccessFlagBits::eTransferRead);
+
+        commandBuffer.pipelineBarrier(
+            vk::PipelineStageFlagBits::eColorAttachmentOutput, vk::PipelineStageFlagBits::eTransfer, {}, {}, {},
+            toTransfer
+        );
+
+        constexpr auto subresourceLayers = vk::ImageSubresourceLayers()
+                                               .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                                               .setMipLevel(0)
+                                               .setBaseArrayLayer(0)
+                                               .setLayerCount(1);
+
+        const auto region = vk::BufferImageCopy()
+                                .setBufferOffset(0)
+                                .setBufferRowLength(0)
+                                .setBufferImageHeight(0)
+                                .setImageSubresource(subresourceLayers)
+                                .setImageOffset(vk::Offset3D(0, 0, 0))
+                                .setImageExtent(vk::Extent3D(extent, 1));
+
+        commandBuffer.copyImageToBuffer(image, vk::ImageLayout::eTransferSrcOptimal, capture.buffer.get(), region);
+
+        const auto toPresent = vk::ImageMemoryBarrier()
+                                   .setImage(image)
+                                   .setSubresourceRange(subresourceRange)
+                                   .setOldLayout(vk::ImageLayout::eTransferSrcOptimal)
+                                   .setNewLayout(vk::ImageLayout::ePresentSrcKHR)
+                                   .setSrcAccessMask(vk::AccessFlagBits::eTransferRead)
+                                   .setDstAccessMask({});
+
+        const auto toHost = vk::BufferMemoryBarrier()
+                                .setBuffer(capture.buffer.get())
+                                .setOffset(0)
+                                .setSize(size)
+                                .setSrcAccessMask(vk::AccessFlagBits::eTransferWrite)
+                                .setDstAccessMask(vk::AccessFlagBits::eHostRead);
+
+        commandBuffer.pipelineBarrier(
+            vk::PipelineStageFlagBits::eTransfer,
+            vk::PipelineStageFlagBits::eHost | vk::PipelineStageFlagBits::eBottomOfPipe, {}, {}, toHost, toPresent
+        );
+
+        capture.pendingFrameIdx = this->_frameCounter;
+    }
+
+    void VkRenderContext::deliverFrameCapture(const std::uint32_t frameIdx) {
+        auto &capture = this->_frameCaptures.at(frameIdx);
+
+        if (!capture.pendingFrameIdx.has_value()) {
+            return;
+        }
+
+        auto frame = FrameCapture {
+            .frameIdx = *capture.pendingFrameIdx,
+            .width = capture.extent.width,
+            .height = capture.extent.height,
+            .data = std::vector<std::byte>(static_cast<std::size_t>(capture.extent.width) * capture.extent.height * 4),
+        };
+
+        std::memcpy(frame.data.data(), capture.data, frame.data.size());
+
+        capture.pendingFrameIdx = std::nullopt;
+
+        for (const auto &handler: this->_frameCaptureHandlers) {
+            handler->onFrameCaptured(frame);
+        }
+    }
 }
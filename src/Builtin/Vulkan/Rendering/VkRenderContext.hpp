@@ -1,24 +1,37 @@
 #ifndef PENROSE_BUILTIN_VULKAN_RENDERING_VK_RENDER_CONTEXT_HPP
 #define PENROSE_BUILTIN_VULKAN_RENDERING_VK_RENDER_CONTEXT_HPP
 
-#include <array>
+#include <atomic>
 #include <cstdint>
 #include <initializer_list>
 #include <map>
 #include <optional>
 #include <set>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include <vulkan/vulkan.hpp>
 
 #include <Penrose/Common/Log.hpp>
+#include <Penrose/Performance/MetricsRegistry.hpp>
+#include <Penrose/Performance/Profiler.hpp>
+#include <Penrose/Rendering/FrameCapture.hpp>
+#include <Penrose/Rendering/FramePacing.hpp>
+#include <Penrose/Rendering/GpuTimings.hpp>
 #include <Penrose/Rendering/Graph/GraphInfo.hpp>
 #include <Penrose/Rendering/Graph/TargetInfo.hpp>
 #include <Penrose/Rendering/RenderContext.hpp>
 #include <Penrose/Resources/ResourceSet.hpp>
 
+#include "src/Rendering/Graph/GraphCompiler.hpp"
+
 #include "src/Builtin/Vulkan/Constants.hpp"
+#include "src/Builtin/Vulkan/Rendering/VkBindlessDescriptorSet.hpp"
+#include "src/Builtin/Vulkan/Rendering/Objects/VkBufferFactory.hpp"
 #include "src/Builtin/Vulkan/Rendering/Objects/VkImageFactory.hpp"
 #include "src/Builtin/Vulkan/Rendering/Objects/VkInternalObjectFactory.hpp"
+#include "src/Builtin/Vulkan/Rendering/Objects/VkPhysicalDeviceProvider.hpp"
 #include "src/Builtin/Vulkan/Rendering/Objects/VkPipelineFactory.hpp"
 #include "src/Builtin/Vulkan/Rendering/Objects/VkPipelineInstance.hpp"
 #include "src/Builtin/Vulkan/Rendering/Objects/VkSwapchain.hpp"
@@ -29,19 +42,15 @@ namespace Penrose {
 
     class VkRenderContext final: public RenderContext {
     public:
-        struct FrameData {
-            vk::UniqueFence fence;
-            vk::UniqueCommandBuffer commandBuffer;
-            vk::UniqueSemaphore imageReady;
-            vk::UniqueSemaphore renderFinished;
-        };
-
         VkRenderContext(
-            ResourceProxy<Log> log, ResourceProxy<VkLogicalDeviceProvider> logicalDeviceProvider,
+            ResourceProxy<Log> log, ResourceProxy<VkPhysicalDeviceProvider> physicalDeviceProvider,
+            ResourceProxy<VkLogicalDeviceProvider> logicalDeviceProvider,
             ResourceProxy<VkInternalObjectFactory> internalObjectFactory, ResourceProxy<VkImageFactory> imageFactory,
             ResourceProxy<VkPipelineFactory> pipelineFactory, ResourceProxy<VkSwapchainFactory> swapchainFactory,
-            VkSwapchain &&swapchain, vk::UniqueCommandPool &&commandPool, vk::UniqueDescriptorPool &&descriptorPool,
-            std::array<FrameData, INFLIGHT_FRAME_COUNT> &&frameData
+            ResourceProxy<VkBindlessDescriptorSet> bindlessDescriptorSet, ResourceProxy<VkBufferFactory> bufferFactory,
+            ResourceProxy<FrameCaptureHandler> frameCaptureHandlers, ResourceProxy<MetricsRegistry> metrics,
+            ResourceProxy<Profiler> profiler, const FramePacingInfo &pacingInfo, VkSwapchain &&swapchain,
+            vk::UniqueCommandPool &&commandPool, vk::UniqueDescriptorPool &&descriptorPool
         );
         ~VkRenderContext() override;
 
@@ -54,8 +63,28 @@ namespace Penrose {
 
         void invalidate() override;
 
+        void setPacingInfo(const FramePacingInfo &pacingInfo) override;
+
+        [[nodiscard]] std::optional<float> getGpuTime() const override { return this->_gpuTime; }
+
+        void beginGpuScope(Profiler::TagId tag) override;
+        void endGpuScope() override;
+
+        [[nodiscard]] std::optional<GpuFrameTimings> takeGpuTimings() override {
+            return std::exchange(this->_gpuTimings, std::nullopt);
+        }
+
+        void warmUpPipelines(const std::vector<PipelineWarmUpInfo> &warmUp) override;
+
+        [[nodiscard]] std::uint32_t getMidFramePipelineCount() const override {
+            return this->_midFramePipelineCount.load();
+        }
+
         [[nodiscard]] vk::ImageView useTarget(const TargetInfo &target);
         [[nodiscard]] vk::RenderPass usePass(const GraphInfo &graph);
+        [[nodiscard]] const CompiledGraph &getCompiledGraph(const GraphInfo &graph) const;
+        [[nodiscard]] Profiler::TagId getGraphGpuTag(const GraphInfo &graph) const;
+        [[nodiscard]] Profiler::TagId getPassGpuTag(const GraphInfo &graph, std::uint32_t passIdx) const;
         [[nodiscard]] vk::Framebuffer useFramebuffer(
             const std::initializer_list<TargetInfo> &targets, const GraphInfo &graph, const vk::Extent2D &extent
         );
@@ -70,6 +99,10 @@ namespace Penrose {
 
         [[nodiscard]] vk::DescriptorPool getDescriptorPool() const { return this->_descriptorPool.get(); }
 
+        [[nodiscard]] vk::DescriptorSet getBindlessDescriptorSet() const {
+            return this->_bindlessDescriptorSet->getHandle();
+        }
+
         [[nodiscard]] const vk::CommandBuffer &getCurrentCommandBuffer() const {
             return this->_currentState->commandBuffer;
         }
@@ -78,10 +111,28 @@ namespace Penrose {
         using ImageTarget = std::tuple<TargetInfo, VkImageInternal>;
         using PipelineKey = std::tuple<std::string, vk::RenderPass, std::uint32_t>;
 
+        struct TransientSlot {
+            std::vector<TargetInfo> targets;
+            VkAliasedImageSet images;
+        };
+
         struct Pass {
             GraphInfo info;
+            CompiledGraph compiled;
             vk::UniqueRenderPass pass;
+
+            // GPU scope tags are interned once on compilation, graph passes are indexed in order of graph info
+            Profiler::TagId gpuTag;
+            std::vector<Profiler::TagId> gpuPassTags;
             std::map<std::vector<vk::ImageView>, vk::UniqueFramebuffer> framebuffers;
+
+            // alias slots are assigned per compiled graph, so each graph keeps its own slots
+            std::vector<TransientSlot> transientSlots;
+        };
+
+        struct RetiredResources {
+            std::vector<VkAliasedImageSet> images;
+            std::vector<vk::UniqueFramebuffer> framebuffers;
         };
 
         struct PipelineDescriptorData {
@@ -91,36 +142,97 @@ namespace Penrose {
 
         struct PipelineData {
             std::unique_ptr<VkPipelineInstance> instance;
-            std::map<std::string, std::array<PipelineDescriptorData, INFLIGHT_FRAME_COUNT>> descriptors;
+            std::map<std::string, std::vector<PipelineDescriptorData>> descriptors;
+        };
+
+        struct FrameCaptureData {
+            vk::Extent2D extent;
+            vk::UniqueBuffer buffer;
+            vk::UniqueDeviceMemory bufferMemory;
+            Buffer::DataPtr data = nullptr;
+            std::optional<std::uint64_t> pendingFrameIdx;
+        };
+
+        struct GpuScope {
+            Profiler::TagId tag;
+            std::uint32_t depth;
+        };
+
+        struct FrameData {
+            vk::UniqueCommandBuffer commandBuffer;
+            vk::UniqueSemaphore imageReady;
+            vk::UniqueSemaphore renderFinished;
+
+            // value of timeline semaphore, which is signaled when frame is finished
+            std::uint64_t timelineValue = 0;
+            bool timestampsWritten = false;
+
+            // every scope owns pair of timestamp queries, which follow frame timestamps in order of scopes
+            std::vector<GpuScope> gpuScopes;
+            std::uint64_t submitTime = 0;
         };
 
         struct State {
             std::uint32_t imageIdx;
             vk::CommandBuffer commandBuffer;
-            vk::Fence fence;
             vk::Semaphore imageReady;
             vk::Semaphore renderFinished;
             std::set<vk::UniqueDescriptorSet, VkUniqueDescriptorSetLess> descriptors;
         };
 
         ResourceProxy<Log> _log;
+        ResourceProxy<VkPhysicalDeviceProvider> _physicalDeviceProvider;
         ResourceProxy<VkLogicalDeviceProvider> _logicalDeviceProvider;
         ResourceProxy<VkInternalObjectFactory> _internalObjectFactory;
         ResourceProxy<VkImageFactory> _imageFactory;
         ResourceProxy<VkPipelineFactory> _pipelineFactory;
         ResourceProxy<VkSwapchainFactory> _swapchainFactory;
+        ResourceProxy<VkBindlessDescriptorSet> _bindlessDescriptorSet;
+        ResourceProxy<VkBufferFactory> _bufferFactory;
+        ResourceProxy<FrameCaptureHandler> _frameCaptureHandlers;
+        ResourceProxy<MetricsRegistry> _metrics;
+        ResourceProxy<Profiler> _profiler;
+
+        MetricCounter *_descriptorWriteMetric;
+        MetricCounter *_framebufferMissMetric;
+        MetricCounter *_pipelineMissMetric;
+        MetricHistogram *_frameWaitMetric;
+
+        FramePacingInfo _pacingInfo;
 
         vk::UniqueCommandPool _commandPool;
         vk::UniqueDescriptorPool _descriptorPool;
         VkSwapchain _swapchain;
-        std::array<FrameData, INFLIGHT_FRAME_COUNT> _frameData;
+        vk::UniqueSemaphore _timeline;
+        vk::UniqueQueryPool _queryPool;
+        std::vector<FrameData> _frameData;
 
         std::uint32_t _currentFrameIdx = 0;
+        std::uint32_t _offscreenImageIdx = 0;
+        std::uint64_t _frameCounter = 0;
+        std::uint64_t _timelineValue = 0;
+        std::optional<float> _gpuTime;
+        std::optional<GpuFrameTimings> _gpuTimings;
+        std::vector<std::optional<std::uint32_t>> _gpuScopeStack;
+        bool _gpuScopeOverflowReported = false;
+        std::atomic_uint32_t _midFramePipelineCount = 0;
         std::optional<State> _currentState;
 
         std::map<std::string, ImageTarget> _imageTargets;
+        std::vector<RetiredResources> _retiredResources;
         std::map<std::string, Pass> _passes;
         std::map<PipelineKey, PipelineData> _pipelines;
+        std::vector<FrameCaptureData> _frameCaptures;
+
+        [[nodiscard]] vk::ImageView useTransientTarget(
+            Pass &passInfo, const TargetInfo &target, std::uint32_t aliasSlot
+        );
+
+        void makeFrameData();
+        void resolveGpuTime(std::uint32_t frameIdx);
+
+        void recordFrameCapture();
+        void deliverFrameCapture(std::uint32_t frameIdx);
     };
 }
 
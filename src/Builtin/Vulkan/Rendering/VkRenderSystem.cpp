@@ -18,7 +18,8 @@ namespace Penrose {
           _bufferFactory(resources->get<VkBufferFactory>()),
           _imageFactory(resources->get<VkImageFactory>()),
           _pipelineFactory(resources->get<VkPipelineFactory>()),
-          _swapchainFactory(resources->get<VkSwapchainFactory>()) {
+          _swapchainFactory(resources->get<VkSwapchainFactory>()),
+          _bindlessDescriptorSet(resources->get<VkBindlessDescriptorSet>()) {
         //
     }
 
@@ -42,6 +43,7 @@ namespace Penrose {
             std::throw_with_nested(EngineError("Failed to create logical device"));
         }
 
+        this->_bindlessDescriptorSet->init();
         this->_bufferFactory->init();
         this->_imageFactory->init();
         this->_pipelineFactory->init();
@@ -51,13 +53,16 @@ namespace Penrose {
         this->_pipelineFactory->destroy();
         this->_imageFactory->destroy();
         this->_bufferFactory->destroy();
+        this->_bindlessDescriptorSet->destroy();
 
         this->_logicalDevice = std::nullopt;
     }
 
     RenderContext *VkRenderSystem::makeRenderContext() {
         const auto surface = this->_surfaceManager->getSurface();
-        auto swapchain = this->_swapchainFactory->makeSwapchain(surface);
+        const auto pacingInfo = FramePacingInfo();
+
+        auto swapchain = this->_swapchainFactory->makeSwapchain(surface, pacingInfo.mode);
 
         const auto commandPoolCreateInfo = vk::CommandPoolCreateInfo()
                                                .setFlags(vk::CommandPoolCreateFlagBits::eResetCommandBuffer)
@@ -87,30 +92,13 @@ namespace Penrose {
 
         auto descriptorPool = this->_logicalDevice->handle->createDescriptorPoolUnique(descriptorPoolCreateInfo);
 
-        const auto commandBufferAllocateInfo = vk::CommandBufferAllocateInfo()
-                                                   .setLevel(vk::CommandBufferLevel::ePrimary)
-                                                   .setCommandPool(commandPool.get())
-                                                   .setCommandBufferCount(INFLIGHT_FRAME_COUNT);
-
-        auto commandBuffers = this->_logicalDevice->handle->allocateCommandBuffersUnique(commandBufferAllocateInfo);
-
-        std::array<VkRenderContext::FrameData, INFLIGHT_FRAME_COUNT> frameData;
-        for (std::uint32_t idx = 0; idx < INFLIGHT_FRAME_COUNT; ++idx) {
-            frameData[idx] = VkRenderContext::FrameData {
-                .fence = this->_logicalDevice->handle->createFenceUnique(
-                    vk::FenceCreateInfo().setFlags(vk::FenceCreateFlagBits::eSignaled)
-                ),
-                .commandBuffer = std::move(commandBuffers.at(idx)),
-                .imageReady = this->_logicalDevice->handle->createSemaphoreUnique(vk::SemaphoreCreateInfo()),
-                .renderFinished = this->_logicalDevice->handle->createSemaphoreUnique(vk::SemaphoreCreateInfo())
-            };
-        }
-
         return new VkRenderContext(
-            this->_log, this->_resources->get<VkLogicalDeviceProvider>(),
-            this->_resources->get<VkInternalObjectFactory>(), this->_imageFactory, this->_pipelineFactory,
-            this->_swapchainFactory, std::move(swapchain), std::move(commandPool), std::move(descriptorPool),
-            std::move(frameData)
+            this->_log, this->_resources->get<VkPhysicalDeviceProvider>(),
+            this->_resources->get<VkLogicalDeviceProvider>(), this->_resources->get<VkInternalObjectFactory>(),
+            this->_imageFactory, this->_pipelineFactory, this->_swapchainFactory, this->_bindlessDescriptorSet,
+            this->_bufferFactory, this->_resources->get<FrameCaptureHandler>(),
+            this->_resources->get<MetricsRegistry>(), this->_resources->get<Profiler>(), pacingInfo,
+            std::move(swapchain), std::move(commandPool), std::move(descriptorPool)
         );
     }
 }
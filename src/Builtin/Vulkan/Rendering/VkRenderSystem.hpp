@@ -19,6 +19,7 @@
 #include "src/Builtin/Vulkan/Rendering/Objects/VkPhysicalDeviceSelector.hpp"
 #include "src/Builtin/Vulkan/Rendering/Objects/VkPipelineFactory.hpp"
 #include "src/Builtin/Vulkan/Rendering/Objects/VkSwapchainFactory.hpp"
+#include "src/Builtin/Vulkan/Rendering/VkBindlessDescriptorSet.hpp"
 
 namespace Penrose {
 
@@ -52,6 +53,7 @@ namespace Penrose {
         ResourceProxy<VkImageFactory> _imageFactory;
         ResourceProxy<VkPipelineFactory> _pipelineFactory;
         ResourceProxy<VkSwapchainFactory> _swapchainFactory;
+        ResourceProxy<VkBindlessDescriptorSet> _bindlessDescriptorSet;
 
         std::optional<VkPhysicalDevice> _physicalDevice;
         std::optional<VkLogicalDevice> _logicalDevice;
@@ -35,6 +35,8 @@ namespace Penrose {
         const auto framebuffer = this->_renderContext->useFramebuffer(targets, graph, rect.extent);
         const auto &commandBuffer = this->_renderContext->getCurrentCommandBuffer();
 
+        this->_renderContext->beginGpuScope(this->_renderContext->getGraphGpuTag(graph));
+
         commandBuffer.beginRenderPass(
             vk::RenderPassBeginInfo()
                 .setRenderPass(pass)
@@ -44,11 +46,17 @@ namespace Penrose {
             vk::SubpassContents::eInline
         );
 
-        for (std::uint32_t idx = 0; idx < graph.passes.size(); idx++) {
-            if (idx > 0) {
+        const auto &compiled = this->_renderContext->getCompiledGraph(graph);
+
+        for (std::uint32_t subpassIdx = 0; subpassIdx < compiled.passes.size(); subpassIdx++) {
+            if (subpassIdx > 0) {
                 commandBuffer.nextSubpass(vk::SubpassContents::eInline);
             }
 
+            const auto idx = compiled.passes.at(subpassIdx).passIdx;
+
+            this->_renderContext->beginGpuScope(this->_renderContext->getPassGpuTag(graph, idx));
+
             if (graph.passes.at(idx).function.has_value()) {
                 const auto function = *graph.passes.at(idx).function;
 
@@ -62,7 +70,7 @@ namespace Penrose {
                 } else {
                     try {
                         auto commandRecorder = std::make_unique<VkCommandRecorder>(
-                            this->_renderContext, commandBuffer, pass, idx
+                            this->_renderContext, commandBuffer, pass, subpassIdx
                         );
 
                         it->second(commandRecorder.get());
@@ -73,8 +81,12 @@ namespace Penrose {
                     }
                 }
             }
+
+            this->_renderContext->endGpuScope();
         }
 
         commandBuffer.endRenderPass();
+
+        this->_renderContext->endGpuScope();
     }
 }
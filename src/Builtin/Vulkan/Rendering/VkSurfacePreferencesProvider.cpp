@@ -15,18 +15,19 @@ namespace Penrose {
     }
 
     SurfacePreferences VkSurfacePreferencesProvider::getPreferencesFor(
-        const std::shared_ptr<Surface> &surface, const vk::SurfaceKHR &vkSurface
+        const std::shared_ptr<Surface> &surface, const vk::SurfaceKHR &vkSurface, const FramePacingMode pacingMode
     ) {
         auto &physicalDevice = this->_physicalDeviceProvider->getPhysicalDevice().handle;
 
         const auto surfaceCapabilities = physicalDevice.getSurfaceCapabilitiesKHR(vkSurface);
         const auto surfaceFormats = physicalDevice.getSurfaceFormatsKHR(vkSurface);
+        const auto presentModes = physicalDevice.getSurfacePresentModesKHR(vkSurface);
         const auto [width, height] = surface->getSize();
 
         auto extent = getPreferredExtent(surfaceCapabilities, width, height);
         auto [format, colorSpace] = getPreferredSurfaceFormat(surfaceFormats);
         auto imageCount = getPreferredImageCount(surfaceCapabilities);
-        auto presentMode = getPreferredPresentMode();
+        auto presentMode = getPreferredPresentMode(presentModes, pacingMode);
 
         this->_log->writeDebug(
             TAG,
@@ -81,8 +82,32 @@ namespace Penrose {
         return std::make_tuple(it->format, it->colorSpace);
     }
 
-    vk::PresentModeKHR VkSurfacePreferencesProvider::getPreferredPresentMode() {
-        // TODO
-        return vk::PresentModeKHR::eImmediate;
+    vk::PresentModeKHR VkSurfacePreferencesProvider::getPreferredPresentMode(
+        const std::vector<vk::PresentModeKHR> &presentModes, const FramePacingMode pacingMode
+    ) {
+        std::vector<vk::PresentModeKHR> preferredModes;
+
+        switch (pacingMode) {
+            case FramePacingMode::Unlimited:
+                preferredModes = {vk::PresentModeKHR::eImmediate, vk::PresentModeKHR::eMailbox};
+                break;
+
+            case FramePacingMode::TargetRate:
+                // rate is limited by pacer, so mailbox is preferred to avoid tearing
+                preferredModes = {vk::PresentModeKHR::eMailbox, vk::PresentModeKHR::eImmediate};
+                break;
+
+            default:
+                break;
+        }
+
+        for (const auto &preferredMode: preferredModes) {
+            if (std::ranges::find(presentModes, preferredMode) != presentModes.end()) {
+                return preferredMode;
+            }
+        }
+
+        // FIFO is the only mode that is required to be supported
+        return vk::PresentModeKHR::eFifo;
     }
 }
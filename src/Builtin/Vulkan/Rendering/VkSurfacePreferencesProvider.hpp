@@ -9,6 +9,7 @@
 #include <vulkan/vulkan.hpp>
 
 #include <Penrose/Common/Log.hpp>
+#include <Penrose/Rendering/FramePacing.hpp>
 #include <Penrose/Rendering/Surface.hpp>
 #include <Penrose/Resources/ResourceSet.hpp>
 
@@ -30,7 +31,7 @@ namespace Penrose {
         ~VkSurfacePreferencesProvider() override = default;
 
         [[nodiscard]] SurfacePreferences getPreferencesFor(
-            const std::shared_ptr<Surface> &surface, const vk::SurfaceKHR &vkSurface
+            const std::shared_ptr<Surface> &surface, const vk::SurfaceKHR &vkSurface, FramePacingMode pacingMode
         );
 
     private:
@@ -47,7 +48,9 @@ namespace Penrose {
             const std::vector<vk::SurfaceFormatKHR> &surfaceFormats
         );
 
-        [[nodiscard]] static vk::PresentModeKHR getPreferredPresentMode();
+        [[nodiscard]] static vk::PresentModeKHR getPreferredPresentMode(
+            const std::vector<vk::PresentModeKHR> &presentModes, FramePacingMode pacingMode
+        );
     };
 }
 
@@ -37,6 +37,9 @@ namespace Penrose {
             case BufferType::Index:
                 return vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eIndexBuffer;
 
+            case BufferType::Storage:
+                return vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eStorageBuffer;
+
             default:
                 throw EngineError::notImplemented();
         }
@@ -144,7 +147,7 @@ namespace Penrose {
         }
 
         if (usage & TargetUsage::Color) {
-            vkUsage |= vk::ImageUsageFlagBits::eInputAttachment;
+            vkUsage |= vk::ImageUsageFlagBits::eColorAttachment;
         }
 
         if (usage & TargetUsage::DepthStencil) {
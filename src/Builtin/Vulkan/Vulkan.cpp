@@ -9,6 +9,7 @@
 #include "src/Builtin/Vulkan/Rendering/Objects/VkSamplerFactory.hpp"
 #include "src/Builtin/Vulkan/Rendering/Objects/VkShaderFactory.hpp"
 #include "src/Builtin/Vulkan/Rendering/Objects/VkSwapchainFactory.hpp"
+#include "src/Builtin/Vulkan/Rendering/VkBindlessDescriptorSet.hpp"
 #include "src/Builtin/Vulkan/Rendering/VkMemoryAllocator.hpp"
 #include "src/Builtin/Vulkan/Rendering/VkRenderSystem.hpp"
 #include "src/Builtin/Vulkan/Rendering/VkSurfacePreferencesProvider.hpp"
@@ -21,6 +22,7 @@ namespace Penrose {
         resources.add<VulkanBackend>().group(ResourceGroup::Backend).implements<Initializable>().done();
 
         resources.add<VkMemoryAllocator>().group(ResourceGroup::Rendering).done();
+        resources.add<VkBindlessDescriptorSet>().group(ResourceGroup::Rendering).done();
 
         resources.add<VkBufferFactory>().group(ResourceGroup::Rendering).implements<BufferFactory>().done();
         resources.add<VkImageFactory>().group(ResourceGroup::Rendering).implements<ImageFactory>().done();
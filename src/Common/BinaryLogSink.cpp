@@ -0,0 +1,311 @@
+#include <Penrose/Common/BinaryLogSink.hpp>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <optional>
+#include <ranges>
+
+#include <fmt/core.h>
+
+#include <Penrose/Common/EngineError.hpp>
+#include <Penrose/Common/Log.hpp>
+
+namespace Penrose {
+
+    inline constexpr std::array<char, 8> MAGIC = {'P', 'N', 'R', 'S', 'L', 'O', 'G', '1'};
+    inline constexpr std::uint32_t VERSION = 1;
+
+    inline constexpr std::size_t HEADER_SIZE = MAGIC.size() + 2 * sizeof(std::uint32_t);
+    inline constexpr std::size_t RECORD_PREFIX_SIZE = sizeof(std::uint32_t) + sizeof(std::uint8_t);
+    inline constexpr std::size_t TAG_PAYLOAD_SIZE = sizeof(std::uint16_t);
+    inline constexpr std::size_t MESSAGE_PAYLOAD_SIZE = sizeof(std::int64_t) + sizeof(std::uint8_t)
+                                                        + sizeof(std::uint16_t) + sizeof(std::uint64_t);
+
+    // records are never larger than message with payload of maximum size, so decoder rejects larger sizes as corrupted
+    inline constexpr std::size_t MAX_RECORD_SIZE = MESSAGE_PAYLOAD_SIZE + Log::MAX_MESSAGE_SIZE;
+
+    inline constexpr std::string_view FILE_EXTENSION = ".plog";
+
+    enum class RecordType : std::uint8_t {
+        Tag = 0,
+        Message = 1
+    };
+
+    // values are written in little endian byte order regardless of platform
+    static void append(std::vector<std::byte> &buffer, const std::uint64_t value, const std::size_t size) {
+        for (std::size_t idx = 0; idx < size; idx++) {
+            buffer.push_back(static_cast<std::byte>((value >> (8 * idx)) & 0xFF));
+        }
+    }
+
+    static void append(std::vector<std::byte> &buffer, const std::string_view value) {
+        const auto bytes = reinterpret_cast<const std::byte *>(value.data());
+
+        buffer.insert(buffer.end(), bytes, bytes + value.size());
+    }
+
+    static void appendRecordPrefix(std::vector<std::byte> &buffer, const RecordType type, const std::size_t size) {
+        append(buffer, size, sizeof(std::uint32_t));
+        append(buffer, static_cast<std::uint8_t>(type), sizeof(std::uint8_t));
+    }
+
+    [[nodiscard]] static std::uint64_t read(const char *data, const std::size_t size) {
+        std::uint64_t value = 0;
+
+        for (std::size_t idx = 0; idx < size; idx++) {
+            value |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[idx])) << (8 * idx);
+        }
+
+        return value;
+    }
+
+    [[nodiscard]] static std::optional<std::uint64_t> tryGetFileIdx(
+        const std::filesystem::path &path, const std::string_view prefix
+    ) {
+        const auto name = path.filename().string();
+
+        if (!name.starts_with(prefix) || !name.ends_with(FILE_EXTENSION) || name.size() <= prefix.size() + 1
+            || name.at(prefix.size()) != '-') {
+            return std::nullopt;
+        }
+
+        const auto idxBegin = name.data() + prefix.size() + 1;
+        const auto idxEnd = name.data() + name.size() - FILE_EXTENSION.size();
+
+        std::uint64_t idx;
+        const auto [ptr, error] = std::from_chars(idxBegin, idxEnd, idx);
+
+        if (error != std::errc() || ptr != idxEnd) {
+            return std::nullopt;
+        }
+
+        return idx;
+    }
+
+    BinaryLogSink::~BinaryLogSink() {
+        this->flush();
+    }
+
+    void BinaryLogSink::setInfo(BinaryLogSinkInfo &&info) {
+        std::lock_guard guard(this->_mutex);
+
+        this->_info = std::forward<decltype(info)>(info);
+        this->_fileFailed = false;
+    }
+
+    void BinaryLogSink::write(const LogRecord &record) {
+        std::lock_guard guard(this->_mutex);
+
+        if (!this->_info.enabled || this->_fileFailed) {
+            return;
+        }
+
+        // files are rotated on record boundary before next record, so every file contains only complete records
+        if (!this->_file.is_open() || this->_fileSize + this->_buffer.size() >= this->_info.maxFileSize) {
+            this->writeBuffer();
+            this->openFile();
+
+            if (this->_fileFailed) {
+                return;
+            }
+        }
+
+        const auto tagId = this->useTag(record.tag.substr(0, MAX_RECORD_SIZE - TAG_PAYLOAD_SIZE));
+        const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(record.time.time_since_epoch());
+        const auto msg = record.msg.substr(0, Log::MAX_MESSAGE_SIZE);
+
+        appendRecordPrefix(this->_buffer, RecordType::Message, MESSAGE_PAYLOAD_SIZE + msg.size());
+        append(this->_buffer, static_cast<std::uint64_t>(time.count()), sizeof(std::int64_t));
+        append(this->_buffer, static_cast<std::uint8_t>(record.level), sizeof(std::uint8_t));
+        append(this->_buffer, tagId, sizeof(std::uint16_t));
+        append(this->_buffer, std::hash<std::thread::id>()(record.thread), sizeof(std::uint64_t));
+        append(this->_buffer, msg);
+    }
+
+    void BinaryLogSink::flush() {
+        std::lock_guard guard(this->_mutex);
+
+        this->writeBuffer();
+
+        if (this->_file.is_open()) {
+            this->_file.flush();
+        }
+    }
+
+    void BinaryLogSink::openFile() {
+        this->_file.close();
+        this->_tagIds.clear();
+        this->_buffer.clear();
+        this->_fileSize = 0;
+
+        // sink is invoked by log writer, so failures are not thrown and messages are dropped instead
+        std::error_code error;
+        std::filesystem::create_directories(this->_info.directory, error);
+
+        auto existing = std::vector<std::pair<std::uint64_t, std::filesystem::path>>();
+
+        for (const auto &entry: std::filesystem::directory_iterator(this->_info.directory, error)) {
+            if (const auto idx = tryGetFileIdx(entry.path(), this->_info.prefix); idx.has_value()) {
+                existing.emplace_back(*idx, entry.path());
+            }
+        }
+
+        // numbering is continued after restart, so files of previous runs are kept and rotated too
+        auto fileIdx = this->_fileIdx;
+
+        for (const auto &idx: existing | std::views::keys) {
+            fileIdx = std::max(fileIdx, idx);
+        }
+
+        fileIdx++;
+
+        const auto name = fmt::format("{}-{:06}{}", this->_info.prefix, fileIdx, FILE_EXTENSION);
+        const auto path = this->_info.directory / name;
+
+        this->_file.open(path, std::ios::binary | std::ios::out | std::ios::trunc);
+
+        if (!this->_file.is_open()) {
+            this->_fileFailed = true;
+
+            return;
+        }
+
+        this->_fileIdx = fileIdx;
+
+        const auto keptFrom = this->_fileIdx >= this->_info.maxFileCount ? this->_fileIdx - this->_info.maxFileCount + 1
+                                                                         : 0;
+
+        for (const auto &[idx, existingPath]: existing) {
+            if (idx < keptFrom) {
+                std::filesystem::remove(existingPath, error);
+            }
+        }
+
+        append(this->_buffer, std::string_view(MAGIC.data(), MAGIC.size()));
+        append(this->_buffer, VERSION, sizeof(std::uint32_t));
+        append(this->_buffer, 0, sizeof(std::uint32_t));
+    }
+
+    void BinaryLogSink::writeBuffer() {
+        if (this->_file.is_open()) {
+            this->_file.write(
+                reinterpret_cast<const char *>(this->_buffer.data()), static_cast<std::streamsize>(this->_buffer.size())
+            );
+
+            this->_fileSize += this->_buffer.size();
+        }
+
+        // buffer keeps its capacity, so steady logging does not allocate
+        this->_buffer.clear();
+    }
+
+    std::uint16_t BinaryLogSink::useTag(const std::string_view tag) {
+        const auto it = this->_tagIds.find(tag);
+
+        if (it != this->_tagIds.end()) {
+            return it->second;
+        }
+
+        const auto tagId = static_cast<std::uint16_t>(this->_tagIds.size());
+
+        this->_tagIds.emplace(tag, tagId);
+
+        appendRecordPrefix(this->_buffer, RecordType::Tag, TAG_PAYLOAD_SIZE + tag.size());
+        append(this->_buffer, tagId, sizeof(std::uint16_t));
+        append(this->_buffer, tag);
+
+        return tagId;
+    }
+
+    void readBinaryLog(std::istream &stream, const std::function<void(const BinaryLogEntry &)> &handler) {
+        std::array<char, HEADER_SIZE> header;
+
+        if (!stream.read(header.data(), header.size())
+            || std::memcmp(header.data(), MAGIC.data(), MAGIC.size()) != 0) {
+            throw EngineError("Stream does not contain binary log");
+        }
+
+        if (const auto version = read(header.data() + MAGIC.size(), sizeof(std::uint32_t)); version != VERSION) {
+            throw EngineError("Binary log version {} is not supported", version);
+        }
+
+        auto tags = std::map<std::uint16_t, std::string>();
+        auto payload = std::vector<char>(MAX_RECORD_SIZE);
+
+        while (true) {
+            std::array<char, RECORD_PREFIX_SIZE> prefix;
+
+            // incomplete trailing record is left by interrupted process, so it is silently skipped
+            if (!stream.read(prefix.data(), prefix.size())) {
+                break;
+            }
+
+            const auto size = static_cast<std::size_t>(read(prefix.data(), sizeof(std::uint32_t)));
+            const auto type = static_cast<RecordType>(prefix.at(sizeof(std::uint32_t)));
+
+            if (size > MAX_RECORD_SIZE) {
+                throw EngineError("Binary log contains record of size {}, which exceeds {}", size, MAX_RECORD_SIZE);
+            }
+
+            payload.resize(size);
+
+            if (!stream.read(payload.data(), static_cast<std::streamsize>(size))) {
+                break;
+            }
+
+            switch (type) {
+                case RecordType::Tag:
+                    {
+                        if (size < TAG_PAYLOAD_SIZE) {
+                            throw EngineError("Binary log contains malformed tag record");
+                        }
+
+                        const auto tagId = static_cast<std::uint16_t>(read(payload.data(), sizeof(std::uint16_t)));
+
+                        tags.insert_or_assign(
+                            tagId, std::string(payload.data() + TAG_PAYLOAD_SIZE, size - TAG_PAYLOAD_SIZE)
+                        );
+                        break;
+                    }
+
+                case RecordType::Message:
+                    {
+                        if (size < MESSAGE_PAYLOAD_SIZE) {
+                            throw EngineError("Binary log contains malformed message record");
+                        }
+
+                        const auto data = payload.data();
+                        const auto time = static_cast<std::int64_t>(read(data, sizeof(std::int64_t)));
+                        const auto level = read(data + 8, sizeof(std::uint8_t));
+                        const auto tagId = static_cast<std::uint16_t>(read(data + 9, sizeof(std::uint16_t)));
+                        const auto thread = read(data + 11, sizeof(std::uint64_t));
+
+                        const auto tagIt = tags.find(tagId);
+
+                        if (tagIt == tags.end()) {
+                            throw EngineError("Binary log refers to undefined tag {}", tagId);
+                        }
+
+                        handler(BinaryLogEntry {
+                            .level = static_cast<LogLevel>(level),
+                            .time = std::chrono::system_clock::time_point(
+                                std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                                    std::chrono::nanoseconds(time)
+                                )
+                            ),
+                            .thread = thread,
+                            .tag = tagIt->second,
+                            .msg = std::string_view(data + MESSAGE_PAYLOAD_SIZE, size - MESSAGE_PAYLOAD_SIZE),
+                        });
+                        break;
+                    }
+
+                default:
+                    // records of unknown types are skipped, so older decoders could read newer logs
+                    break;
+            }
+        }
+    }
+}
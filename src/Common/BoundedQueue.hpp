@@ -0,0 +1,110 @@
+#ifndef PENROSE_COMMON_BOUNDED_QUEUE_HPP
+#define PENROSE_COMMON_BOUNDED_QUEUE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace Penrose {
+
+    // bounded lock-free queue with per-cell sequence numbers, values are written and read in place, so cells could
+    // hold large records without extra copies
+    template <typename T, std::uint64_t Capacity>
+    requires((Capacity & (Capacity - 1)) == 0)
+    class BoundedQueue {
+    public:
+        BoundedQueue()
+            : _cells(std::make_unique<Cell[]>(Capacity)) {
+            for (std::uint64_t idx = 0; idx < Capacity; idx++) {
+                this->_cells[idx].sequence.store(idx, std::memory_order_relaxed);
+            }
+        }
+
+        template <typename Writer>
+        [[nodiscard]] bool tryPush(Writer &&writer) {
+            auto pos = this->_pushPos.load(std::memory_order_relaxed);
+            Cell *cell;
+
+            while (true) {
+                cell = &this->_cells[pos & MASK];
+
+                const auto sequence = cell->sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::int64_t>(sequence - pos);
+
+                if (diff == 0) {
+                    if (this->_pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = this->_pushPos.load(std::memory_order_relaxed);
+                }
+            }
+
+            writer(cell->value);
+            cell->sequence.store(pos + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        template <typename Reader>
+        [[nodiscard]] bool tryPop(Reader &&reader) {
+            auto pos = this->_popPos.load(std::memory_order_relaxed);
+            Cell *cell;
+
+            while (true) {
+                cell = &this->_cells[pos & MASK];
+
+                const auto sequence = cell->sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::int64_t>(sequence - (pos + 1));
+
+                if (diff == 0) {
+                    if (this->_popPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = this->_popPos.load(std::memory_order_relaxed);
+                }
+            }
+
+            reader(cell->value);
+            cell->sequence.store(pos + Capacity, std::memory_order_release);
+
+            return true;
+        }
+
+        // count of values, which were ever pushed or are being pushed
+        [[nodiscard]] std::uint64_t pushCount() const { return this->_pushPos.load(std::memory_order_acquire); }
+
+        // count of values, which were ever popped or are being popped
+        [[nodiscard]] std::uint64_t popCount() const { return this->_popPos.load(std::memory_order_acquire); }
+
+        [[nodiscard]] std::uint64_t size() const {
+            const auto pushPos = this->_pushPos.load(std::memory_order_relaxed);
+            const auto popPos = this->_popPos.load(std::memory_order_relaxed);
+
+            return pushPos > popPos ? pushPos - popPos : 0;
+        }
+
+        [[nodiscard]] static constexpr std::uint64_t capacity() { return Capacity; }
+
+    private:
+        static constexpr std::uint64_t MASK = Capacity - 1;
+
+        struct Cell {
+            std::atomic_uint64_t sequence;
+            T value;
+        };
+
+        std::unique_ptr<Cell[]> _cells;
+
+        // positions are updated by different threads, so they are kept on separate cache lines
+        alignas(64) std::atomic_uint64_t _pushPos = 0;
+        alignas(64) std::atomic_uint64_t _popPos = 0;
+    };
+}
+
+#endif // PENROSE_COMMON_BOUNDED_QUEUE_HPP
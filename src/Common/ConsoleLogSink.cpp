@@ -1,12 +1,25 @@
 #include "ConsoleLogSink.hpp"
 
 #include <iostream>
+#include <iterator>
+
+#include <fmt/core.h>
 
 #include "src/Utils/StringifyUtils.hpp"
 
 namespace Penrose {
 
-    void ConsoleLogSink::write(const LogLevel level, const std::string_view tag, const std::string_view msg) {
-        std::cout << toString(level) << "/" << tag << ":\t" << msg << std::endl;
+    void ConsoleLogSink::write(const LogRecord &record) {
+        fmt::format_to(
+            std::back_inserter(this->_buffer), "{}/{}:\t{}\n", toString(record.level), record.tag, record.msg
+        );
+    }
+
+    void ConsoleLogSink::flush() {
+        std::cout.write(this->_buffer.data(), static_cast<std::streamsize>(this->_buffer.size()));
+        std::cout.flush();
+
+        // buffer keeps its capacity, so steady logging does not allocate
+        this->_buffer.clear();
     }
 }
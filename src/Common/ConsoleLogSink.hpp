@@ -1,6 +1,8 @@
 #ifndef PENROSE_COMMON_CONSOLE_LOG_SINK_HPP
 #define PENROSE_COMMON_CONSOLE_LOG_SINK_HPP
 
+#include <string>
+
 #include <Penrose/Common/LogSink.hpp>
 #include <Penrose/Resources/Resource.hpp>
 
@@ -11,7 +13,11 @@ namespace Penrose {
     public:
         ~ConsoleLogSink() override = default;
 
-        void write(LogLevel level, std::string_view tag, std::string_view msg) override;
+        void write(const LogRecord &record) override;
+        void flush() override;
+
+    private:
+        std::string _buffer;
     };
 }
 
@@ -1,19 +1,177 @@
 #include "LogImpl.hpp"
 
+#include <algorithm>
+
 namespace Penrose {
 
+    inline static constexpr std::string_view TAG = "LogImpl";
+
+    // writer is not woken up on every message, so messages are written in batches
+    inline constexpr auto WRITER_INTERVAL = std::chrono::milliseconds(10);
+
     LogImpl::LogImpl(const ResourceSet *resources)
-        : _resources(resources) {
+        : _resources(resources),
+          _writer([this] { this->runWriter(); }) {
         //
     }
 
-    auto LogImpl::write(const LogLevel level, const std::string_view tag, const std::string_view msg) -> void {
-        for (const auto &sink: this->_sinks) {
-            sink->write(level, tag, msg);
+    LogImpl::~LogImpl() {
+        {
+            std::lock_guard guard(this->_writerMutex);
+
+            this->_stopRequested = true;
         }
+
+        this->_writerWakeUp.notify_one();
+        this->_writer.join();
+    }
+
+    void LogImpl::write(const LogLevel level, const std::string_view tag, const std::string_view msg) {
+        const auto time = std::chrono::system_clock::now();
+        const auto truncated = msg.size() > MAX_MESSAGE_SIZE;
+
+        const auto pushed = this->_queue.tryPush([&](Record &record) {
+            record.level = level;
+            record.time = time;
+            record.thread = std::this_thread::get_id();
+            record.tagSize = static_cast<std::uint16_t>(std::min(tag.size(), MAX_TAG_SIZE));
+            record.msgSize = static_cast<std::uint16_t>(std::min(msg.size(), MAX_MESSAGE_SIZE));
+
+            std::copy_n(tag.begin(), record.tagSize, record.tag.begin());
+            std::copy_n(msg.begin(), record.msgSize, record.msg.begin());
+        });
+
+        // writing thread is never blocked, so messages are dropped when writer falls behind
+        if (!pushed) {
+            this->_droppedCount.fetch_add(1, std::memory_order_relaxed);
+
+            return;
+        }
+
+        if (truncated) {
+            this->_truncatedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (level == LogLevel::Error || this->_queue.size() >= QUEUE_CAPACITY / 2) {
+            this->wakeUpWriter();
+        }
+    }
+
+    void LogImpl::flush() {
+        // sinks could write into log, writer thread must not wait for itself
+        if (std::this_thread::get_id() == this->_writer.get_id()) {
+            return;
+        }
+
+        const auto target = this->_queue.pushCount();
+
+        std::unique_lock lock(this->_writerMutex);
+
+        this->_flushRequested = true;
+        this->_writerWakeUp.notify_one();
+
+        this->_writerFlushed.wait(lock, [this, target] {
+            return this->_flushedCount >= target || this->_stopRequested;
+        });
+    }
+
+    LogStats LogImpl::getStats() const {
+        return LogStats {
+            .written = this->_writtenCount.load(std::memory_order_relaxed),
+            .dropped = this->_droppedCount.load(std::memory_order_relaxed),
+            .truncated = this->_truncatedCount.load(std::memory_order_relaxed),
+        };
     }
 
     void LogImpl::addSink(std::type_index &&type) {
-        this->_sinks.push_back(this->_resources->resolveOne<LogSink>(type));
+        const auto sink = this->_resources->resolveOne<LogSink>(type);
+
+        std::lock_guard guard(this->_sinksMutex);
+
+        this->_sinks.push_back(sink);
+    }
+
+    void LogImpl::wakeUpWriter() {
+        // notification could be missed while writer is busy, in that case messages are written on next interval
+        this->_writerWakeUp.notify_one();
+    }
+
+    void LogImpl::runWriter() {
+        std::unique_lock lock(this->_writerMutex);
+
+        while (true) {
+            const auto stop = this->_stopRequested;
+            this->_flushRequested = false;
+
+            lock.unlock();
+            this->drain();
+            lock.lock();
+
+            // writer is the only consumer, so every popped message is already written and flushed
+            this->_flushedCount = this->_queue.popCount();
+            this->_writerFlushed.notify_all();
+
+            if (stop) {
+                break;
+            }
+
+            this->_writerWakeUp.wait_for(lock, WRITER_INTERVAL, [this] {
+                return this->_stopRequested || this->_flushRequested;
+            });
+        }
+    }
+
+    void LogImpl::drain() {
+        std::lock_guard guard(this->_sinksMutex);
+
+        std::uint64_t count = 0;
+
+        const auto reader = [this](const Record &record) {
+            this->writeToSinks(LogRecord {
+                .level = record.level,
+                .time = record.time,
+                .thread = record.thread,
+                .tag = std::string_view(record.tag.data(), record.tagSize),
+                .msg = std::string_view(record.msg.data(), record.msgSize),
+            });
+        };
+
+        while (this->_queue.tryPop(reader)) {
+            count++;
+        }
+
+        const auto droppedCount = this->_droppedCount.load(std::memory_order_relaxed);
+        const auto reportDropped = droppedCount > this->_reportedDroppedCount;
+
+        if (reportDropped) {
+            const auto msg = fmt::format(
+                "{} message(s) were dropped, log queue is full", droppedCount - this->_reportedDroppedCount
+            );
+
+            this->_reportedDroppedCount = droppedCount;
+            this->writeToSinks(LogRecord {
+                .level = LogLevel::Warning,
+                .time = std::chrono::system_clock::now(),
+                .thread = std::this_thread::get_id(),
+                .tag = TAG,
+                .msg = msg,
+            });
+        }
+
+        if (count == 0 && !reportDropped) {
+            return;
+        }
+
+        for (const auto &sink: this->_sinks) {
+            sink->flush();
+        }
+
+        this->_writtenCount.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    void LogImpl::writeToSinks(const LogRecord &record) {
+        for (const auto &sink: this->_sinks) {
+            sink->write(record);
+        }
     }
 }
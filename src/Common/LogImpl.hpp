@@ -1,27 +1,75 @@
 #ifndef PENROSE_COMMON_LOG_IMPL_HPP
 #define PENROSE_COMMON_LOG_IMPL_HPP
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <list>
+#include <mutex>
+#include <thread>
 
 #include <Penrose/Common/Log.hpp>
 #include <Penrose/Resources/Resource.hpp>
 #include <Penrose/Resources/ResourceSet.hpp>
 
+#include "src/Common/BoundedQueue.hpp"
+
 namespace Penrose {
 
     class LogImpl final: public Resource<LogImpl>,
                          public Log {
     public:
+        static constexpr std::size_t MAX_TAG_SIZE = 64;
+        static constexpr std::uint64_t QUEUE_CAPACITY = 4096;
+
         explicit LogImpl(const ResourceSet *resources);
-        ~LogImpl() override = default;
+        ~LogImpl() override;
 
         void write(LogLevel level, std::string_view tag, std::string_view msg) override;
 
+        void flush() override;
+
+        [[nodiscard]] LogStats getStats() const override;
+
         void addSink(std::type_index &&type) override;
 
     private:
+        struct Record {
+            LogLevel level;
+            std::chrono::system_clock::time_point time;
+            std::thread::id thread;
+            std::uint16_t tagSize;
+            std::uint16_t msgSize;
+            std::array<char, MAX_TAG_SIZE> tag;
+            std::array<char, MAX_MESSAGE_SIZE> msg;
+        };
+
         const ResourceSet *_resources;
+
+        std::mutex _sinksMutex;
         std::list<LogSink *> _sinks;
+
+        BoundedQueue<Record, QUEUE_CAPACITY> _queue;
+
+        std::atomic_uint64_t _writtenCount = 0;
+        std::atomic_uint64_t _droppedCount = 0;
+        std::atomic_uint64_t _truncatedCount = 0;
+        std::uint64_t _reportedDroppedCount = 0;
+
+        std::mutex _writerMutex;
+        std::condition_variable _writerWakeUp;
+        std::condition_variable _writerFlushed;
+        std::uint64_t _flushedCount = 0;
+        bool _flushRequested = false;
+        bool _stopRequested = false;
+        std::thread _writer;
+
+        void wakeUpWriter();
+        void runWriter();
+        void drain();
+        void writeToSinks(const LogRecord &record);
     };
 }
 
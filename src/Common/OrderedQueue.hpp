@@ -2,6 +2,7 @@
 #define PENROSE_COMMON_ORDERED_QUEUE_HPP
 
 #include <functional>
+#include <list>
 #include <memory>
 
 namespace Penrose {
@@ -0,0 +1,154 @@
+#include "PngEncoder.hpp"
+
+#include <algorithm>
+#include <array>
+#include <string_view>
+
+#include <Penrose/Common/EngineError.hpp>
+
+namespace Penrose {
+
+    static constexpr std::array<std::uint8_t, 8> PNG_SIGNATURE = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+    static constexpr std::uint32_t BYTES_PER_PIXEL = 4;
+    static constexpr std::uint32_t MAX_STORED_BLOCK_SIZE = 0xFFFF;
+
+    static constexpr std::array<std::uint32_t, 256> CRC_TABLE = [] {
+        std::array<std::uint32_t, 256> table = {};
+
+        for (std::uint32_t idx = 0; idx < table.size(); idx++) {
+            std::uint32_t value = idx;
+
+            for (std::uint32_t bit = 0; bit < 8; bit++) {
+                value = (value & 1) ? 0xEDB88320 ^ (value >> 1) : value >> 1;
+            }
+
+            table[idx] = value;
+        }
+
+        return table;
+    }();
+
+    class PngStream {
+    public:
+        void write(const std::uint8_t value) {
+            this->_data.push_back(static_cast<std::byte>(value));
+        }
+
+        void writeU16LE(const std::uint16_t value) {
+            this->write(value & 0xFF);
+            this->write(value >> 8);
+        }
+
+        void writeU32BE(const std::uint32_t value) {
+            this->write(value >> 24);
+            this->write((value >> 16) & 0xFF);
+            this->write((value >> 8) & 0xFF);
+            this->write(value & 0xFF);
+        }
+
+        void writeChunk(const std::string_view type, const std::vector<std::byte> &data) {
+            this->writeU32BE(static_cast<std::uint32_t>(data.size()));
+
+            const auto crcStart = this->_data.size();
+
+            for (const auto &character: type) {
+                this->write(static_cast<std::uint8_t>(character));
+            }
+
+            this->_data.insert(this->_data.end(), data.begin(), data.end());
+
+            std::uint32_t crc = 0xFFFFFFFF;
+
+            for (auto idx = crcStart; idx < this->_data.size(); idx++) {
+                crc = CRC_TABLE[(crc ^ static_cast<std::uint8_t>(this->_data[idx])) & 0xFF] ^ (crc >> 8);
+            }
+
+            this->writeU32BE(crc ^ 0xFFFFFFFF);
+        }
+
+        [[nodiscard]] std::vector<std::byte> &data() { return this->_data; }
+
+    private:
+        std::vector<std::byte> _data;
+    };
+
+    std::vector<std::byte> encodePng(
+        const std::uint32_t width, const std::uint32_t height, const std::vector<std::byte> &rgba
+    ) {
+        const auto rowSize = static_cast<std::size_t>(width) * BYTES_PER_PIXEL;
+
+        if (rgba.size() != rowSize * height) {
+            throw EngineError(
+                "Expected {} byte(s) of {}x{} RGBA image, got {}", rowSize * height, width, height, rgba.size()
+            );
+        }
+
+        // scanlines with filter type 0 (none) in front of every row
+        std::vector<std::byte> scanlines;
+        scanlines.reserve((rowSize + 1) * height);
+
+        for (std::uint32_t row = 0; row < height; row++) {
+            const auto rowBegin = rgba.begin() + static_cast<std::ptrdiff_t>(row * rowSize);
+
+            scanlines.push_back(std::byte {0});
+            scanlines.insert(scanlines.end(), rowBegin, rowBegin + static_cast<std::ptrdiff_t>(rowSize));
+        }
+
+        // zlib stream of stored (uncompressed) deflate blocks, captures favor speed over size
+        PngStream zlib;
+        zlib.write(0x78);
+        zlib.write(0x01);
+
+        std::size_t offset = 0;
+
+        do {
+            const auto blockSize = static_cast<std::uint16_t>(
+                std::min<std::size_t>(MAX_STORED_BLOCK_SIZE, scanlines.size() - offset)
+            );
+            const auto last = offset + blockSize == scanlines.size();
+
+            zlib.write(last ? 1 : 0);
+            zlib.writeU16LE(blockSize);
+            zlib.writeU16LE(~blockSize);
+
+            zlib.data().insert(
+                zlib.data().end(), scanlines.begin() + static_cast<std::ptrdiff_t>(offset),
+                scanlines.begin() + static_cast<std::ptrdiff_t>(offset + blockSize)
+            );
+
+            offset += blockSize;
+        } while (offset < scanlines.size());
+
+        std::uint32_t adlerA = 1;
+        std::uint32_t adlerB = 0;
+
+        for (const auto &value: scanlines) {
+            adlerA = (adlerA + static_cast<std::uint8_t>(value)) % 65521;
+            adlerB = (adlerB + adlerA) % 65521;
+        }
+
+        zlib.writeU32BE((adlerB << 16) | adlerA);
+
+        PngStream header;
+        header.writeU32BE(width);
+        header.writeU32BE(height);
+        header.write(8); // bit depth
+        header.write(6); // color type: RGBA
+        header.write(0); // compression
+        header.write(0); // filter
+        header.write(0); // interlace
+
+        PngStream png;
+
+        for (const auto &value: PNG_SIGNATURE) {
+            png.write(value);
+        }
+
+        png.writeChunk("IHDR", header.data());
+        png.writeChunk("IDAT", zlib.data());
+        png.writeChunk("IEND", {});
+
+        return std::move(png.data());
+    }
+}
@@ -0,0 +1,15 @@
+#ifndef PENROSE_COMMON_PNG_ENCODER_HPP
+#define PENROSE_COMMON_PNG_ENCODER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Penrose {
+
+    [[nodiscard]] std::vector<std::byte> encodePng(
+        std::uint32_t width, std::uint32_t height, const std::vector<std::byte> &rgba
+    );
+}
+
+#endif // PENROSE_COMMON_PNG_ENCODER_HPP
@@ -0,0 +1,78 @@
+#ifndef PENROSE_COMMON_SEQ_DOUBLE_BUFFER_HPP
+#define PENROSE_COMMON_SEQ_DOUBLE_BUFFER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace Penrose {
+
+    // double buffer with single writer and lock-free readers, every buffer is guarded by sequence, which is odd while
+    // buffer is being written, so readers only copy front buffer and writer fills back buffer meanwhile
+    template <typename T>
+    class SeqDoubleBuffer {
+    public:
+        // front buffer is written only by writer, so writer reads it without sequence
+        [[nodiscard]] const T &getFront() const {
+            return this->_buffers[this->_front.load(std::memory_order_relaxed)].value;
+        }
+
+        // writes both buffers, should be called by writer before readers are started
+        template <typename Writer>
+        void writeAll(Writer &&writer) {
+            for (auto &buffer: this->_buffers) {
+                writer(buffer.value);
+            }
+        }
+
+        // back buffer is written and then published as front one
+        template <typename Writer>
+        void write(Writer &&writer) {
+            const auto back = 1 - this->_front.load(std::memory_order_relaxed);
+            auto &buffer = this->_buffers[back];
+            const auto sequence = buffer.sequence.load(std::memory_order_relaxed);
+
+            buffer.sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            writer(buffer.value);
+
+            buffer.sequence.store(sequence + 2, std::memory_order_release);
+            this->_front.store(back, std::memory_order_release);
+        }
+
+        // reader should only copy from buffer, it is retried only if it was preempted for whole frame and its buffer
+        // was reused meanwhile
+        template <typename Reader>
+        [[nodiscard]] auto read(Reader &&reader) const {
+            while (true) {
+                const auto &buffer = this->_buffers[this->_front.load(std::memory_order_acquire)];
+                const auto sequence = buffer.sequence.load(std::memory_order_acquire);
+
+                if (sequence % 2 != 0) {
+                    continue;
+                }
+
+                auto result = reader(std::as_const(buffer.value));
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if (buffer.sequence.load(std::memory_order_relaxed) == sequence) {
+                    return result;
+                }
+            }
+        }
+
+    private:
+        struct Buffer {
+            std::atomic_uint64_t sequence = 0;
+            T value;
+        };
+
+        std::array<Buffer, 2> _buffers;
+        std::atomic_uint32_t _front = 0;
+    };
+}
+
+#endif // PENROSE_COMMON_SEQ_DOUBLE_BUFFER_HPP
@@ -1,6 +1,7 @@
 #include "EntityManagerImpl.hpp"
 
 #include <Penrose/Common/EngineError.hpp>
+#include <Penrose/Performance/MemoryTracker.hpp>
 #include <Penrose/Utils/TypeUtils.hpp>
 
 #include "src/Utils/SyncUtils.hpp"
@@ -11,6 +12,9 @@ namespace Penrose {
         : _resources(resources),
           _log(resources->get<Log>()),
           _eventQueue(resources->get<ECSEventQueue>()),
+          _metrics(resources->get<MetricsRegistry>()),
+          _aliveMetric(this->_metrics->gauge("ecs.entities.alive")),
+          _lookupMetric(this->_metrics->counter("ecs.component.lookups")),
           _semaphore(1),
           _refCount(0) {
         //
@@ -22,12 +26,17 @@ namespace Penrose {
 
     void EntityManagerImpl::destroy() {
         this->_entities.reset();
+        this->_aliveMetric->set(0);
     }
 
     Entity EntityManagerImpl::createEntity() {
+        const auto memoryScope = MemoryTagScope(MemoryTag::ECS);
         const auto guard = SemaphoreGuard(this->_semaphore);
 
-        return this->_entities.acquire();
+        const auto entity = this->_entities.acquire();
+        this->_aliveMetric->add(1);
+
+        return entity;
     }
 
     Entity EntityManagerImpl::createEntity(std::string_view &&archetype, const Params &params) {
@@ -37,6 +46,7 @@ namespace Penrose {
             throw EngineError("Entity archetype {} not found", archetype);
         }
 
+        const auto memoryScope = MemoryTagScope(MemoryTag::ECS);
         const auto newComponents = it->second->construct(params);
 
         const auto guard = SemaphoreGuard(this->_semaphore);
@@ -48,6 +58,8 @@ namespace Penrose {
             components.insert_or_assign(componentPtr->getType(), componentPtr);
         }
 
+        this->_aliveMetric->add(1);
+
         return entity;
     }
 
@@ -55,9 +67,11 @@ namespace Penrose {
         const auto guard = SemaphoreGuard(this->_semaphore);
 
         this->_entities.release(entity);
+        this->_aliveMetric->add(-1);
     }
 
     void EntityManagerImpl::addComponent(const Entity entity, std::shared_ptr<ComponentPtr> &&component) {
+        const auto memoryScope = MemoryTagScope(MemoryTag::ECS);
         const auto guard = SemaphoreGuard(this->_semaphore);
 
         auto &components = this->_entities.get(entity);
@@ -86,6 +100,8 @@ namespace Penrose {
     ) {
         const auto guard = SemaphoreGuard(this->_semaphore);
 
+        this->_lookupMetric->add();
+
         const auto &components = this->_entities.get(entity);
         const auto it = components.find(componentType);
 
@@ -97,7 +113,7 @@ namespace Penrose {
     }
 
     std::shared_ptr<ComponentPtr> EntityManagerImpl::getComponent(const Entity entity, ComponentType &&componentType) {
-        const auto guard = SemaphoreGuard(this->_semaphore);
+        // entity manager semaphore is taken by EntityManagerImpl::tryGetComponent
         const auto component = this->tryGetComponent(entity, ComponentType(componentType));
 
         if (!component.has_value()) {
@@ -135,15 +151,15 @@ namespace Penrose {
     }
 
     bool EntityManagerImpl::AllIterator::move() {
-        if (!this->_currentEntity.has_value() && this->proceedEntity() && this->proceedComponent()) {
-            return true;
+        if (!this->_currentEntity.has_value()) {
+            return this->proceedEntity() && this->proceedComponent();
         }
 
-        if (!this->proceedComponent() && this->proceedEntity() && this->proceedComponent()) {
+        if (this->proceedComponent()) {
             return true;
         }
 
-        return false;
+        return this->proceedEntity() && this->proceedComponent();
     }
 
     EntityEntry EntityManagerImpl::AllIterator::fetch() {
@@ -10,6 +10,7 @@
 #include <Penrose/ECS/EntityIterator.hpp>
 #include <Penrose/ECS/EntityManager.hpp>
 #include <Penrose/Events/ECSEvents.hpp>
+#include <Penrose/Performance/MetricsRegistry.hpp>
 #include <Penrose/Resources/Initializable.hpp>
 #include <Penrose/Resources/Resource.hpp>
 #include <Penrose/Resources/ResourceSet.hpp>
@@ -71,6 +72,10 @@ namespace Penrose {
         const ResourceSet *_resources;
         ResourceProxy<Log> _log;
         ResourceProxy<ECSEventQueue> _eventQueue;
+        ResourceProxy<MetricsRegistry> _metrics;
+
+        MetricGauge *_aliveMetric;
+        MetricCounter *_lookupMetric;
 
         std::map<std::string, EntityArchetype *> _archetypes;
 
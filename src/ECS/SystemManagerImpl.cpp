@@ -1,7 +1,10 @@
 #include "SystemManagerImpl.hpp"
 
+#include <ranges>
 #include <set>
 
+#include <fmt/core.h>
+
 #include <Penrose/Common/EngineError.hpp>
 
 #include "src/Utils/SyncUtils.hpp"
@@ -13,6 +16,8 @@ namespace Penrose {
     SystemManagerImpl::SystemManagerImpl(const ResourceSet *resources)
         : _resources(resources),
           _log(resources->get<Log>()),
+          _profiler(resources->get<Profiler>()),
+          _frameStats(resources->get<FrameStats>()),
           _semaphore(1) {
         //
     }
@@ -20,6 +25,7 @@ namespace Penrose {
     void SystemManagerImpl::init() {
         this->_log->writeInfo(TAG, "Initializing system manager");
 
+        this->_jobQueue.enqueue([this] { this->_profiler->setThreadName("Systems"); }, {.order = -1, .remove = true});
         this->_jobQueue.enqueue([this] { this->update(); }, {.remove = false});
         this->_jobQueue.start();
     }
@@ -57,7 +63,8 @@ namespace Penrose {
                 .state = SystemState::Stopped,
                 .failedState = SystemState::Stopped,
                 .initialized = false,
-                .lastUpdate = std::nullopt
+                .lastUpdate = std::nullopt,
+                .profilerTag = this->_profiler->intern(fmt::format("System {}", system->getName()))
             }
         );
     }
@@ -111,7 +118,12 @@ namespace Penrose {
     }
 
     void SystemManagerImpl::update() {
+        const auto tickStart = std::chrono::high_resolution_clock::now();
+        auto ticked = false;
+
         for (auto &[name, entry]: this->_systems) {
+            ticked |= entry.state == SystemState::Running;
+
             try {
                 this->handle(entry);
             } catch (const std::exception &error) {
@@ -121,6 +133,14 @@ namespace Penrose {
                 this->_log->writeError(TAG, "System {} failure: {}", name, error.what());
             }
         }
+
+        // passes without running systems only handle state changes, so they are not ticks
+        if (ticked) {
+            this->_frameStats->record(
+                FrameSource::Systems,
+                std::chrono::duration<float>(std::chrono::high_resolution_clock::now() - tickStart).count()
+            );
+        }
     }
 
     void SystemManagerImpl::handle(Entry &entry) {
@@ -155,6 +175,8 @@ namespace Penrose {
                                                   .count()
                                             : 0;
 
+                    auto scope = this->_profiler->begin(entry.profilerTag);
+
                     entry.instance->update(delta);
                     entry.lastUpdate = std::chrono::high_resolution_clock::now();
                 }
@@ -4,10 +4,13 @@
 #include <chrono>
 #include <map>
 #include <semaphore>
+#include <set>
 #include <string>
 
 #include <Penrose/Common/Log.hpp>
 #include <Penrose/ECS/SystemManager.hpp>
+#include <Penrose/Performance/FrameStats.hpp>
+#include <Penrose/Performance/Profiler.hpp>
 #include <Penrose/Resources/Initializable.hpp>
 #include <Penrose/Resources/Resource.hpp>
 #include <Penrose/Resources/ResourceSet.hpp>
@@ -43,10 +46,13 @@ namespace Penrose {
             SystemState failedState;
             bool initialized;
             std::optional<std::chrono::high_resolution_clock::time_point> lastUpdate;
+            Profiler::TagId profilerTag;
         };
 
         const ResourceSet *_resources;
         ResourceProxy<Log> _log;
+        ResourceProxy<Profiler> _profiler;
+        ResourceProxy<FrameStats> _frameStats;
 
         JobQueue _jobQueue;
         std::binary_semaphore _semaphore;
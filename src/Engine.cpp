@@ -1,8 +1,12 @@
 #include <Penrose/Engine.hpp>
 
 #include <chrono>
-#include <ranges>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <utility>
 
+#include <Penrose/Common/BinaryLogSink.hpp>
 #include <Penrose/ECS/EntityManager.hpp>
 #include <Penrose/ECS/SystemManager.hpp>
 #include <Penrose/Events/ECSEvents.hpp>
@@ -10,6 +14,10 @@
 #include <Penrose/Events/InputEvents.hpp>
 #include <Penrose/Events/SurfaceEvents.hpp>
 #include <Penrose/Input/InputHandler.hpp>
+#include <Penrose/Input/InputMapper.hpp>
+#include <Penrose/Performance/FrameStats.hpp>
+#include <Penrose/Performance/MemoryTracker.hpp>
+#include <Penrose/Performance/MetricsRegistry.hpp>
 #include <Penrose/Performance/Profiler.hpp>
 #include <Penrose/Rendering/RenderListBuilder.hpp>
 #include <Penrose/Rendering/RenderManager.hpp>
@@ -19,6 +27,7 @@
 #include <Penrose/UI/UIManager.hpp>
 
 #include <Penrose/Builtin/Glfw.hpp>
+#include <Penrose/Builtin/Headless.hpp>
 #include <Penrose/Builtin/ImGui/ImGui.hpp>
 #include <Penrose/Builtin/Vulkan/Vulkan.hpp>
 
@@ -29,6 +38,7 @@
 #include "src/Assets/Loaders/ImageLoader.hpp"
 #include "src/Assets/Loaders/MeshLoader.hpp"
 #include "src/Assets/Loaders/ShaderLoader.hpp"
+#include "src/Assets/Loaders/UIBinaryLayoutLoader.hpp"
 #include "src/Assets/Loaders/UILayoutLoader.hpp"
 
 #include "src/Common/ConsoleLogSink.hpp"
@@ -40,27 +50,62 @@
 #include "src/Rendering/DefaultDrawableProvider.hpp"
 #include "src/Rendering/DefaultRenderer.hpp"
 #include "src/Rendering/DefaultViewProvider.hpp"
+#include "src/Rendering/FramePacer.hpp"
 #include "src/Rendering/RenderManagerImpl.hpp"
 
+#include "src/Resources/ResourceInitializer.hpp"
+
 namespace Penrose {
 
     Engine::Engine() {
+        this->addEngineResources();
 
-        this->_resources.add<InputHandler>().group(ResourceGroup::Engine).done();
+        // backends
+        addGlfw(this->_resources);
+        addVulkan(this->_resources);
+        addImGui(this->_resources);
+    }
+
+    Engine::Engine(const HeadlessInfo &headless) {
+        this->addEngineResources();
+
+        // backends
+        addHeadless(this->_resources, headless);
+        addVulkan(this->_resources);
+        addImGui(this->_resources);
+    }
+
+    void Engine::addEngineResources() {
 
         Log *log = this->_resources.add<LogImpl>().group(ResourceGroup::Engine).implements<Log>().done();
         this->_resources.add<ConsoleLogSink>().group(ResourceGroup::Engine).implements<LogSink>().done();
+        this->_resources.add<BinaryLogSink>().group(ResourceGroup::Engine).implements<LogSink>().done();
 
         log->addSink<ConsoleLogSink>();
+        log->addSink<BinaryLogSink>();
 
         this->_resources.add<Profiler>().group(ResourceGroup::Performance).done();
+        this->_resources.add<MetricsRegistry>().group(ResourceGroup::Performance).implements<Updatable>().done();
+        this->_resources.add<FrameStats>().group(ResourceGroup::Performance).implements<Updatable>().done();
+        this->_resources.add<MemoryTracker>().group(ResourceGroup::Performance).done();
 
-        this->_resources.add<SurfaceManager>().group(ResourceGroup::Windowing).implements<Initializable>().done();
+        this->_resources.add<InputHandler>().group(ResourceGroup::Engine).done();
+        this->_resources.add<InputMapper>().group(ResourceGroup::Engine).done();
+
+        // windows and swapchain are managed by windowing backend, which is usable only from main thread
+        this->_resources.add<SurfaceManager>()
+            .group(ResourceGroup::Windowing)
+            .implements<Initializable>()
+            .mainThread()
+            .done();
 
         RenderManager *renderManager = this->_resources.add<RenderManagerImpl>()
                                            .group(ResourceGroup::Rendering)
                                            .implements<Initializable>()
                                            .implements<RenderManager>()
+                                           .dependsOn<RenderSystem>()
+                                           .dependsOn<Renderer>()
+                                           .mainThread()
                                            .done();
 
         this->_resources.add<DefaultRenderer>().group(ResourceGroup::Rendering).implements<Renderer>().done();
@@ -84,9 +129,18 @@ namespace Penrose {
         this->_resources.add<ImageLoader>().group(ResourceGroup::Assets).implements<TypedAssetLoader>().done();
         this->_resources.add<ShaderLoader>().group(ResourceGroup::Assets).implements<TypedAssetLoader>().done();
         this->_resources.add<UILayoutLoader>().group(ResourceGroup::Assets).implements<TypedAssetLoader>().done();
+        this->_resources.add<UIBinaryLayoutLoader>()
+            .group(ResourceGroup::Assets)
+            .implements<TypedAssetLoader>()
+            .done();
         this->_resources.add<AssetIndex>().group(ResourceGroup::Assets).done();
         this->_resources.add<AssetLoadingProxy>().group(ResourceGroup::Assets).done();
-        this->_resources.add<AssetLoadingJobQueue>().group(ResourceGroup::Assets).implements<Initializable>().done();
+        // preloaded assets are uploaded to rendering system as soon as loading thread is started
+        this->_resources.add<AssetLoadingJobQueue>()
+            .group(ResourceGroup::Assets)
+            .implements<Initializable>()
+            .dependsOn<RenderManager>()
+            .done();
         this->_resources.add<AssetManagerImpl>()
             .group(ResourceGroup::Assets)
             .implements<Initializable>()
@@ -123,31 +177,39 @@ namespace Penrose {
             .implements<EntityManager>()
             .done();
 
+        // systems are started on initialization and may use any resource initialized before
         this->_resources.add<SystemManagerImpl>()
             .group(ResourceGroup::ECS)
             .implements<Initializable>()
             .implements<SystemManager>()
+            .dependsOn<Initializable>()
             .done();
 
         this->_resources.add<SceneManager>().group(ResourceGroup::Scene).implements<Initializable>().done();
-
-        // backends
-        addGlfw(this->_resources);
-        addVulkan(this->_resources);
-        addImGui(this->_resources);
     }
 
     void Engine::run() {
-        auto allInitializable = this->_resources.get<Initializable>();
+        auto initializer = ResourceInitializer(&this->_resources);
         auto allUpdatable = this->_resources.get<Updatable>();
         auto profiler = this->_resources.get<Profiler>();
+        auto frameStats = this->_resources.get<FrameStats>();
+        auto memoryTracker = this->_resources.get<MemoryTracker>();
+        auto inputHandler = this->_resources.get<InputHandler>();
+        auto inputMapper = this->_resources.get<InputMapper>();
+        auto renderManager = this->_resources.get<RenderManager>();
+
+        // error of initialization or frame stops engine, but resources are still destroyed and log is flushed before
+        // it is rethrown
+        auto error = std::exception_ptr();
+        auto alive = true;
 
-        for (auto &initializable: allInitializable) {
-            initializable->init();
+        try {
+            initializer.init();
+        } catch (...) {
+            error = std::current_exception();
+            alive = false;
         }
 
-        auto alive = true;
-
         auto engineEventQueue = this->_resources.get<EngineEventQueue>();
         engineEventQueue->addHandler<EngineDestroyRequestEvent>([&alive](const EngineDestroyRequestEvent *) {
             alive = false;
@@ -159,20 +221,58 @@ namespace Penrose {
 
         std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
         float delta;
+        bool firstFrame = true;
+
+        auto updatePacer = FramePacer();
+        std::optional<std::uint32_t> updateRate;
+
+        profiler->setThreadName("Main");
+        const auto frameUpdateTag = profiler->intern("Frame Update");
 
         while (alive) {
-            auto frameUpdate = profiler->begin("Frame Update");
+            try {
+                // updates have their own pacer, so slow or blocked rendering does not stall simulation and input
+                if (const auto rate = renderManager->getPacingInfo().updateRate; rate != updateRate) {
+                    updatePacer.setTargetRate(rate);
+                    updateRate = rate;
+                }
 
-            delta = std::chrono::duration<float>(std::chrono::high_resolution_clock::now() - start).count();
-            start = std::chrono::high_resolution_clock::now();
+                updatePacer.pace();
 
-            for (auto &updatable: allUpdatable) {
-                updatable->update(delta);
+                {
+                    auto frameUpdate = profiler->begin(frameUpdateTag);
+
+                    delta = std::chrono::duration<float>(std::chrono::high_resolution_clock::now() - start).count();
+                    start = std::chrono::high_resolution_clock::now();
+
+                    // first delta includes initialization and warm-up of first frame, so it is not a frame time
+                    if (!std::exchange(firstFrame, false)) {
+                        frameStats->record(FrameSource::Engine, delta);
+                    }
+
+                    for (const auto &updatable: allUpdatable) {
+                        updatable->update(delta);
+                    }
+                }
+
+                inputHandler->endFrame();
+                inputMapper->endFrame();
+                profiler->endFrame();
+                frameStats->endFrame();
+                memoryTracker->endFrame();
+            } catch (...) {
+                error = std::current_exception();
+
+                break;
             }
         }
 
-        for (auto &initializable: std::views::reverse(allInitializable)) {
-            initializable->destroy();
+        initializer.destroy();
+
+        this->_resources.get<Log>()->flush();
+
+        if (error != nullptr) {
+            std::rethrow_exception(error);
         }
     }
 }
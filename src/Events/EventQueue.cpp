@@ -0,0 +1,14 @@
+#include <Penrose/Events/EventQueue.hpp>
+
+#include <Penrose/Performance/MetricsRegistry.hpp>
+
+namespace Penrose {
+
+    MetricCounter *getDispatchedEventsCounter(const ResourceSet *resources) {
+        return resources->get<MetricsRegistry>()->counter("events.dispatched");
+    }
+
+    void addDispatchedEvents(MetricCounter *counter, const std::size_t count) {
+        counter->add(count);
+    }
+}
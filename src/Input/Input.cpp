@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 
 namespace Penrose {
 
@@ -48,11 +49,59 @@ namespace Penrose {
         // clang-format on
     };
 
+    // names are indexed by value of key, leading underscore of numbers is omitted
+    static constexpr std::array<std::string_view, INPUT_KEY_COUNT> KEY_NAMES = {
+        // clang-format off
+        "Unknown", "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", "A", "B", "C", "D", "E", "F", "G", "H", "I",
+        "J", "K", "L", "M", "N", "O", "P", "Q", "R", "S", "T", "U", "V", "W", "X", "Y", "Z", "Space", "Apostrophe",
+        "Comma", "Minus", "Period", "Slash", "Semicolon", "Equal", "LeftBracket", "RightBracket", "Backslash",
+        "GraveAccent", "Escape", "Enter", "Tab", "Backspace", "Left", "Right", "Up", "Down", "Insert", "Delete",
+        "Home", "End", "PageUp", "PageDown", "PrintScreen", "Pause", "Menu", "NumLock", "CapsLock", "ScrollLock",
+        "F1", "F2", "F3", "F4", "F5", "F6", "F7", "F8", "F9", "F10", "F11", "F12", "F13", "F14", "F15", "F16",
+        "F17", "F18", "F19", "F20", "F21", "F22", "F23", "F24", "LeftControl", "RightControl", "LeftShift",
+        "RightShift", "LeftAlt", "RightAlt", "LeftSuper", "RightSuper", "NP0", "NP1", "NP2", "NP3", "NP4", "NP5",
+        "NP6", "NP7", "NP8", "NP9", "NPDecimal", "NPEnter", "NPEqual", "NPAdd", "NPSubtract", "NPMultiply",
+        "NPDivide", "MB0", "MB1", "MB2", "MB3", "MB4", "MB5", "MB6", "MB7",
+        // clang-format on
+    };
+
+    enum class KeyClass : std::uint8_t {
+        None,
+        Keyboard,
+        Mouse
+    };
+
+    // class of every key is resolved at compile time, so classification is single lookup
+    static constexpr auto KEY_CLASSES = []() {
+        auto classes = std::array<KeyClass, INPUT_KEY_COUNT>();
+        classes.fill(KeyClass::None);
+
+        for (const auto key: KEYBOARD_KEYS) {
+            classes[static_cast<std::size_t>(key)] = KeyClass::Keyboard;
+        }
+
+        for (const auto key: MOUSE_KEYS) {
+            classes[static_cast<std::size_t>(key)] = KeyClass::Mouse;
+        }
+
+        return classes;
+    }();
+
     bool isKeyboardKey(const InputKey key) {
-        return std::ranges::find(KEYBOARD_KEYS, key) != KEYBOARD_KEYS.end();
+        return KEY_CLASSES[static_cast<std::size_t>(key)] == KeyClass::Keyboard;
     }
 
     bool isMouseKey(const InputKey key) {
-        return std::ranges::find(MOUSE_KEYS, key) != MOUSE_KEYS.end();
+        return KEY_CLASSES[static_cast<std::size_t>(key)] == KeyClass::Mouse;
+    }
+
+    std::optional<InputKey> tryParseInputKey(const std::string_view name) {
+        const auto it = std::ranges::find(KEY_NAMES, name);
+
+        if (it == KEY_NAMES.end() || it == KEY_NAMES.begin()) {
+            return std::nullopt;
+        }
+
+        return static_cast<InputKey>(it - KEY_NAMES.begin());
     }
 }
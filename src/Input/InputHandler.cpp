@@ -1,50 +1,166 @@
 #include <Penrose/Input/InputHandler.hpp>
 
 #include <algorithm>
+#include <utility>
 
-#include <Penrose/Utils/OptionalUtils.hpp>
+#include "src/Common/SeqDoubleBuffer.hpp"
 
 namespace Penrose {
 
     InputHandler::InputHandler(const ResourceSet *resources)
         : _eventQueue(resources->get<InputEventQueue>()),
-          _inputHooks(resources->get<InputHook>()) {
+          _rawEventQueue(resources->get<RawInputEventQueue>()),
+          _inputHooks(resources->get<InputHook>()),
+          _frameSamplesMetric(resources->get<MetricsRegistry>()->gauge("input.frame_samples")),
+          _frameEventsMetric(resources->get<MetricsRegistry>()->gauge("input.frame_events")),
+          _snapshots(std::make_unique<SeqDoubleBuffer<InputSnapshot>>()) {
         //
     }
 
-    void InputHandler::pushKeyStateUpdate(InputKey key, InputState state) {
+    InputHandler::~InputHandler() = default;
+
+    void InputHandler::pushKeyStateUpdate(InputKey key, InputState state, InputTimestamp timestamp) {
+        this->_frameSamples++;
+
         for (const auto &hook: this->_inputHooks) {
             if (!hook->onKeyStateUpdate(key, state)) {
                 return;
             }
         }
 
-        this->_states.insert_or_assign(key, state);
+        const auto keyIdx = static_cast<std::size_t>(key);
+
+        // repeated presses are not transitions, so they are not counted as pressed during frame
+        if (state == InputState::Pressed && !this->_pending.down.test(keyIdx)) {
+            this->_pending.pressed.set(keyIdx);
+        } else if (state == InputState::Released && this->_pending.down.test(keyIdx)) {
+            this->_pending.released.set(keyIdx);
+        }
+
+        this->_pending.down.set(keyIdx, state == InputState::Pressed);
+
+        // coalesced movement is fired first, so handlers of key see mouse position at time of key update
+        this->flushEvents();
 
         this->_eventQueue->push(KeyStateUpdatedEvent {
             .key = key,
             .state = state,
+            .timestamp = timestamp,
         });
+
+        this->_frameEvents++;
     }
 
-    void InputHandler::pushMouseMove(float x, float y) {
-        auto [xOld, yOld] = this->_mousePos;
+    void InputHandler::pushMouseMove(float x, float y, InputTimestamp timestamp) {
+        auto [xOld, yOld] = this->_pending.mousePosition;
+        auto &[dxTotal, dyTotal] = this->_pending.mouseMovement;
+
+        this->_pending.mousePosition = {std::clamp(x, -1.0f, 1.0f), std::clamp(y, -1.0f, 1.0f)};
+
+        dxTotal += x - xOld;
+        dyTotal += y - yOld;
 
-        this->_mousePos = {std::clamp(x, -1.0f, 1.0f), std::clamp(y, -1.0f, 1.0f)};
+        this->_frameSamples++;
 
-        this->_eventQueue->push(MouseMovementEvent {
-            .position = this->_mousePos,
+        auto event = MouseMovementEvent {
+            .position = this->_pending.mousePosition,
             .movement = {x - xOld, y - yOld},
-        });
+            .timestamp = timestamp,
+            .samples = 1,
+        };
+
+        if (this->_rawEventQueue.isPresent()) {
+            this->_rawEventQueue->push(MouseMovementEvent(event));
+        }
+
+        if (!this->_pendingMovement.has_value()) {
+            this->_pendingMovement = event;
+
+            return;
+        }
+
+        auto &[dxPending, dyPending] = this->_pendingMovement->movement;
+
+        dxPending += x - xOld;
+        dyPending += y - yOld;
+
+        this->_pendingMovement->position = event.position;
+        this->_pendingMovement->timestamp = timestamp;
+        this->_pendingMovement->samples++;
     }
 
-    void InputHandler::pushScroll(float dx, float dy) {
-        this->_eventQueue->push(MouseScrollEvent {
+    void InputHandler::pushScroll(float dx, float dy, InputTimestamp timestamp) {
+        auto &[dxTotal, dyTotal] = this->_pending.mouseScroll;
+
+        dxTotal += dx;
+        dyTotal += dy;
+
+        this->_frameSamples++;
+
+        auto event = MouseScrollEvent {
             .scroll = {dx, dy},
-        });
+            .timestamp = timestamp,
+            .samples = 1,
+        };
+
+        if (this->_rawEventQueue.isPresent()) {
+            this->_rawEventQueue->push(MouseScrollEvent(event));
+        }
+
+        if (!this->_pendingScroll.has_value()) {
+            this->_pendingScroll = event;
+
+            return;
+        }
+
+        auto &[dxPending, dyPending] = this->_pendingScroll->scroll;
+
+        dxPending += dx;
+        dyPending += dy;
+
+        this->_pendingScroll->timestamp = timestamp;
+        this->_pendingScroll->samples++;
+    }
+
+    void InputHandler::flushEvents() {
+        if (this->_pendingMovement.has_value()) {
+            this->_eventQueue->push(std::move(*this->_pendingMovement));
+            this->_pendingMovement.reset();
+            this->_frameEvents++;
+        }
+
+        if (this->_pendingScroll.has_value()) {
+            this->_eventQueue->push(std::move(*this->_pendingScroll));
+            this->_pendingScroll.reset();
+            this->_frameEvents++;
+        }
+    }
+
+    void InputHandler::endFrame() {
+        this->flushEvents();
+
+        this->_frameSamplesMetric->set(static_cast<double>(std::exchange(this->_frameSamples, 0)));
+        this->_frameEventsMetric->set(static_cast<double>(std::exchange(this->_frameEvents, 0)));
+
+        // readers only copy front buffer, so back buffer is written while they are still reading previous frame
+        this->_snapshots->write([this](InputSnapshot &snapshot) { snapshot = this->_pending; });
+
+        this->_pending.frame++;
+        this->_pending.pressed.reset();
+        this->_pending.released.reset();
+        this->_pending.mouseMovement = {0.0f, 0.0f};
+        this->_pending.mouseScroll = {0.0f, 0.0f};
+    }
+
+    InputSnapshot InputHandler::getSnapshot() const {
+        return this->_snapshots->read([](const InputSnapshot &snapshot) { return snapshot; });
     }
 
     InputState InputHandler::getCurrentStateOf(InputKey key) const {
-        return tryGet(this->_states, key).value_or(InputState::Released);
+        return this->getSnapshot().isDown(key) ? InputState::Pressed : InputState::Released;
+    }
+
+    InputMousePosition InputHandler::getCurrentMousePosition() const {
+        return this->getSnapshot().mousePosition;
     }
 }
@@ -0,0 +1,232 @@
+#include <Penrose/Input/InputMapper.hpp>
+
+#include <algorithm>
+#include <fstream>
+
+#include <nlohmann/json.hpp>
+
+#include <Penrose/Common/EngineError.hpp>
+
+#include "src/Common/SeqDoubleBuffer.hpp"
+
+namespace Penrose {
+
+    [[nodiscard]] static InputKey parseKey(const std::string &name) {
+        const auto key = tryParseInputKey(name);
+
+        if (!key.has_value()) {
+            throw EngineError("Unknown input key {}", name);
+        }
+
+        return *key;
+    }
+
+    InputMapper::InputMapper(const ResourceSet *resources)
+        : _inputHandler(resources->get<InputHandler>()),
+          _states(std::make_unique<SeqDoubleBuffer<ActionStates>>()) {
+        //
+    }
+
+    InputMapper::~InputMapper() = default;
+
+    void InputMapper::loadFile(const std::filesystem::path &path) {
+        auto stream = std::ifstream(path);
+
+        if (!stream.good()) {
+            throw EngineError("Failed to read input map {}", path.string());
+        }
+
+        try {
+            this->load(stream);
+        } catch (...) {
+            std::throw_with_nested(EngineError("Failed to load input map {}", path.string()));
+        }
+    }
+
+    void InputMapper::load(std::istream &stream) {
+        nlohmann::json mapJson;
+
+        try {
+            stream >> mapJson;
+        } catch (const nlohmann::json::exception &error) {
+            throw EngineError("Input map is not valid JSON: {}", error.what());
+        }
+
+        if (!mapJson.is_object()) {
+            throw EngineError("Root element is not an object");
+        }
+
+        auto actionIds = std::map<std::string, InputActionId, std::less<>>();
+        auto actionNames = std::vector<std::string>();
+        auto keyBindings = std::array<std::vector<KeyBinding>, INPUT_KEY_COUNT>();
+
+        const auto addAction = [&actionIds, &actionNames](const std::string &name) {
+            const auto action = static_cast<InputActionId>(actionNames.size());
+
+            if (action >= MAX_INPUT_ACTION_COUNT) {
+                throw EngineError("Input map defines more than {} actions", MAX_INPUT_ACTION_COUNT);
+            }
+
+            if (!actionIds.emplace(name, action).second) {
+                throw EngineError("Action {} is defined more than once", name);
+            }
+
+            actionNames.push_back(name);
+
+            return action;
+        };
+
+        if (mapJson.contains("actions")) {
+            for (const auto &[name, keysJson]: mapJson.at("actions").items()) {
+                if (!keysJson.is_array()) {
+                    throw EngineError("Keys of action {} are not an array", name);
+                }
+
+                const auto action = addAction(name);
+
+                for (const auto &keyJson: keysJson) {
+                    keyBindings.at(static_cast<std::size_t>(parseKey(keyJson.get<std::string>())))
+                        .push_back(KeyBinding {.action = action, .scale = 1.0f});
+                }
+            }
+        }
+
+        if (mapJson.contains("axes")) {
+            for (const auto &[name, keysJson]: mapJson.at("axes").items()) {
+                if (!keysJson.is_object()) {
+                    throw EngineError("Keys of axis {} are not an object", name);
+                }
+
+                const auto action = addAction(name);
+
+                for (const auto &[key, scaleJson]: keysJson.items()) {
+                    keyBindings.at(static_cast<std::size_t>(parseKey(key)))
+                        .push_back(KeyBinding {.action = action, .scale = scaleJson.get<float>()});
+                }
+            }
+        }
+
+        auto map = InputMap {.actionIds = std::move(actionIds), .actionNames = std::move(actionNames)};
+
+        for (std::size_t keyIdx = 0; keyIdx < INPUT_KEY_COUNT; keyIdx++) {
+            const auto &bindings = keyBindings.at(keyIdx);
+
+            map.keyOffsets.at(keyIdx) = static_cast<std::uint32_t>(map.bindings.size());
+            map.bindings.insert(map.bindings.end(), bindings.begin(), bindings.end());
+
+            if (!bindings.empty()) {
+                map.boundKeys.push_back(static_cast<InputKey>(keyIdx));
+            }
+        }
+
+        map.keyOffsets.at(INPUT_KEY_COUNT) = static_cast<std::uint32_t>(map.bindings.size());
+
+        auto lock = std::lock_guard(this->_mapMutex);
+
+        this->_pendingMap = std::move(map);
+    }
+
+    void InputMapper::endFrame() {
+        auto replaced = false;
+
+        {
+            auto lock = std::lock_guard(this->_mapMutex);
+
+            // identifiers, names and bindings are replaced together, so identifiers always match evaluated states
+            if (this->_pendingMap.has_value()) {
+                this->_map = std::move(*this->_pendingMap);
+                this->_pendingMap.reset();
+
+                replaced = true;
+            }
+        }
+
+        const auto actionCount = static_cast<std::uint32_t>(this->_map.actionNames.size());
+
+        const auto snapshot = this->_inputHandler->getSnapshot();
+
+        std::fill_n(this->_values.begin(), actionCount, 0.0f);
+        std::fill_n(this->_downKeys.begin(), actionCount, 0);
+        std::fill_n(this->_pressedKeys.begin(), actionCount, 0);
+
+        // only bound keys are visited, so cost of evaluation does not depend on count of systems reading actions
+        for (const auto key: this->_map.boundKeys) {
+            const auto keyIdx = static_cast<std::size_t>(key);
+            const auto down = snapshot.isDown(key);
+            const auto pressed = snapshot.wasPressed(key);
+
+            if (!down && !pressed) {
+                continue;
+            }
+
+            for (auto bindingIdx = this->_map.keyOffsets.at(keyIdx);
+                 bindingIdx < this->_map.keyOffsets.at(keyIdx + 1); bindingIdx++) {
+                const auto &binding = this->_map.bindings.at(bindingIdx);
+
+                if (down) {
+                    this->_values.at(binding.action) += binding.scale;
+                    this->_downKeys.at(binding.action) = 1;
+                }
+
+                if (pressed) {
+                    this->_pressedKeys.at(binding.action) = 1;
+                }
+            }
+        }
+
+        // states of previous frame are in front buffer, which is written only here, so it is read without sequence
+        const auto &previous = this->_states->getFront();
+
+        this->_states->write([this, &previous, actionCount, replaced](ActionStates &states) {
+            states.count = actionCount;
+
+            for (std::size_t actionIdx = 0; actionIdx < actionCount; actionIdx++) {
+                const auto value = std::clamp(this->_values.at(actionIdx), -1.0f, 1.0f);
+                const auto down = this->_downKeys.at(actionIdx) != 0 && value != 0.0f;
+
+                // actions of replaced input map start inactive, as their identifiers do not match previous ones
+                const auto wasDown = !replaced && previous.states.at(actionIdx).down;
+
+                // key pressed and released within frame is reported as both pressed and released
+                const auto tapped = this->_pressedKeys.at(actionIdx) != 0;
+
+                states.states.at(actionIdx) = InputActionState {
+                    .value = value,
+                    .down = down,
+                    .pressed = !wasDown && (down || tapped),
+                    .released = !down && (wasDown || tapped),
+                };
+            }
+        });
+    }
+
+    InputActionId InputMapper::tryGetActionId(const std::string_view name) const {
+        auto lock = std::lock_guard(this->_mapMutex);
+
+        const auto it = this->_map.actionIds.find(name);
+
+        return it != this->_map.actionIds.end() ? it->second : NO_INPUT_ACTION;
+    }
+
+    InputActionId InputMapper::getActionId(const std::string_view name) const {
+        const auto action = this->tryGetActionId(name);
+
+        if (action == NO_INPUT_ACTION) {
+            throw EngineError("Action {} not found in input map", name);
+        }
+
+        return action;
+    }
+
+    InputActionState InputMapper::getState(const InputActionId action) const {
+        return this->_states->read([action](const ActionStates &states) {
+            return action < states.count ? states.states[action] : InputActionState {};
+        });
+    }
+
+    std::uint32_t InputMapper::getActionCount() const {
+        auto lock = std::lock_guard(this->_mapMutex);
+
+        return static_cast<std::uint32_t>(this->_map.actionNames.size());
+    }
+}
@@ -0,0 +1,156 @@
+#include <Penrose/Performance/ChromeTrace.hpp>
+
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+#include <fmt/core.h>
+
+#include <Penrose/Common/EngineError.hpp>
+
+namespace Penrose {
+
+    inline constexpr std::uint32_t TRACE_PID = 1;
+
+    // frame boundaries are written on separate track, thread tracks are numbered from 1
+    inline constexpr std::uint32_t FRAMES_TID = 0;
+
+    [[nodiscard]] static std::string escape(const std::string_view value) {
+        auto result = std::string();
+        result.reserve(value.size());
+
+        for (const auto character: value) {
+            switch (character) {
+                case '"':
+                    result += "\\\"";
+                    break;
+
+                case '\\':
+                    result += "\\\\";
+                    break;
+
+                case '\n':
+                    result += "\\n";
+                    break;
+
+                case '\t':
+                    result += "\\t";
+                    break;
+
+                default:
+                    if (static_cast<unsigned char>(character) < 0x20) {
+                        result += fmt::format("\\u{:04x}", static_cast<unsigned int>(character));
+                    } else {
+                        result += character;
+                    }
+            }
+        }
+
+        return result;
+    }
+
+    class ChromeTraceStream {
+    public:
+        explicit ChromeTraceStream(std::ostream &stream)
+            : _stream(stream) {
+            this->_stream << R"({"displayTimeUnit":"ms","traceEvents":[)";
+        }
+
+        ~ChromeTraceStream() {
+            this->_stream << "]}\n";
+        }
+
+        ChromeTraceStream(const ChromeTraceStream &) = delete;
+        ChromeTraceStream &operator=(const ChromeTraceStream &) = delete;
+
+        void write(const std::string &event) {
+            if (!this->_empty) {
+                this->_stream << ",\n";
+            }
+
+            this->_stream << event;
+            this->_empty = false;
+        }
+
+    private:
+        std::ostream &_stream;
+        bool _empty = true;
+    };
+
+    void writeChromeTrace(const Profiler::Capture &capture, std::ostream &stream) {
+        const auto origin = capture.frames.empty() ? 0 : capture.frames.front();
+
+        // trace timestamps are in microseconds
+        const auto toMicroseconds = [&](const Profiler::Ticks ticks) {
+            return static_cast<double>(ticks) * 1e6 / capture.ticksPerSecond;
+        };
+
+        const auto toTimestamp = [&](const Profiler::Ticks ticks) {
+            return ticks >= origin ? toMicroseconds(ticks - origin) : -toMicroseconds(origin - ticks);
+        };
+
+        const auto tagName = [&](const Profiler::TagId tag) {
+            return tag < capture.tags.size() ? escape(capture.tags.at(tag)) : fmt::format("Tag #{}", tag);
+        };
+
+        auto trace = ChromeTraceStream(stream);
+
+        trace.write(fmt::format(
+            R"({{"name":"process_name","ph":"M","pid":{},"args":{{"name":"Penrose"}}}})", TRACE_PID
+        ));
+        trace.write(fmt::format(
+            R"({{"name":"thread_name","ph":"M","pid":{},"tid":{},"args":{{"name":"Frames"}}}})", TRACE_PID, FRAMES_TID
+        ));
+
+        for (std::uint32_t threadIdx = 0; threadIdx < capture.threads.size(); threadIdx++) {
+            const auto &thread = capture.threads.at(threadIdx);
+            const auto tid = threadIdx + 1;
+            const auto name = thread.name.empty() ? fmt::format("Thread #{}", tid) : escape(thread.name);
+
+            trace.write(fmt::format(
+                R"({{"name":"thread_name","ph":"M","pid":{},"tid":{},"args":{{"name":"{}"}}}})", TRACE_PID, tid, name
+            ));
+
+            for (const auto &record: thread.records) {
+                trace.write(fmt::format(
+                    R"({{"name":"{}","cat":"scope","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":{},"tid":{}}})",
+                    tagName(record.tag), toTimestamp(record.begin), toMicroseconds(record.end - record.begin),
+                    TRACE_PID, tid
+                ));
+            }
+        }
+
+        for (const auto &sample: capture.counters) {
+            // JSON has no representation of NaN and infinity
+            const auto value = std::isfinite(sample.value) ? fmt::format("{}", sample.value) : std::string("null");
+
+            trace.write(fmt::format(
+                R"({{"name":"{}","ph":"C","ts":{:.3f},"pid":{},"args":{{"value":{}}}}})", tagName(sample.tag),
+                toTimestamp(sample.time), TRACE_PID, value
+            ));
+        }
+
+        for (std::uint32_t frameIdx = 1; frameIdx < capture.frames.size(); frameIdx++) {
+            trace.write(fmt::format(
+                R"({{"name":"Frame #{}","cat":"frame","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":{},"tid":{}}})",
+                frameIdx, toTimestamp(capture.frames.at(frameIdx - 1)),
+                toMicroseconds(capture.frames.at(frameIdx) - capture.frames.at(frameIdx - 1)), TRACE_PID, FRAMES_TID
+            ));
+        }
+    }
+
+    void writeChromeTrace(const Profiler::Capture &capture, const std::filesystem::path &path) {
+        auto stream = std::ofstream(path, std::ios::out | std::ios::trunc);
+
+        if (!stream.is_open()) {
+            throw EngineError("Failed to open trace file {}", path.string());
+        }
+
+        writeChromeTrace(capture, stream);
+
+        if (!stream.good()) {
+            throw EngineError("Failed to write trace file {}", path.string());
+        }
+    }
+}
@@ -0,0 +1,297 @@
+#include <Penrose/Performance/FrameStats.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <utility>
+
+#include <fmt/core.h>
+
+#include <Penrose/Performance/ChromeTrace.hpp>
+
+#include "src/Utils/StringifyUtils.hpp"
+
+namespace Penrose {
+
+    inline static constexpr std::string_view TAG = "FrameStats";
+
+    // count of slowest scopes, which are listed in hitch warning
+    inline constexpr std::size_t HITCH_SCOPE_COUNT = 3;
+
+    inline static constexpr std::array<std::string_view, FRAME_SOURCE_COUNT> FRAME_METRIC_PREFIXES = {
+        "frame.engine",
+        "frame.render",
+        "frame.systems",
+    };
+
+    [[nodiscard]] static float percentile(const std::vector<float> &sorted, const float fraction) {
+        const auto idx = static_cast<std::size_t>(std::ceil(fraction * static_cast<float>(sorted.size()))) - 1;
+
+        return sorted.at(std::min(idx, sorted.size() - 1));
+    }
+
+    [[nodiscard]] static std::optional<FrameTimeStats> makeStats(
+        std::vector<float> &durations, const std::uint64_t count
+    ) {
+        if (durations.empty()) {
+            return std::nullopt;
+        }
+
+        std::ranges::sort(durations);
+
+        return FrameTimeStats {
+            .count = count,
+            .p50 = percentile(durations, 0.50f),
+            .p95 = percentile(durations, 0.95f),
+            .p99 = percentile(durations, 0.99f),
+            .max = durations.back(),
+        };
+    }
+
+    [[nodiscard]] static std::string describeSlowestScopes(const Profiler::Capture &capture) {
+        auto scopes = std::vector<std::pair<Profiler::Ticks, Profiler::TagId>>();
+
+        for (const auto &thread: capture.threads) {
+            for (const auto &record: thread.records) {
+                scopes.emplace_back(record.end - record.begin, record.tag);
+            }
+        }
+
+        const auto count = std::min(scopes.size(), HITCH_SCOPE_COUNT);
+        std::ranges::partial_sort(scopes, scopes.begin() + static_cast<std::ptrdiff_t>(count), std::greater<>());
+
+        auto description = std::string();
+
+        for (std::size_t idx = 0; idx < count; idx++) {
+            const auto &[ticks, tag] = scopes.at(idx);
+
+            description += fmt::format(
+                "{}{} {:.2f} ms", idx > 0 ? ", " : "", capture.tags.at(tag),
+                1000 * static_cast<double>(ticks) / capture.ticksPerSecond
+            );
+        }
+
+        return description;
+    }
+
+    FrameStats::FrameStats(const ResourceSet *resources)
+        : _log(resources->get<Log>()),
+          _profiler(resources->get<Profiler>()),
+          _metrics(resources->get<MetricsRegistry>()),
+          _hitchThreshold(FrameStatsInfo().hitchThreshold) {
+        for (std::size_t sourceIdx = 0; sourceIdx < FRAME_SOURCE_COUNT; sourceIdx++) {
+            const auto prefix = FRAME_METRIC_PREFIXES.at(sourceIdx);
+
+            this->_sourceMetrics.at(sourceIdx) = SourceMetrics {
+                .time = this->_metrics->histogram(fmt::format("{}.time_ms", prefix)),
+                .p99 = this->_metrics->gauge(fmt::format("{}.p99_ms", prefix)),
+                .hitches = this->_metrics->counter(fmt::format("{}.hitches", prefix)),
+            };
+        }
+    }
+
+    void FrameStats::setInfo(FrameStatsInfo &&info) {
+        std::lock_guard guard(this->_hitchesMutex);
+
+        this->_info = std::forward<decltype(info)>(info);
+        this->_hitchThreshold.store(this->_info.hitchThreshold, std::memory_order_relaxed);
+
+        while (this->_hitches.size() > this->_info.maxHitchCount) {
+            this->_hitches.pop_front();
+        }
+    }
+
+    void FrameStats::record(const FrameSource source, const float duration) {
+        const auto sourceIdx = static_cast<std::size_t>(source);
+
+        {
+            auto &window = this->_windows.at(sourceIdx);
+
+            std::lock_guard guard(window.mutex);
+
+            window.durations[window.count % WINDOW] = duration;
+            window.count++;
+
+            if (window.captured.has_value()) {
+                window.captured->push_back(duration);
+            }
+        }
+
+        this->_sourceMetrics.at(sourceIdx).time->record(1000 * duration);
+
+        if (duration <= this->_hitchThreshold.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        this->_sourceMetrics.at(sourceIdx).hitches->add();
+
+        // scopes of hitching frame are not drained yet, so snapshot is taken on next FrameStats::endFrame
+        std::lock_guard guard(this->_hitchesMutex);
+
+        this->_pendingHitches.push_back(PendingHitch {
+            .source = source,
+            .duration = duration,
+            .time = std::chrono::system_clock::now(),
+        });
+    }
+
+    void FrameStats::endFrame() {
+        std::unique_lock guard(this->_hitchesMutex);
+
+        if (this->_pendingHitches.empty()) {
+            return;
+        }
+
+        const auto pendingHitches = std::exchange(this->_pendingHitches, {});
+        const auto hitchDumpDirectory = this->_info.hitchDumpDirectory;
+
+        guard.unlock();
+
+        // hitches of different sources usually coincide, so single snapshot is shared by all of them
+        const auto capture = this->_profiler->getRecentFrames();
+        const auto slowestScopes = describeSlowestScopes(capture);
+
+        for (const auto &pendingHitch: pendingHitches) {
+            this->_log->writeWarning(
+                TAG, "{} frame took {:.2f} ms, slowest scopes: {}", toString(pendingHitch.source),
+                1000 * pendingHitch.duration, slowestScopes
+            );
+
+            auto hitch = FrameHitch {
+                .source = pendingHitch.source,
+                .duration = pendingHitch.duration,
+                .time = pendingHitch.time,
+                .capture = capture,
+            };
+
+            // hitch is dumped without lock, so FrameStats::record of render thread is not blocked by disk
+            if (hitchDumpDirectory.has_value()) {
+                this->dumpHitch(*hitchDumpDirectory, hitch);
+            }
+
+            guard.lock();
+
+            this->_hitches.push_back(std::move(hitch));
+
+            while (this->_hitches.size() > this->_info.maxHitchCount) {
+                this->_hitches.pop_front();
+            }
+
+            guard.unlock();
+        }
+    }
+
+    std::optional<FrameTimeStats> FrameStats::getStats(const FrameSource source) {
+        auto durations = std::vector<float>();
+        std::uint64_t count;
+
+        {
+            auto &window = this->_windows.at(static_cast<std::size_t>(source));
+
+            std::lock_guard guard(window.mutex);
+
+            count = window.count;
+            durations.assign(
+                window.durations.begin(), window.durations.begin() + std::min<std::uint64_t>(window.count, WINDOW)
+            );
+        }
+
+        return makeStats(durations, count);
+    }
+
+    void FrameStats::beginCapture() {
+        for (auto &window: this->_windows) {
+            auto captured = std::vector<float>();
+            captured.reserve(WINDOW);
+
+            std::lock_guard guard(window.mutex);
+
+            window.captured = std::move(captured);
+        }
+    }
+
+    std::array<std::optional<FrameTimeStats>, FRAME_SOURCE_COUNT> FrameStats::takeCapture() {
+        auto stats = std::array<std::optional<FrameTimeStats>, FRAME_SOURCE_COUNT>();
+
+        for (std::size_t sourceIdx = 0; sourceIdx < FRAME_SOURCE_COUNT; sourceIdx++) {
+            auto durations = std::vector<float>();
+
+            {
+                auto &window = this->_windows.at(sourceIdx);
+
+                std::lock_guard guard(window.mutex);
+
+                durations = std::exchange(window.captured, std::nullopt).value_or(std::vector<float>());
+            }
+
+            stats.at(sourceIdx) = makeStats(durations, durations.size());
+        }
+
+        return stats;
+    }
+
+    std::vector<FrameHitch> FrameStats::takeHitches() {
+        std::lock_guard guard(this->_hitchesMutex);
+
+        auto hitches = std::vector<FrameHitch>(
+            std::make_move_iterator(this->_hitches.begin()), std::make_move_iterator(this->_hitches.end())
+        );
+
+        this->_hitches.clear();
+
+        return hitches;
+    }
+
+    void FrameStats::update(const float delta) {
+        this->_sinceSummary += delta;
+
+        float summaryInterval;
+
+        {
+            std::lock_guard guard(this->_hitchesMutex);
+
+            summaryInterval = this->_info.summaryInterval;
+        }
+
+        if (this->_sinceSummary < summaryInterval) {
+            return;
+        }
+
+        this->_sinceSummary = 0;
+
+        this->writeSummary();
+    }
+
+    void FrameStats::writeSummary() {
+        for (std::size_t sourceIdx = 0; sourceIdx < FRAME_SOURCE_COUNT; sourceIdx++) {
+            const auto source = static_cast<FrameSource>(sourceIdx);
+            const auto stats = this->getStats(source);
+
+            if (!stats.has_value()) {
+                continue;
+            }
+
+            const auto &metrics = this->_sourceMetrics.at(sourceIdx);
+
+            metrics.p99->set(1000 * stats->p99);
+
+            this->_log->writeInfo(
+                TAG, "{} frames: p50 {:.2f} ms, p95 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms, hitches {}",
+                toString(source), 1000 * stats->p50, 1000 * stats->p95, 1000 * stats->p99, 1000 * stats->max,
+                metrics.hitches->get()
+            );
+        }
+    }
+
+    void FrameStats::dumpHitch(const std::filesystem::path &directory, const FrameHitch &hitch) {
+        const auto path = directory / fmt::format("hitch-{:04}-{}.json", this->_hitchIdx++, toString(hitch.source));
+
+        try {
+            std::filesystem::create_directories(directory);
+
+            writeChromeTrace(hitch.capture, path);
+        } catch (const std::exception &error) {
+            this->_log->writeError(TAG, "Failed to write hitch trace {}: {}", path.string(), error.what());
+        }
+    }
+}
@@ -0,0 +1,215 @@
+#include <Penrose/Performance/MemoryTracker.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include <fmt/core.h>
+
+#include <Penrose/Common/EngineError.hpp>
+
+namespace Penrose {
+
+    inline static constexpr std::array<std::string_view, MEMORY_TAG_COUNT> MEMORY_METRIC_PREFIXES = {
+        "memory.untagged", "memory.ecs", "memory.scene", "memory.rendering", "memory.assets", "memory.ui",
+    };
+
+    struct TagCounters {
+        std::atomic_uint64_t liveBytes = 0;
+        std::atomic_uint64_t peakBytes = 0;
+        std::atomic_uint64_t allocations = 0;
+    };
+
+    // counters are constant-initialized, so they are usable by allocations made before main
+    constinit static std::array<TagCounters, MEMORY_TAG_COUNT> tagCounters;
+    constinit static thread_local MemoryTag currentTag = MemoryTag::Untagged;
+
+    // allocations are also counted per thread, so steady state is checked only for thread completing frames
+    constinit static thread_local std::array<std::uint64_t, MEMORY_TAG_COUNT> threadAllocations = {};
+
+    MemoryTagScope::MemoryTagScope(const MemoryTag tag)
+        : _previousTag(currentTag) {
+        currentTag = tag;
+    }
+
+    MemoryTagScope::~MemoryTagScope() {
+        currentTag = this->_previousTag;
+    }
+
+    MemoryTracker::MemoryTracker(const ResourceSet *resources)
+        : _metrics(resources->get<MetricsRegistry>()) {
+        for (std::size_t tagIdx = 0; tagIdx < MEMORY_TAG_COUNT; tagIdx++) {
+            const auto prefix = MEMORY_METRIC_PREFIXES.at(tagIdx);
+
+            this->_tagMetrics.at(tagIdx) = TagMetrics {
+                .liveBytes = this->_metrics->gauge(fmt::format("{}.live_bytes", prefix)),
+                .peakBytes = this->_metrics->gauge(fmt::format("{}.peak_bytes", prefix)),
+                .frameAllocations = this->_metrics->gauge(fmt::format("{}.frame_allocations", prefix)),
+            };
+
+            this->_frameStartAllocations.at(tagIdx) = tagCounters.at(tagIdx).allocations.load(
+                std::memory_order_relaxed
+            );
+            this->_loopFrameStartAllocations.at(tagIdx) = threadAllocations.at(tagIdx);
+        }
+    }
+
+    bool MemoryTracker::isEnabled() {
+#ifdef PENROSE_MEMORY_TRACKING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void MemoryTracker::setInfo(MemoryTrackerInfo &&info) {
+        this->_info = std::forward<decltype(info)>(info);
+    }
+
+    void MemoryTracker::endFrame() {
+        std::uint64_t loopFrameAllocations = 0;
+
+        // nothing is allocated here unless steady state is violated, so tracker does not disturb next frame
+        for (std::size_t tagIdx = 0; tagIdx < MEMORY_TAG_COUNT; tagIdx++) {
+            const auto &counters = tagCounters.at(tagIdx);
+            const auto &metrics = this->_tagMetrics.at(tagIdx);
+            const auto allocations = counters.allocations.load(std::memory_order_relaxed);
+
+            this->_frameAllocations.at(tagIdx) = allocations - this->_frameStartAllocations.at(tagIdx);
+            this->_frameStartAllocations.at(tagIdx) = allocations;
+
+            this->_loopFrameAllocations.at(tagIdx) = threadAllocations.at(tagIdx)
+                                                     - this->_loopFrameStartAllocations.at(tagIdx);
+            this->_loopFrameStartAllocations.at(tagIdx) = threadAllocations.at(tagIdx);
+
+            loopFrameAllocations += this->_loopFrameAllocations.at(tagIdx);
+
+            metrics.liveBytes->set(static_cast<double>(counters.liveBytes.load(std::memory_order_relaxed)));
+            metrics.peakBytes->set(static_cast<double>(counters.peakBytes.load(std::memory_order_relaxed)));
+            metrics.frameAllocations->set(static_cast<double>(this->_frameAllocations.at(tagIdx)));
+        }
+
+        const auto frameIdx = this->_frameIdx++;
+
+        if (!this->_info.zeroFrameAllocations || frameIdx < this->_info.warmupFrames || loopFrameAllocations == 0) {
+            return;
+        }
+
+        auto description = std::string();
+
+        for (std::size_t tagIdx = 0; tagIdx < MEMORY_TAG_COUNT; tagIdx++) {
+            if (this->_loopFrameAllocations.at(tagIdx) == 0) {
+                continue;
+            }
+
+            description += fmt::format(
+                "{}{} {}", description.empty() ? "" : ", ", MEMORY_METRIC_PREFIXES.at(tagIdx),
+                this->_loopFrameAllocations.at(tagIdx)
+            );
+        }
+
+        throw EngineError(
+            "Frame {} performed {} allocations in steady state: {}", frameIdx, loopFrameAllocations, description
+        );
+    }
+
+    MemoryTagStats MemoryTracker::getStats(const MemoryTag tag) const {
+        const auto tagIdx = static_cast<std::size_t>(tag);
+        const auto &counters = tagCounters.at(tagIdx);
+
+        return MemoryTagStats {
+            .liveBytes = counters.liveBytes.load(std::memory_order_relaxed),
+            .peakBytes = counters.peakBytes.load(std::memory_order_relaxed),
+            .allocations = counters.allocations.load(std::memory_order_relaxed),
+            .frameAllocations = this->_frameAllocations.at(tagIdx),
+            .loopFrameAllocations = this->_loopFrameAllocations.at(tagIdx),
+        };
+    }
+}
+
+#ifdef PENROSE_MEMORY_TRACKING
+
+namespace {
+
+    // header keeps size and tag of allocation, its size preserves default new alignment of returned pointer
+    struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) AllocationHeader {
+        std::size_t size;
+        Penrose::MemoryTag tag;
+    };
+
+    void *trackedAllocate(const std::size_t size) noexcept {
+        auto *header = static_cast<AllocationHeader *>(std::malloc(sizeof(AllocationHeader) + (size > 0 ? size : 1)));
+
+        if (header == nullptr) {
+            return nullptr;
+        }
+
+        const auto tag = Penrose::currentTag;
+        auto &counters = Penrose::tagCounters.at(static_cast<std::size_t>(tag));
+
+        header->size = size;
+        header->tag = tag;
+
+        counters.allocations.fetch_add(1, std::memory_order_relaxed);
+        Penrose::threadAllocations[static_cast<std::size_t>(tag)]++;
+
+        const auto liveBytes = counters.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        auto peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+
+        while (peakBytes < liveBytes
+               && !counters.peakBytes.compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed)) {
+            //
+        }
+
+        return header + 1;
+    }
+
+    void trackedFree(void *ptr) noexcept {
+        if (ptr == nullptr) {
+            return;
+        }
+
+        auto *header = static_cast<AllocationHeader *>(ptr) - 1;
+
+        Penrose::tagCounters.at(static_cast<std::size_t>(header->tag))
+            .liveBytes.fetch_sub(header->size, std::memory_order_relaxed);
+
+        std::free(header);
+    }
+}
+
+// aligned and nothrow forms are not replaced: default aligned forms do not go through these functions and default
+// nothrow forms forward into them
+
+void *operator new(const std::size_t size) {
+    void *ptr = trackedAllocate(size);
+
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+void *operator new[](const std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept {
+    trackedFree(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+    trackedFree(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+    trackedFree(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept {
+    trackedFree(ptr);
+}
+
+#endif
@@ -0,0 +1,211 @@
+#include <Penrose/Performance/MetricsRegistry.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+
+#include <fmt/core.h>
+
+#include <Penrose/Common/EngineError.hpp>
+
+namespace Penrose {
+
+    inline static constexpr std::string_view TAG = "MetricsRegistry";
+
+    // atomic floating point fetch_add is not available everywhere, so values are updated through CAS
+    template <typename Func>
+    static void updateAtomic(std::atomic<double> &target, Func &&func) {
+        auto current = target.load(std::memory_order_relaxed);
+
+        while (!target.compare_exchange_weak(current, func(current), std::memory_order_relaxed)) {
+            //
+        }
+    }
+
+    void MetricGauge::add(const double value) {
+        updateAtomic(this->_value, [value](const double current) { return current + value; });
+    }
+
+    MetricHistogram::MetricHistogram(std::vector<double> &&bounds)
+        : _bounds(std::forward<decltype(bounds)>(bounds)),
+          _buckets(std::make_unique<std::atomic_uint64_t[]>(this->_bounds.size() + 1)),
+          _min(std::numeric_limits<double>::infinity()),
+          _max(-std::numeric_limits<double>::infinity()) {
+        if (!std::ranges::is_sorted(this->_bounds)) {
+            throw EngineError("Histogram bounds are not sorted");
+        }
+    }
+
+    void MetricHistogram::record(const double value) {
+        const auto bucketIdx = std::ranges::lower_bound(this->_bounds, value) - this->_bounds.begin();
+
+        this->_buckets[bucketIdx].fetch_add(1, std::memory_order_relaxed);
+        this->_count.fetch_add(1, std::memory_order_relaxed);
+
+        updateAtomic(this->_sum, [value](const double current) { return current + value; });
+        updateAtomic(this->_min, [value](const double current) { return std::min(current, value); });
+        updateAtomic(this->_max, [value](const double current) { return std::max(current, value); });
+    }
+
+    MetricCounter *MetricsRegistry::counter(const std::string_view name) {
+        std::lock_guard guard(this->_mutex);
+
+        auto it = this->_counters.find(name);
+
+        if (it == this->_counters.end()) {
+            std::tie(it, std::ignore) = this->_counters.emplace(name, std::make_unique<MetricCounter>());
+        }
+
+        return it->second.get();
+    }
+
+    MetricGauge *MetricsRegistry::gauge(const std::string_view name) {
+        std::lock_guard guard(this->_mutex);
+
+        auto it = this->_gauges.find(name);
+
+        if (it == this->_gauges.end()) {
+            std::tie(it, std::ignore) = this->_gauges.emplace(name, std::make_unique<MetricGauge>());
+        }
+
+        return it->second.get();
+    }
+
+    MetricHistogram *MetricsRegistry::histogram(const std::string_view name) {
+        return this->histogram(name, std::vector<double>(DEFAULT_BOUNDS.begin(), DEFAULT_BOUNDS.end()));
+    }
+
+    MetricHistogram *MetricsRegistry::histogram(const std::string_view name, std::vector<double> &&bounds) {
+        std::lock_guard guard(this->_mutex);
+
+        auto it = this->_histograms.find(name);
+
+        if (it == this->_histograms.end()) {
+            std::tie(it, std::ignore) = this->_histograms.emplace(
+                name, std::make_unique<MetricHistogram>(std::forward<decltype(bounds)>(bounds))
+            );
+        }
+
+        return it->second.get();
+    }
+
+    MetricsSnapshot MetricsRegistry::snapshot() {
+        std::lock_guard guard(this->_mutex);
+
+        auto snapshot = MetricsSnapshot();
+
+        for (const auto &[name, counter]: this->_counters) {
+            snapshot.counters.push_back(MetricsSnapshot::Counter {.name = name, .value = counter->get()});
+        }
+
+        for (const auto &[name, gauge]: this->_gauges) {
+            snapshot.gauges.push_back(MetricsSnapshot::Gauge {.name = name, .value = gauge->get()});
+        }
+
+        for (const auto &[name, histogram]: this->_histograms) {
+            auto buckets = std::vector<std::uint64_t>(histogram->_bounds.size() + 1);
+
+            for (std::size_t idx = 0; idx < buckets.size(); idx++) {
+                buckets[idx] = histogram->_buckets[idx].load(std::memory_order_relaxed);
+            }
+
+            const auto count = histogram->_count.load(std::memory_order_relaxed);
+
+            snapshot.histograms.push_back(MetricsSnapshot::Histogram {
+                .name = name,
+                .count = count,
+                .sum = histogram->_sum.load(std::memory_order_relaxed),
+                .min = count > 0 ? histogram->_min.load(std::memory_order_relaxed) : 0,
+                .max = count > 0 ? histogram->_max.load(std::memory_order_relaxed) : 0,
+                .bounds = histogram->_bounds,
+                .buckets = std::move(buckets),
+            });
+        }
+
+        return snapshot;
+    }
+
+    MetricsRegistry::MetricsRegistry(const ResourceSet *resources)
+        : _log(resources->get<Log>()) {
+        //
+    }
+
+    void MetricsRegistry::setDumpInfo(std::optional<MetricsDumpInfo> &&dumpInfo) {
+        std::lock_guard guard(this->_mutex);
+
+        this->_dumpInfo = dumpInfo;
+        this->_sinceDump = 0;
+    }
+
+    void MetricsRegistry::update(const float delta) {
+        std::optional<std::filesystem::path> path;
+
+        {
+            std::lock_guard guard(this->_mutex);
+
+            if (!this->_dumpInfo.has_value()) {
+                return;
+            }
+
+            this->_sinceDump += delta;
+
+            if (this->_sinceDump < this->_dumpInfo->interval) {
+                return;
+            }
+
+            this->_sinceDump = 0;
+            path = this->_dumpInfo->path;
+        }
+
+        auto stream = std::ofstream(*path, std::ios::out | std::ios::app);
+
+        if (!stream.is_open()) {
+            if (this->_log.has_value() && this->_log->isPresent()) {
+                this->_log.value()->writeWarning(TAG, "Failed to open metrics dump file {}", path->string());
+            }
+
+            return;
+        }
+
+        writeMetrics(this->snapshot(), stream);
+    }
+
+    void writeMetrics(const MetricsSnapshot &snapshot, std::ostream &stream) {
+        const auto join = [](const auto &values, auto &&format) {
+            auto result = std::string();
+
+            for (const auto &value: values) {
+                if (!result.empty()) {
+                    result += ',';
+                }
+
+                result += format(value);
+            }
+
+            return result;
+        };
+
+        // metric names are engine-defined identifiers, so they are not escaped
+        const auto counters = join(snapshot.counters, [](const MetricsSnapshot::Counter &counter) {
+            return fmt::format(R"("{}":{})", counter.name, counter.value);
+        });
+
+        const auto gauges = join(snapshot.gauges, [](const MetricsSnapshot::Gauge &gauge) {
+            return fmt::format(R"("{}":{})", gauge.name, gauge.value);
+        });
+
+        const auto histograms = join(snapshot.histograms, [&join](const MetricsSnapshot::Histogram &histogram) {
+            const auto format = [](const auto value) { return fmt::format("{}", value); };
+
+            return fmt::format(
+                R"("{}":{{"count":{},"sum":{},"min":{},"max":{},"bounds":[{}],"buckets":[{}]}})", histogram.name,
+                histogram.count, histogram.sum, histogram.min, histogram.max, join(histogram.bounds, format),
+                join(histogram.buckets, format)
+            );
+        });
+
+        stream << fmt::format(
+            R"({{"counters":{{{}}},"gauges":{{{}}},"histograms":{{{}}}}})", counters, gauges, histograms
+        ) << '\n';
+    }
+}
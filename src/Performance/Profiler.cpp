@@ -1,50 +1,406 @@
 #include <Penrose/Performance/Profiler.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define PENROSE_PROFILER_TSC
+#endif
+
 namespace Penrose {
 
-    Profiler::FunctionCall::FunctionCall(Profiler *profiler, std::string_view &&tag)
-            : _profiler(profiler),
-              _tag(tag) {
-        this->_profiler->pushFunctionCall(this->_threadId, this->_tag);
+    // profiler instances are distinguished by id, because new profiler could be allocated at address of destroyed one
+    static std::atomic_uint64_t nextInstanceId = 1;
+
+    struct CurrentThreadBuffer {
+        std::uint64_t instanceId = 0;
+        Profiler::ThreadBuffer *buffer = nullptr;
+    };
+
+    static thread_local CurrentThreadBuffer currentThreadBuffer;
+
+    // calibration is coarse until enough time passes, so it is refined on every frame
+    inline constexpr auto MIN_CALIBRATION_INTERVAL = std::chrono::milliseconds(1);
+
+    [[nodiscard]] static float percentile(std::vector<float> &sorted, const float fraction) {
+        const auto idx = static_cast<std::size_t>(std::ceil(fraction * static_cast<float>(sorted.size()))) - 1;
+
+        return sorted.at(std::min(idx, sorted.size() - 1));
+    }
+
+    Profiler::Scope::Scope(ThreadBuffer *buffer, const TagId tag)
+        : _buffer(buffer),
+          _tag(tag),
+          _begin(Profiler::now()) {
+        this->_buffer->_depth++;
+    }
+
+    Profiler::Scope::~Scope() {
+        const auto end = Profiler::now();
+
+        this->_buffer->_depth--;
+        this->_buffer->push(ScopeRecord {
+            .tag = this->_tag,
+            .depth = this->_buffer->_depth,
+            .begin = this->_begin,
+            .end = end,
+        });
+    }
+
+    Profiler::Profiler()
+        : _instanceId(nextInstanceId++),
+          _calibrationTicks(Profiler::now()),
+          _calibrationTime(Clock::now()),
+          _ticksPerSecond(std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(1)).count()) {
+#ifdef PENROSE_PROFILER_TSC
+        // TSC frequency is unknown until calibrated, so initial ratio is measured by short spin against steady clock
+        while (Clock::now() - this->_calibrationTime < MIN_CALIBRATION_INTERVAL) {
+            //
+        }
+
+        this->calibrate();
+#endif
+    }
+
+    Profiler::Ticks Profiler::now() {
+#ifdef PENROSE_PROFILER_TSC
+        return __rdtsc();
+#else
+        return static_cast<Ticks>(Clock::now().time_since_epoch().count());
+#endif
+    }
+
+    double Profiler::getTicksPerSecond() {
+        std::lock_guard guard(this->_statsMutex);
+
+        return this->_ticksPerSecond;
+    }
+
+    Profiler::TagId Profiler::intern(const std::string_view tag) {
+        std::lock_guard guard(this->_tagsMutex);
+
+        const auto key = std::string(tag);
+        const auto it = this->_tagIds.find(key);
+
+        if (it != this->_tagIds.end()) {
+            return it->second;
+        }
+
+        const auto id = static_cast<TagId>(this->_tagNames.size());
+
+        this->_tagNames.push_back(key);
+        this->_tagIds.emplace(key, id);
+
+        return id;
+    }
+
+    std::string Profiler::getTagName(const TagId tag) {
+        std::lock_guard guard(this->_tagsMutex);
+
+        return this->_tagNames.at(tag);
+    }
+
+    void Profiler::setThreadName(const std::string_view name) {
+        const auto buffer = this->getThreadBuffer();
+
+        std::lock_guard guard(this->_threadsMutex);
+
+        buffer->_name = name;
+    }
+
+    Profiler::Scope Profiler::begin(const TagId tag) {
+        return {this->getThreadBuffer(), tag};
+    }
+
+    Profiler::Scope Profiler::begin(const std::string_view tag) {
+        return {this->getThreadBuffer(), this->intern(tag)};
+    }
+
+    Profiler::ThreadBuffer *Profiler::addTrack(const std::string_view name) {
+        std::lock_guard guard(this->_threadsMutex);
+
+        // default identifier does not represent any thread, so track is never picked up as thread buffer
+        auto &track = this->_threads.emplace_back(std::make_unique<ThreadBuffer>(std::thread::id()));
+        track->_name = name;
+
+        return track.get();
+    }
+
+    void Profiler::endFrame() {
+        std::lock_guard guard(this->_statsMutex);
+
+        this->calibrate();
+
+        auto threads = std::vector<ThreadBuffer *>();
+
+        {
+            std::lock_guard threadsGuard(this->_threadsMutex);
+
+            for (const auto &thread: this->_threads) {
+                threads.push_back(thread.get());
+            }
+        }
+
+        auto updatedTags = std::vector<TagId>();
+        const auto capturing = this->_capturing.load(std::memory_order_relaxed);
+
+        if (capturing) {
+            this->_capture->threads.resize(threads.size());
+            this->_capture->frames.push_back(Profiler::now());
+        }
+
+        // history slots are reused, so record vectors keep their capacity
+        auto &historyFrame = this->_history.at(this->_historyCount++ % HISTORY_FRAMES);
+        historyFrame.end = Profiler::now();
+        historyFrame.threads.resize(threads.size());
+
+        for (auto &records: historyFrame.threads) {
+            records.clear();
+        }
+
+        for (std::size_t threadIdx = 0; threadIdx < threads.size(); threadIdx++) {
+            const auto buffer = threads.at(threadIdx);
+            const auto head = buffer->_head.load(std::memory_order_acquire);
+            auto tail = buffer->_tail;
+
+            // slot next to head could be under write, so at most capacity - 1 records are available
+            if (head - tail >= THREAD_BUFFER_CAPACITY) {
+                this->_droppedCount += head - tail - (THREAD_BUFFER_CAPACITY - 1);
+                tail = head - (THREAD_BUFFER_CAPACITY - 1);
+            }
+
+            for (; tail < head; tail++) {
+                const auto record = buffer->_records[tail & ThreadBuffer::MASK];
+
+                // owning thread does not wait for drain, so record could be overwritten while it was copied
+                if (buffer->_head.load(std::memory_order_acquire) - tail >= THREAD_BUFFER_CAPACITY) {
+                    this->_droppedCount++;
+
+                    continue;
+                }
+
+                auto &stats = this->_tagStats[record.tag];
+                stats.durations[stats.count % STATS_WINDOW] = static_cast<float>(
+                    static_cast<double>(record.end - record.begin) / this->_ticksPerSecond
+                );
+                stats.count++;
+
+                updatedTags.push_back(record.tag);
+                historyFrame.threads.at(threadIdx).push_back(record);
+
+                if (capturing) {
+                    this->_capture->threads.at(threadIdx).records.push_back(record);
+                }
+            }
+
+            buffer->_tail = head;
+        }
+
+        if (capturing && --this->_captureFramesLeft == 0) {
+            this->_capturing = false;
+
+            this->_capture->ticksPerSecond = this->_ticksPerSecond;
+
+            {
+                std::lock_guard tagsGuard(this->_tagsMutex);
+
+                this->_capture->tags.assign(this->_tagNames.begin(), this->_tagNames.end());
+            }
+
+            std::lock_guard threadsGuard(this->_threadsMutex);
+
+            for (std::size_t threadIdx = 0; threadIdx < threads.size(); threadIdx++) {
+                this->_capture->threads.at(threadIdx).name = threads.at(threadIdx)->_name;
+            }
+        }
+
+        if (updatedTags.empty()) {
+            return;
+        }
+
+        std::ranges::sort(updatedTags);
+        const auto [last, end] = std::ranges::unique(updatedTags);
+        updatedTags.erase(last, end);
+
+        auto durations = std::vector<float>();
+
+        for (const auto tag: updatedTags) {
+            const auto &tagStats = this->_tagStats.at(tag);
+            const auto windowSize = static_cast<std::size_t>(std::min<std::uint64_t>(tagStats.count, STATS_WINDOW));
+
+            durations.assign(tagStats.durations.begin(), tagStats.durations.begin() + windowSize);
+            std::ranges::sort(durations);
+
+            auto sum = 0.0f;
+            for (const auto duration: durations) {
+                sum += duration;
+            }
+
+            auto stats = ScopeStats {
+                .tag = this->getTagName(tag),
+                .count = tagStats.count,
+                .min = durations.front(),
+                .avg = sum / static_cast<float>(durations.size()),
+                .max = durations.back(),
+                .p50 = percentile(durations, 0.50f),
+                .p95 = percentile(durations, 0.95f),
+                .p99 = percentile(durations, 0.99f),
+            };
+
+            const auto it = std::ranges::find(this->_stats, stats.tag, &ScopeStats::tag);
+
+            if (it != this->_stats.end()) {
+                *it = std::move(stats);
+            } else {
+                this->_stats.push_back(std::move(stats));
+            }
+        }
     }
 
-    Profiler::FunctionCall::~FunctionCall() {
-        this->_profiler->popFunctionCall(this->_threadId);
+    std::vector<Profiler::ScopeStats> Profiler::getStats() {
+        std::lock_guard guard(this->_statsMutex);
+
+        return this->_stats;
     }
 
-    Profiler::FunctionCall Profiler::begin(std::string_view &&tag) {
-        return {
-                this,
-                std::forward<decltype(tag)>(tag)
+    Profiler::Capture Profiler::getRecentFrames() {
+        std::lock_guard guard(this->_statsMutex);
+
+        auto capture = Capture {
+            .ticksPerSecond = this->_ticksPerSecond,
+            .tags = {},
+            .threads = {},
+            .counters = {},
+            .frames = {},
         };
+
+        const auto frameCount = std::min<std::uint64_t>(this->_historyCount, HISTORY_FRAMES);
+
+        for (auto frameIdx = this->_historyCount - frameCount; frameIdx < this->_historyCount; frameIdx++) {
+            const auto &historyFrame = this->_history.at(frameIdx % HISTORY_FRAMES);
+
+            capture.frames.push_back(historyFrame.end);
+            capture.threads.resize(std::max(capture.threads.size(), historyFrame.threads.size()));
+
+            for (std::size_t threadIdx = 0; threadIdx < historyFrame.threads.size(); threadIdx++) {
+                auto &records = capture.threads.at(threadIdx).records;
+                const auto &historyRecords = historyFrame.threads.at(threadIdx);
+
+                records.insert(records.end(), historyRecords.begin(), historyRecords.end());
+            }
+        }
+
+        {
+            std::lock_guard tagsGuard(this->_tagsMutex);
+
+            capture.tags.assign(this->_tagNames.begin(), this->_tagNames.end());
+        }
+
+        std::lock_guard threadsGuard(this->_threadsMutex);
+
+        for (std::size_t threadIdx = 0; threadIdx < capture.threads.size(); threadIdx++) {
+            capture.threads.at(threadIdx).name = this->_threads.at(threadIdx)->_name;
+        }
+
+        return capture;
+    }
+
+    std::uint64_t Profiler::getDroppedCount() {
+        std::lock_guard guard(this->_statsMutex);
+
+        return this->_droppedCount;
     }
 
-    void Profiler::pushFunctionCall(const std::thread::id &threadId, const std::string_view &tag) {
-        auto now = std::chrono::high_resolution_clock::now();
+    void Profiler::recordCounter(const TagId tag, const double value) {
+        if (!this->_capturing.load(std::memory_order_relaxed)) {
+            return;
+        }
 
-        auto &callstack = this->_currentCallstacks[threadId];
-        auto recording = callstack.empty()
-                         ? &this->_recordedCallstacks[threadId]
-                         : &callstack.top().recording->nestedCalls.emplace_back();
+        std::lock_guard guard(this->_statsMutex);
+
+        if (this->_capture.has_value()) {
+            this->_capture->counters.push_back(CounterSample {
+                .tag = tag,
+                .time = Profiler::now(),
+                .value = value,
+            });
+        }
+    }
 
-        recording->tag = tag;
-        recording->nestedCalls.clear();
+    void Profiler::beginCapture(const std::uint32_t frameCount) {
+        std::lock_guard guard(this->_statsMutex);
 
-        callstack.push(CurrentCall{
-                .tag = std::string(tag),
-                .begin = now,
-                .recording = recording
+        if (frameCount == 0) {
+            this->_capture = std::nullopt;
+            this->_capturing = false;
+
+            return;
+        }
+
+        this->_capture = Capture {
+            .ticksPerSecond = this->_ticksPerSecond,
+            .tags = {},
+            .threads = {},
+            .counters = {},
+            .frames = {Profiler::now()},
+        };
+        this->_captureFramesLeft = frameCount;
+        this->_capturing = true;
+    }
+
+    std::optional<Profiler::Capture> Profiler::takeCapture() {
+        std::lock_guard guard(this->_statsMutex);
+
+        if (this->_capturing.load() || !this->_capture.has_value()) {
+            return std::nullopt;
+        }
+
+        return std::exchange(this->_capture, std::nullopt);
+    }
+
+    Profiler::ThreadBuffer *Profiler::getThreadBuffer() {
+        if (currentThreadBuffer.instanceId == this->_instanceId) {
+            return currentThreadBuffer.buffer;
+        }
+
+        const auto threadId = std::this_thread::get_id();
+
+        std::lock_guard guard(this->_threadsMutex);
+
+        auto it = std::ranges::find_if(this->_threads, [&threadId](const auto &buffer) {
+            return buffer->_threadId == threadId;
         });
+
+        if (it == this->_threads.end()) {
+            this->_threads.push_back(std::make_unique<ThreadBuffer>(threadId));
+            it = std::prev(this->_threads.end());
+        }
+
+        currentThreadBuffer = CurrentThreadBuffer {
+            .instanceId = this->_instanceId,
+            .buffer = it->get(),
+        };
+
+        return it->get();
     }
 
-    void Profiler::popFunctionCall(const std::thread::id &threadId) {
-        auto now = std::chrono::high_resolution_clock::now();
+    void Profiler::calibrate() {
+#ifdef PENROSE_PROFILER_TSC
+        const auto elapsed = Clock::now() - this->_calibrationTime;
 
-        auto &callstack = this->_currentCallstacks[threadId];
+        if (elapsed < MIN_CALIBRATION_INTERVAL) {
+            return;
+        }
 
-        auto call = callstack.top();
-        callstack.pop();
+        const auto ticks = static_cast<double>(Profiler::now() - this->_calibrationTicks);
 
-        call.recording->duration = now - call.begin;
+        this->_ticksPerSecond = ticks / std::chrono::duration<double>(elapsed).count();
+#endif
     }
 }
@@ -29,7 +29,7 @@ namespace Penrose {
                        .format = RenderFormat::D32Float,
                        .clearValue = {.depth = 1},
                        .loadOp = AttachmentLoadOp::Clear,
-                       .storeOp = AttachmentStoreOp::Store,
+                       .storeOp = AttachmentStoreOp::DontCare,
                        .initialLayout = AttachmentLayout::Undefined,
                        .finalLayout = AttachmentLayout::DepthStencilAttachment,
                    }},
@@ -77,14 +77,13 @@ namespace Penrose {
                         .stage = PipelineShaderStage::Vertex,
                         .offset = 0,
                         .size = sizeof(ProjectionConstant),
-                    }, },
-            .objects =
-                {
-                          PipelineObject {
+                    }, PipelineConstant {
                         .stage = PipelineShaderStage::Fragment,
-                        .type = PipelineObjectType::Sampler,
-                        .count = TEXTURE_COUNT,
+                        .offset = SAMPLER_CONSTANT_OFFSET,
+                        .size = sizeof(SamplerConstant),
                     }, },
+            .objects = {},
+            .bindless = true,
         });
 
         const auto sampler = this->_samplerFactory->makeSampler(
@@ -95,6 +94,9 @@ namespace Penrose {
         this->_placeholder = std::unique_ptr<Image>(placeholder);
         this->_pipeline = std::unique_ptr<Pipeline>(pipeline);
         this->_sampler = std::unique_ptr<Sampler>(sampler);
+
+        this->_samplerConstant.samplerIdx = this->_sampler->getBindlessIndex();
+        this->_samplerConstant.placeholderIdx = this->_placeholder->getBindlessIndex();
     }
 
     void DefaultRenderer::destroy() {
@@ -121,6 +123,16 @@ namespace Penrose {
         context->executeGraph(targets, this->_graph, functions);
     }
 
+    std::vector<PipelineWarmUpInfo> DefaultRenderer::getPipelineWarmUp() const {
+        return {
+            PipelineWarmUpInfo {
+                .pipeline = this->_pipeline.get(),
+                .graph = this->_graph,
+                .function = "Draw",
+            },
+        };
+    }
+
     void DefaultRenderer::draw(CommandRecorder *commandRecorder) {
         // TODO
 
@@ -130,12 +142,13 @@ namespace Penrose {
         commandRecorder->bindPipeline(
             this->_pipeline.get(),
             PipelineBindingInfo {
-                .tag = "DefaultRendererImageBinding",
-                .constants = {PipelineConstantBinding {.data = &this->_projection}},
-                .objects = {PipelineObjectBinding {
-                    .images = std::vector(TEXTURE_COUNT, this->_placeholder.get()), // TODO
-                    .samplers = std::vector(TEXTURE_COUNT, this->_sampler.get()),
-                }},
+                .tag = std::nullopt,
+                .constants =
+                    {
+                        PipelineConstantBinding {.data = &this->_projection},
+                        PipelineConstantBinding {.data = &this->_samplerConstant},
+                    },
+                .objects = {},
             }
         );
 
@@ -19,12 +19,19 @@ namespace Penrose {
     class DefaultRenderer final: public Resource<DefaultRenderer>,
                                  public Renderer {
     public:
-        static constexpr std::uint32_t TEXTURE_COUNT = 64;
-
         struct ProjectionConstant {
             // TODO
         };
 
+        struct SamplerConstant {
+            std::uint32_t samplerIdx;
+
+            // image sampled by instances with NO_TEXTURE_ID
+            std::uint32_t placeholderIdx;
+        };
+
+        static constexpr std::uint32_t SAMPLER_CONSTANT_OFFSET = 64;
+
         struct InstanceInput {
             // TODO
         };
@@ -47,6 +54,8 @@ namespace Penrose {
 
         void execute(RendererContext *context, const Params &params) override;
 
+        [[nodiscard]] std::vector<PipelineWarmUpInfo> getPipelineWarmUp() const override;
+
     private:
         ResourceProxy<ImageFactory> _imageFactory;
         ResourceProxy<PipelineFactory> _pipelineFactory;
@@ -59,6 +68,7 @@ namespace Penrose {
         std::unique_ptr<Sampler> _sampler;
 
         ProjectionConstant _projection;
+        SamplerConstant _samplerConstant;
 
         void draw(CommandRecorder *commandRecorder);
     };
@@ -0,0 +1,75 @@
+#include "FramePacer.hpp"
+
+#include <thread>
+#include <utility>
+
+namespace Penrose {
+
+    // sleep is not precise enough, so last part of interval is spent on yielding
+    inline constexpr auto SPIN_THRESHOLD = std::chrono::microseconds(1500);
+
+    FramePacer::FramePacer()
+        : FramePacer(Timer {
+              .now = [] { return Clock::now(); },
+              .waitUntil =
+                  [](const Clock::time_point deadline) {
+                      if (deadline - Clock::now() > SPIN_THRESHOLD) {
+                          std::this_thread::sleep_until(deadline - SPIN_THRESHOLD);
+                      }
+
+                      while (Clock::now() < deadline) {
+                          std::this_thread::yield();
+                      }
+                  },
+          }) {
+        //
+    }
+
+    FramePacer::FramePacer(Timer &&timer)
+        : _timer(std::forward<decltype(timer)>(timer)) {
+        //
+    }
+
+    void FramePacer::setTargetRate(const std::optional<std::uint32_t> targetRate) {
+        if (targetRate.has_value() && *targetRate > 0) {
+            const auto interval = std::chrono::duration<double>(1.0 / *targetRate);
+
+            this->_interval = std::chrono::duration_cast<Clock::duration>(interval);
+        } else {
+            this->_interval = std::nullopt;
+        }
+
+        this->_deadline = std::nullopt;
+    }
+
+    FramePacer::Clock::duration FramePacer::pace() {
+        if (!this->_interval.has_value()) {
+            return Clock::duration::zero();
+        }
+
+        const auto start = this->_timer.now();
+
+        if (!this->_deadline.has_value()) {
+            this->_deadline = start + *this->_interval;
+
+            return Clock::duration::zero();
+        }
+
+        const auto deadline = *this->_deadline;
+
+        if (deadline > start) {
+            this->_timer.waitUntil(deadline);
+        }
+
+        const auto end = this->_timer.now();
+
+        // frame, which is late for whole interval, restarts schedule instead of rushing to catch up
+        if (end - deadline > *this->_interval) {
+            this->_deadline = end + *this->_interval;
+        } else {
+            this->_deadline = deadline + *this->_interval;
+        }
+
+        return end - start;
+    }
+}
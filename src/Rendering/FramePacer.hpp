@@ -0,0 +1,37 @@
+#ifndef PENROSE_RENDERING_FRAME_PACER_HPP
+#define PENROSE_RENDERING_FRAME_PACER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+
+namespace Penrose {
+
+    class FramePacer {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        // source of time and of waiting, could be replaced to pace frames against another clock
+        struct Timer {
+            std::function<Clock::time_point()> now;
+            std::function<void(Clock::time_point)> waitUntil;
+        };
+
+        FramePacer();
+        explicit FramePacer(Timer &&timer);
+
+        void setTargetRate(std::optional<std::uint32_t> targetRate);
+
+        [[nodiscard]] std::optional<Clock::duration> getInterval() const { return this->_interval; }
+
+        Clock::duration pace();
+
+    private:
+        Timer _timer;
+        std::optional<Clock::duration> _interval;
+        std::optional<Clock::time_point> _deadline;
+    };
+}
+
+#endif // PENROSE_RENDERING_FRAME_PACER_HPP
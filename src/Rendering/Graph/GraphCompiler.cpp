@@ -0,0 +1,285 @@
+#include "GraphCompiler.hpp"
+
+#include <algorithm>
+#include <set>
+
+#include <Penrose/Common/EngineError.hpp>
+
+namespace Penrose {
+
+    struct PassEdge {
+        std::uint32_t from;
+        bool contributes;
+    };
+
+    [[nodiscard]] constexpr bool isWrite(const TargetUsageFlags usage) {
+        return (usage & TargetUsage::Color) || (usage & TargetUsage::DepthStencil);
+    }
+
+    // stable topological sort of included passes, ties are resolved by declaration order
+    [[nodiscard]] std::vector<std::uint32_t> sortPasses(
+        const GraphInfo &graph, const std::vector<std::vector<PassEdge>> &edges, const std::vector<bool> &included
+    ) {
+        const auto passCount = static_cast<std::uint32_t>(edges.size());
+
+        auto successors = std::vector<std::vector<std::uint32_t>>(passCount);
+        auto inDegree = std::vector<std::uint32_t>(passCount, 0);
+        std::uint32_t includedCount = 0;
+
+        for (std::uint32_t passIdx = 0; passIdx < passCount; passIdx++) {
+            if (!included[passIdx]) {
+                continue;
+            }
+
+            includedCount++;
+
+            for (const auto &edge: edges[passIdx]) {
+                if (!included[edge.from]) {
+                    continue;
+                }
+
+                successors[edge.from].push_back(passIdx);
+                inDegree[passIdx]++;
+            }
+        }
+
+        std::set<std::uint32_t> ready;
+
+        for (std::uint32_t passIdx = 0; passIdx < passCount; passIdx++) {
+            if (included[passIdx] && inDegree[passIdx] == 0) {
+                ready.insert(passIdx);
+            }
+        }
+
+        std::vector<std::uint32_t> order;
+        order.reserve(includedCount);
+
+        while (!ready.empty()) {
+            const auto passIdx = *ready.begin();
+            ready.erase(ready.begin());
+
+            order.push_back(passIdx);
+
+            for (const auto &successorIdx: successors[passIdx]) {
+                if (--inDegree[successorIdx] == 0) {
+                    ready.insert(successorIdx);
+                }
+            }
+        }
+
+        if (order.size() != includedCount) {
+            throw EngineError("Render graph {} has cyclic pass dependencies", graph.name);
+        }
+
+        return order;
+    }
+
+    CompiledGraph compileGraph(const GraphInfo &graph) {
+        const auto passCount = static_cast<std::uint32_t>(graph.passes.size());
+        const auto attachmentCount = static_cast<std::uint32_t>(graph.attachments.size());
+
+        auto usages = std::vector<std::vector<TargetUsageFlags>>(
+            passCount, std::vector<TargetUsageFlags>(attachmentCount, 0)
+        );
+
+        const auto useAttachment = [&](const std::uint32_t passIdx, const std::uint32_t attachmentIdx,
+                                       const TargetUsage usage) {
+            if (attachmentIdx >= attachmentCount) {
+                throw EngineError(
+                    "Render graph {} pass #{} references unknown attachment #{}", graph.name, passIdx, attachmentIdx
+                );
+            }
+
+            usages[passIdx][attachmentIdx] = usages[passIdx][attachmentIdx] | usage;
+        };
+
+        // incoming edges of each pass: explicit dependencies and implicit hazards on shared attachments
+        auto edges = std::vector<std::vector<PassEdge>>(passCount);
+
+        for (std::uint32_t passIdx = 0; passIdx < passCount; passIdx++) {
+            const auto &pass = graph.passes.at(passIdx);
+
+            for (const auto &attachmentIdx: pass.inputTargets) {
+                useAttachment(passIdx, attachmentIdx, TargetUsage::Input);
+            }
+
+            for (const auto &attachmentIdx: pass.colorTargets) {
+                useAttachment(passIdx, attachmentIdx, TargetUsage::Color);
+            }
+
+            if (pass.depthStencilTarget.has_value()) {
+                useAttachment(passIdx, *pass.depthStencilTarget, TargetUsage::DepthStencil);
+            }
+
+            for (const auto &dependencyIdx: pass.dependsOn) {
+                if (dependencyIdx >= passCount || dependencyIdx == passIdx) {
+                    throw EngineError(
+                        "Render graph {} pass #{} has invalid dependency #{}", graph.name, passIdx, dependencyIdx
+                    );
+                }
+
+                edges[passIdx].push_back({.from = dependencyIdx, .contributes = true});
+            }
+        }
+
+        // explicit dependencies define order of passes, ties are resolved by declaration order
+        const auto explicitOrder = sortPasses(graph, edges, std::vector<bool>(passCount, true));
+
+        // passes touching same attachment keep that order whenever one of them writes
+        for (std::uint32_t attachmentIdx = 0; attachmentIdx < attachmentCount; attachmentIdx++) {
+            std::optional<std::uint32_t> lastWriter;
+            std::vector<std::uint32_t> readers;
+
+            for (const auto &passIdx: explicitOrder) {
+                const auto usage = usages[passIdx][attachmentIdx];
+
+                if (usage == 0) {
+                    continue;
+                }
+
+                if (lastWriter.has_value()) {
+                    edges[passIdx].push_back({.from = *lastWriter, .contributes = true});
+                }
+
+                if (!isWrite(usage)) {
+                    readers.push_back(passIdx);
+                    continue;
+                }
+
+                for (const auto &readerIdx: readers) {
+                    edges[passIdx].push_back({.from = readerIdx, .contributes = false});
+                }
+
+                readers.clear();
+                lastWriter = passIdx;
+            }
+        }
+
+        // pass is alive when it writes stored attachment or contributes to alive pass
+        auto alive = std::vector<bool>(passCount, false);
+        std::vector<std::uint32_t> pending;
+
+        for (std::uint32_t passIdx = 0; passIdx < passCount; passIdx++) {
+            for (std::uint32_t attachmentIdx = 0; attachmentIdx < attachmentCount; attachmentIdx++) {
+                if (alive[passIdx] || !isWrite(usages[passIdx][attachmentIdx])
+                    || graph.attachments.at(attachmentIdx).storeOp != AttachmentStoreOp::Store) {
+                    continue;
+                }
+
+                alive[passIdx] = true;
+                pending.push_back(passIdx);
+            }
+        }
+
+        while (!pending.empty()) {
+            const auto passIdx = pending.back();
+            pending.pop_back();
+
+            for (const auto &edge: edges[passIdx]) {
+                if (!edge.contributes || alive[edge.from]) {
+                    continue;
+                }
+
+                alive[edge.from] = true;
+                pending.push_back(edge.from);
+            }
+        }
+
+        std::uint32_t aliveCount = 0;
+
+        for (std::uint32_t passIdx = 0; passIdx < passCount; passIdx++) {
+            if (alive[passIdx]) {
+                aliveCount++;
+            }
+        }
+
+        if (aliveCount == 0) {
+            throw EngineError("Render graph {} has no passes contributing to stored attachments", graph.name);
+        }
+
+        CompiledGraph compiled = {
+            .passes = {},
+            .attachments = std::vector<CompiledAttachment>(attachmentCount),
+            .aliasSlotCount = 0,
+        };
+
+        for (const auto &passIdx: sortPasses(graph, edges, alive)) {
+            compiled.passes.push_back(CompiledPass {
+                .passIdx = passIdx,
+                .usages = usages[passIdx],
+                .preserveAttachments = {},
+            });
+        }
+
+        // attachment lifetimes in execution order
+        for (std::uint32_t subpassIdx = 0; subpassIdx < compiled.passes.size(); subpassIdx++) {
+            for (std::uint32_t attachmentIdx = 0; attachmentIdx < attachmentCount; attachmentIdx++) {
+                if (compiled.passes[subpassIdx].usages[attachmentIdx] == 0) {
+                    continue;
+                }
+
+                auto &attachment = compiled.attachments[attachmentIdx];
+
+                if (!attachment.firstSubpass.has_value()) {
+                    attachment.firstSubpass = subpassIdx;
+                }
+
+                attachment.lastSubpass = subpassIdx;
+            }
+        }
+
+        std::vector<std::uint32_t> transientAttachments;
+
+        for (std::uint32_t attachmentIdx = 0; attachmentIdx < attachmentCount; attachmentIdx++) {
+            const auto &info = graph.attachments.at(attachmentIdx);
+            auto &attachment = compiled.attachments[attachmentIdx];
+
+            if (!attachment.firstSubpass.has_value()) {
+                continue;
+            }
+
+            for (auto subpassIdx = *attachment.firstSubpass + 1; subpassIdx < *attachment.lastSubpass; subpassIdx++) {
+                auto &pass = compiled.passes[subpassIdx];
+
+                if (pass.usages[attachmentIdx] == 0) {
+                    pass.preserveAttachments.push_back(attachmentIdx);
+                }
+            }
+
+            attachment.transient = info.loadOp != AttachmentLoadOp::Load
+                                   && info.storeOp == AttachmentStoreOp::DontCare
+                                   && info.initialLayout == AttachmentLayout::Undefined;
+
+            if (attachment.transient) {
+                transientAttachments.push_back(attachmentIdx);
+            }
+        }
+
+        // transient attachments with disjoint lifetimes share alias slot
+        std::ranges::stable_sort(transientAttachments, [&](const std::uint32_t &lhs, const std::uint32_t &rhs) {
+            return *compiled.attachments[lhs].firstSubpass < *compiled.attachments[rhs].firstSubpass;
+        });
+
+        std::vector<std::uint32_t> slotEnds;
+
+        for (const auto &attachmentIdx: transientAttachments) {
+            auto &attachment = compiled.attachments[attachmentIdx];
+
+            const auto it = std::ranges::find_if(slotEnds, [&](const std::uint32_t &end) {
+                return end < *attachment.firstSubpass;
+            });
+
+            if (it != slotEnds.end()) {
+                attachment.aliasSlot = static_cast<std::uint32_t>(std::distance(slotEnds.begin(), it));
+                *it = *attachment.lastSubpass;
+            } else {
+                attachment.aliasSlot = static_cast<std::uint32_t>(slotEnds.size());
+                slotEnds.push_back(*attachment.lastSubpass);
+            }
+        }
+
+        compiled.aliasSlotCount = static_cast<std::uint32_t>(slotEnds.size());
+
+        return compiled;
+    }
+}
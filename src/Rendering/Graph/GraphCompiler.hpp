@@ -0,0 +1,35 @@
+#ifndef PENROSE_RENDERING_GRAPH_GRAPH_COMPILER_HPP
+#define PENROSE_RENDERING_GRAPH_GRAPH_COMPILER_HPP
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <Penrose/Rendering/Graph/GraphInfo.hpp>
+#include <Penrose/Rendering/Graph/TargetInfo.hpp>
+
+namespace Penrose {
+
+    struct CompiledPass {
+        std::uint32_t passIdx;
+        std::vector<TargetUsageFlags> usages;
+        std::vector<std::uint32_t> preserveAttachments;
+    };
+
+    struct CompiledAttachment {
+        std::optional<std::uint32_t> firstSubpass;
+        std::optional<std::uint32_t> lastSubpass;
+        bool transient = false;
+        std::optional<std::uint32_t> aliasSlot;
+    };
+
+    struct CompiledGraph {
+        std::vector<CompiledPass> passes;
+        std::vector<CompiledAttachment> attachments;
+        std::uint32_t aliasSlotCount;
+    };
+
+    [[nodiscard]] CompiledGraph compileGraph(const GraphInfo &graph);
+}
+
+#endif // PENROSE_RENDERING_GRAPH_GRAPH_COMPILER_HPP
@@ -0,0 +1,90 @@
+#include "PipelineCacheFile.hpp"
+
+#include <utility>
+
+namespace Penrose {
+
+    inline static constexpr std::array<char, 8> PIPELINE_CACHE_MAGIC = {'P', 'N', 'R', 'S', 'V', 'K', 'P', 'C'};
+    inline static constexpr std::uint32_t PIPELINE_CACHE_VERSION = 1;
+
+    struct PipelineCacheHeader {
+        std::array<char, 8> magic;
+        std::uint32_t version;
+        std::uint32_t vendorId;
+        std::uint32_t deviceId;
+        std::uint32_t driverVersion;
+        std::array<std::uint8_t, 16> cacheUuid;
+        std::uint64_t dataSize;
+        std::uint64_t checksum;
+    };
+
+    [[nodiscard]] constexpr std::uint64_t fnv1a(const std::byte *data, const std::size_t size) {
+        std::uint64_t hash = 0xCBF29CE484222325;
+
+        for (std::size_t idx = 0; idx < size; idx++) {
+            hash = (hash ^ static_cast<std::uint64_t>(data[idx])) * 0x100000001B3;
+        }
+
+        return hash;
+    }
+
+    void PipelineCacheFile::write(
+        std::ostream &stream, const PipelineCacheDevice &device, const std::byte *data, const std::size_t size
+    ) {
+        const auto header = PipelineCacheHeader {
+            .magic = PIPELINE_CACHE_MAGIC,
+            .version = PIPELINE_CACHE_VERSION,
+            .vendorId = device.vendorId,
+            .deviceId = device.deviceId,
+            .driverVersion = device.driverVersion,
+            .cacheUuid = device.cacheUuid,
+            .dataSize = size,
+            .checksum = fnv1a(data, size),
+        };
+
+        stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        stream.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(size));
+    }
+
+    PipelineCacheStatus PipelineCacheFile::read(
+        std::istream &stream, const PipelineCacheDevice &device, std::vector<std::byte> &data
+    ) {
+        PipelineCacheHeader header;
+        stream.read(reinterpret_cast<char *>(&header), sizeof(header));
+
+        if (!stream.good()) {
+            return PipelineCacheStatus::Truncated;
+        }
+
+        if (header.magic != PIPELINE_CACHE_MAGIC || header.version != PIPELINE_CACHE_VERSION) {
+            return PipelineCacheStatus::UnknownFormat;
+        }
+
+        if (header.vendorId != device.vendorId || header.deviceId != device.deviceId
+            || header.driverVersion != device.driverVersion || header.cacheUuid != device.cacheUuid) {
+            return PipelineCacheStatus::OtherDevice;
+        }
+
+        // size in header is not trusted until it matches rest of stream, so corrupted size is never allocated
+        const auto dataStart = stream.tellg();
+        stream.seekg(0, std::ios::end);
+        const auto dataEnd = stream.tellg();
+        stream.seekg(dataStart);
+
+        if (dataStart < 0 || dataEnd < dataStart || header.dataSize != static_cast<std::uint64_t>(dataEnd - dataStart)) {
+            return PipelineCacheStatus::Corrupted;
+        }
+
+        auto buffer = std::vector<std::byte>(header.dataSize);
+        stream.read(reinterpret_cast<char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+
+        if (stream.gcount() != static_cast<std::streamsize>(buffer.size())
+            || fnv1a(buffer.data(), buffer.size()) != header.checksum) {
+            return PipelineCacheStatus::Corrupted;
+        }
+
+        data = std::move(buffer);
+
+        return PipelineCacheStatus::Loaded;
+    }
+}
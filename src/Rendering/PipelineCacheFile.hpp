@@ -0,0 +1,43 @@
+#ifndef PENROSE_RENDERING_PIPELINE_CACHE_FILE_HPP
+#define PENROSE_RENDERING_PIPELINE_CACHE_FILE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace Penrose {
+
+    // identity of device and driver, which produced pipeline cache data
+    struct PipelineCacheDevice {
+        std::uint32_t vendorId;
+        std::uint32_t deviceId;
+        std::uint32_t driverVersion;
+        std::array<std::uint8_t, 16> cacheUuid;
+    };
+
+    enum class PipelineCacheStatus {
+        Loaded,
+        Truncated,
+        UnknownFormat,
+        OtherDevice,
+        Corrupted
+    };
+
+    // cache produced by another device or driver is rejected by driver at best, so it is validated before use
+    class PipelineCacheFile {
+    public:
+        static void write(
+            std::ostream &stream, const PipelineCacheDevice &device, const std::byte *data, std::size_t size
+        );
+
+        // data is filled only when cache is loaded, size of data is checked against stream before allocation
+        [[nodiscard]] static PipelineCacheStatus read(
+            std::istream &stream, const PipelineCacheDevice &device, std::vector<std::byte> &data
+        );
+    };
+}
+
+#endif // PENROSE_RENDERING_PIPELINE_CACHE_FILE_HPP
@@ -1,8 +1,13 @@
 #include <Penrose/Rendering/RenderListBuilder.hpp>
 
+#include <chrono>
+#include <list>
+#include <map>
 #include <queue>
+#include <set>
 
-#include <Penrose/Common/EngineError.hpp>
+#include <Penrose/Assets/ImageAsset.hpp>
+#include <Penrose/Performance/MemoryTracker.hpp>
 #include <Penrose/Utils/OptionalUtils.hpp>
 
 #include <Penrose/Builtin/Penrose/ECS/ViewComponent.hpp>
@@ -10,10 +15,17 @@
 namespace Penrose {
 
     RenderListBuilder::RenderListBuilder(const ResourceSet *resources)
-        : _eventQueue(resources->get<ECSEventQueue>()),
+        : _assetManager(resources->get<AssetManager>()),
+          _eventQueue(resources->get<ECSEventQueue>()),
           _sceneManager(resources->get<SceneManager>()),
           _drawableProviders(resources->get<DrawableProvider>()),
-          _viewProviders(resources->get<ViewProvider>()) {
+          _viewProviders(resources->get<ViewProvider>()),
+          _metrics(resources->get<MetricsRegistry>()),
+          _profiler(resources->get<Profiler>()),
+          _drawablesMetric(this->_metrics->gauge("render.list.drawables")),
+          _bucketsMetric(this->_metrics->gauge("render.list.buckets")),
+          _buildTimeMetric(this->_metrics->histogram("render.list.build_ms")),
+          _buildTag(this->_profiler->intern("Render List Build")) {
         //
     }
 
@@ -32,6 +44,10 @@ namespace Penrose {
     }
 
     std::optional<RenderList> RenderListBuilder::tryBuildRenderList(const std::string &name) {
+        const auto start = std::chrono::steady_clock::now();
+        const auto memoryScope = MemoryTagScope(MemoryTag::Rendering);
+        auto scope = this->_profiler->begin(this->_buildTag);
+
         auto lock = std::lock_guard<std::mutex>(this->_mutex);
 
         auto viewEntity = tryGet(this->_renderListViewMap, name);
@@ -61,22 +77,28 @@ namespace Penrose {
             return std::nullopt;
         }
 
-        auto renderList = RenderList {.view = *view, .textureCount = 0, .textures = {}, .meshes = {}};
+        auto renderList = RenderList {.view = *view, .textures = {}, .meshes = {}};
+        auto textureIds = std::map<std::string, std::uint32_t>();
 
-        auto getTextureIdOf = [](RenderList &list, const std::string &asset) -> std::uint32_t {
-            for (std::uint32_t id = 0; id < list.textureCount; ++id) {
-                if (list.textures.at(id).asset == asset) {
-                    return id;
-                }
+        // instances reference images by their index in bindless table, so shaders index it directly
+        auto getTextureIdOf = [this, &textureIds](RenderList &list, const std::string &asset) -> std::uint32_t {
+            if (const auto it = textureIds.find(asset); it != textureIds.end()) {
+                return it->second;
             }
 
-            if (list.textureCount == TEXTURE_COUNT) {
-                throw EngineError("Texture count overrun");
+            auto textureId = NO_TEXTURE_ID;
+
+            if (const auto imageAsset = this->_assetManager->tryGetAsset<ImageAsset>(std::string_view(asset));
+                imageAsset.has_value() && *imageAsset != nullptr) {
+                if (const auto image = (*imageAsset)->getImage().lock(); image != nullptr) {
+                    textureId = image->getBindlessIndex();
+                }
             }
 
-            list.textures.at(list.textureCount).asset = asset;
+            textureIds.emplace(asset, textureId);
+            list.textures.push_back(Texture {.asset = asset, .bindlessIndex = textureId});
 
-            return list.textureCount++;
+            return textureId;
         };
 
         auto getMeshOf = [](RenderList &list, const std::string &asset) -> Mesh * {
@@ -92,9 +114,13 @@ namespace Penrose {
             return &mesh;
         };
 
+        std::uint32_t drawableCount = 0;
+
         for (const auto &entity: (*maybeDrawableEntities)) {
             for (const auto &drawableProvider: this->_drawableProviders) {
                 for (const auto &drawable: drawableProvider->getDrawablesFor(entity)) {
+                    drawableCount++;
+
                     auto mesh = getMeshOf(renderList, drawable.meshAsset);
 
                     mesh->instances.emplace_back(MeshInstance {
@@ -107,6 +133,12 @@ namespace Penrose {
             }
         }
 
+        this->_drawablesMetric->set(drawableCount);
+        this->_bucketsMetric->set(static_cast<double>(renderList.meshes.size()));
+        this->_buildTimeMetric->record(
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count()
+        );
+
         return renderList;
     }
 
@@ -1,18 +1,37 @@
 #include "RenderManagerImpl.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <ranges>
+#include <vector>
+
+#include <fmt/core.h>
+
 #include <Penrose/Common/EngineError.hpp>
+#include <Penrose/Performance/MemoryTracker.hpp>
 
 namespace Penrose {
 
     inline static constexpr std::string_view TAG = "RenderManagerImpl";
 
+    inline constexpr int PACING_JOB_ORDER = -2;
     inline constexpr int INVALIDATE_JOB_ORDER = -1;
     inline constexpr int RENDER_JOB_ORDER = 0;
 
+    // waiting for frame is limited, so main loop keeps running while rendering is stopped or stalled
+    inline constexpr auto FRAME_WAIT_TIMEOUT = std::chrono::milliseconds(100);
+
+    [[nodiscard]] inline float toSeconds(const FramePacer::Clock::duration duration) {
+        return std::chrono::duration<float>(duration).count();
+    }
+
     RenderManagerImpl::RenderManagerImpl(const ResourceSet *resources)
         : _resources(resources),
           _log(resources->get<Log>()),
-          _surfaceEventQueue(resources->get<SurfaceEventQueue>()) {
+          _surfaceEventQueue(resources->get<SurfaceEventQueue>()),
+          _profiler(resources->get<Profiler>()),
+          _frameStats(resources->get<FrameStats>()) {
         //
     }
 
@@ -43,12 +62,42 @@ namespace Penrose {
             }
         }
 
+        this->_profilerTags = ProfilerTags {
+            .frame = this->_profiler->intern("Render Frame"),
+            .pacing = this->_profiler->intern("Frame Pacing"),
+            .wait = this->_profiler->intern("Frame Wait"),
+            .submit = this->_profiler->intern("Frame Submit"),
+            .cpuTime = this->_profiler->intern("Render CPU Time (ms)"),
+            .gpuTime = this->_profiler->intern("Render GPU Time (ms)"),
+            .renderers = {},
+        };
+
+        if (this->_gpuTrack == nullptr) {
+            this->_gpuTrack = this->_profiler->addTrack("GPU");
+        }
+
+        for (const auto &name: this->_renderers | std::views::keys) {
+            this->_profilerTags.renderers.emplace(
+                name,
+                RendererTags {
+                    .cpu = this->_profiler->intern(fmt::format("Renderer {}", name)),
+                    .gpu = this->_profiler->intern(fmt::format("GPU Renderer {}", name)),
+                }
+            );
+        }
+
         this->_renderContext = std::unique_ptr<RenderContext>((*this->_renderSystem)->makeRenderContext());
 
+        this->applyPacingInfo(this->getPacingInfo());
+        this->warmUpPipelines();
         this->invalidate();
 
+        this->_jobQueue.enqueue([this] { this->_profiler->setThreadName("Render"); }, {.order = PACING_JOB_ORDER - 1});
+
         this->_jobQueue.enqueue(
             [this] {
+                const auto memoryScope = MemoryTagScope(MemoryTag::Rendering);
+
                 try {
                     this->render();
                 } catch (const std::exception &error) {
@@ -81,6 +130,15 @@ namespace Penrose {
 
         this->_renderContext = std::nullopt;
 
+        {
+            std::lock_guard guard(this->_frameMutex);
+
+            this->_lastFrameStart = std::nullopt;
+        }
+
+        // wake up threads awaiting frames which would never be submitted
+        this->_frameSubmitted.notify_all();
+
         for (const auto &renderer: this->_renderers | std::views::values) {
             try {
                 renderer->destroy();
@@ -122,13 +180,96 @@ namespace Penrose {
         this->_renderers.emplace(renderer->getName(), renderer);
     }
 
+    void RenderManagerImpl::setPacingInfo(FramePacingInfo &&pacingInfo) {
+        {
+            std::lock_guard guard(this->_frameMutex);
+
+            this->_pacingInfo = pacingInfo;
+        }
+
+        if (!this->_jobQueue.running()) {
+            return;
+        }
+
+        this->_jobQueue.enqueue(
+            [this, pacingInfo] {
+                try {
+                    this->applyPacingInfo(pacingInfo);
+                    this->_renderContext->get()->invalidate();
+                } catch (const std::exception &error) {
+                    this->_log->writeError(TAG, "Failed to apply frame pacing: {}", error.what());
+                }
+            },
+            JobQueue::Params {
+                .order = PACING_JOB_ORDER,
+                .remove = true,
+                .override = true,
+            }
+        );
+    }
+
+    FramePacingInfo RenderManagerImpl::getPacingInfo() {
+        std::lock_guard guard(this->_frameMutex);
+
+        return this->_pacingInfo;
+    }
+
+    FrameTiming RenderManagerImpl::getFrameTiming() {
+        std::lock_guard guard(this->_frameMutex);
+
+        return this->_frameTiming;
+    }
+
+    std::uint64_t RenderManagerImpl::waitForFrame(const std::uint64_t frameIdx) {
+        std::unique_lock lock(this->_frameMutex);
+
+        if (!this->_jobQueue.running()) {
+            return this->_frameIdx;
+        }
+
+        this->_frameSubmitted.wait_for(lock, FRAME_WAIT_TIMEOUT, [this, frameIdx] {
+            return this->_frameIdx >= frameIdx;
+        });
+
+        return this->_frameIdx;
+    }
+
+    std::uint32_t RenderManagerImpl::getMidFramePipelineCount() {
+        std::lock_guard guard(this->_frameMutex);
+
+        return this->_midFramePipelineCount;
+    }
+
     void RenderManagerImpl::render() {
         const auto renderContext = this->_renderContext->get();
 
-        if (!renderContext->beginRender()) {
-            return;
+        FramePacer::Clock::duration pacingTime;
+
+        {
+            auto scope = this->_profiler->begin(this->_profilerTags.pacing);
+
+            pacingTime = this->_pacer.pace();
         }
 
+        auto frameScope = this->_profiler->begin(this->_profilerTags.frame);
+
+        const auto frameStart = FramePacer::Clock::now();
+
+        {
+            auto scope = this->_profiler->begin(this->_profilerTags.wait);
+
+            if (!renderContext->beginRender()) {
+                return;
+            }
+        }
+
+        // timings of previous frames are resolved by beginning of new one
+        if (auto gpuTimings = renderContext->takeGpuTimings(); gpuTimings.has_value()) {
+            this->recordGpuTimings(*gpuTimings);
+        }
+
+        const auto recordStart = FramePacer::Clock::now();
+
         for (const auto &[name, params]: this->_executionInfo.renderers) {
             const auto it = this->_renderers.find(name);
 
@@ -139,13 +280,53 @@ namespace Penrose {
             }
 
             {
+                const auto &tags = this->_profilerTags.renderers.at(name);
+                auto scope = this->_profiler->begin(tags.cpu);
+
                 const auto rendererContext = std::unique_ptr<RendererContext>(renderContext->makeRendererContext());
 
+                renderContext->beginGpuScope(tags.gpu);
                 it->second->execute(rendererContext.get(), params);
+                renderContext->endGpuScope();
             }
         }
 
-        renderContext->submitRender();
+        {
+            auto scope = this->_profiler->begin(this->_profilerTags.submit);
+
+            renderContext->submitRender();
+        }
+
+        const auto frameEnd = FramePacer::Clock::now();
+
+        {
+            std::lock_guard guard(this->_frameMutex);
+
+            this->_frameIdx++;
+            this->_frameTiming = FrameTiming {
+                .frameIdx = this->_frameIdx,
+                .frameTime = this->_lastFrameStart.has_value() ? toSeconds(frameStart - *this->_lastFrameStart) : 0,
+                .pacingTime = toSeconds(pacingTime),
+                .waitTime = toSeconds(recordStart - frameStart),
+                .cpuTime = toSeconds(frameEnd - recordStart),
+                .gpuTime = renderContext->getGpuTime(),
+            };
+            this->_lastFrameStart = frameStart;
+            this->_midFramePipelineCount = renderContext->getMidFramePipelineCount();
+        }
+
+        this->_frameSubmitted.notify_all();
+
+        // frame timing is written only by render thread, so it is read here without lock
+        if (this->_frameTiming.frameTime > 0) {
+            this->_frameStats->record(FrameSource::Render, this->_frameTiming.frameTime);
+        }
+
+        this->_profiler->recordCounter(this->_profilerTags.cpuTime, 1000 * toSeconds(frameEnd - recordStart));
+
+        if (const auto gpuTime = renderContext->getGpuTime(); gpuTime.has_value()) {
+            this->_profiler->recordCounter(this->_profilerTags.gpuTime, 1000 * *gpuTime);
+        }
     }
 
     void RenderManagerImpl::invalidate() {
@@ -164,4 +345,45 @@ namespace Penrose {
             }
         );
     }
+
+    void RenderManagerImpl::applyPacingInfo(const FramePacingInfo &pacingInfo) {
+        this->_renderContext->get()->setPacingInfo(pacingInfo);
+
+        this->_pacer.setTargetRate(
+            pacingInfo.mode == FramePacingMode::TargetRate ? std::optional(pacingInfo.targetRate) : std::nullopt
+        );
+    }
+
+    void RenderManagerImpl::warmUpPipelines() {
+        auto warmUp = std::vector<PipelineWarmUpInfo>();
+
+        for (const auto &renderer: this->_renderers | std::views::values) {
+            std::ranges::move(renderer->getPipelineWarmUp(), std::back_inserter(warmUp));
+        }
+
+        // failed warm-up is not fatal, pipelines are still compiled on first use
+        try {
+            this->_renderContext->get()->warmUpPipelines(warmUp);
+        } catch (const std::exception &error) {
+            this->_log->writeError(TAG, "Failed to warm up pipelines: {}", error.what());
+        }
+    }
+
+    void RenderManagerImpl::recordGpuTimings(const GpuFrameTimings &timings) {
+        const auto ticksPerSecond = this->_profiler->getTicksPerSecond();
+        const auto toTicks = [&](const float time) {
+            return timings.submitTime + static_cast<Profiler::Ticks>(static_cast<double>(time) * ticksPerSecond);
+        };
+
+        for (const auto &scope: timings.scopes) {
+            const auto record = Profiler::ScopeRecord {
+                .tag = scope.tag,
+                .depth = scope.depth,
+                .begin = toTicks(scope.begin),
+                .end = toTicks(scope.end),
+            };
+
+            this->_profiler->record(this->_gpuTrack, record);
+        }
+    }
 }
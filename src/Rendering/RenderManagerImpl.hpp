@@ -1,18 +1,25 @@
 #ifndef PENROSE_RENDERING_RENDER_MANAGER_IMPL_HPP
 #define PENROSE_RENDERING_RENDER_MANAGER_IMPL_HPP
 
+#include <condition_variable>
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 
 #include <Penrose/Common/Log.hpp>
 #include <Penrose/Events/SurfaceEvents.hpp>
+#include <Penrose/Performance/FrameStats.hpp>
+#include <Penrose/Performance/Profiler.hpp>
+#include <Penrose/Rendering/GpuTimings.hpp>
 #include <Penrose/Rendering/RenderManager.hpp>
 #include <Penrose/Resources/Initializable.hpp>
 #include <Penrose/Resources/Resource.hpp>
 #include <Penrose/Resources/ResourceSet.hpp>
 
 #include "src/Common/JobQueue.hpp"
+#include "src/Rendering/FramePacer.hpp"
 
 namespace Penrose {
 
@@ -34,10 +41,22 @@ namespace Penrose {
 
         [[nodiscard]] RenderExecutionInfo getExecutionInfo() override { return this->_executionInfo; }
 
+        void setPacingInfo(FramePacingInfo &&pacingInfo) override;
+
+        [[nodiscard]] FramePacingInfo getPacingInfo() override;
+
+        [[nodiscard]] FrameTiming getFrameTiming() override;
+
+        [[nodiscard]] std::uint64_t waitForFrame(std::uint64_t frameIdx) override;
+
+        [[nodiscard]] std::uint32_t getMidFramePipelineCount() override;
+
     private:
         const ResourceSet *_resources;
         ResourceProxy<Log> _log;
         ResourceProxy<SurfaceEventQueue> _surfaceEventQueue;
+        ResourceProxy<Profiler> _profiler;
+        ResourceProxy<FrameStats> _frameStats;
 
         JobQueue _jobQueue;
 
@@ -47,8 +66,40 @@ namespace Penrose {
 
         RenderExecutionInfo _executionInfo;
 
+        // GPU scopes are tagged separately, so their statistics are not mixed with CPU scopes of same name
+        struct RendererTags {
+            Profiler::TagId cpu;
+            Profiler::TagId gpu;
+        };
+
+        struct ProfilerTags {
+            Profiler::TagId frame;
+            Profiler::TagId pacing;
+            Profiler::TagId wait;
+            Profiler::TagId submit;
+            Profiler::TagId cpuTime;
+            Profiler::TagId gpuTime;
+            std::map<std::string, RendererTags> renderers;
+        };
+
+        ProfilerTags _profilerTags;
+        Profiler::ThreadBuffer *_gpuTrack = nullptr;
+
+        FramePacingInfo _pacingInfo;
+        FramePacer _pacer;
+
+        std::mutex _frameMutex;
+        std::condition_variable _frameSubmitted;
+        std::optional<FramePacer::Clock::time_point> _lastFrameStart;
+        FrameTiming _frameTiming;
+        std::uint64_t _frameIdx = 0;
+        std::uint32_t _midFramePipelineCount = 0;
+
         void render();
         void invalidate();
+        void applyPacingInfo(const FramePacingInfo &pacingInfo);
+        void warmUpPipelines();
+        void recordGpuTimings(const GpuFrameTimings &timings);
     };
 }
 
@@ -0,0 +1,185 @@
+#include "ResourceInitializer.hpp"
+
+#include <algorithm>
+#include <ranges>
+#include <thread>
+
+#include <Penrose/Utils/TypeUtils.hpp>
+
+namespace Penrose {
+
+    inline static constexpr std::string_view TAG = "ResourceInitializer";
+
+    [[nodiscard]] inline double toMilliseconds(const std::chrono::steady_clock::duration duration) {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+    ResourceInitializer::ResourceInitializer(const ResourceSet *resources)
+        : _resources(resources),
+          _log(resources->get<Log>()) {
+        //
+    }
+
+    void ResourceInitializer::init() {
+        this->_nodes = this->_resources->getDependencyGraph<Initializable>();
+
+        const auto count = this->_nodes.size();
+
+        this->_dependents.assign(count, {});
+        this->_pendingDependencies.assign(count, 0);
+        this->_timings.assign(count, Timing {});
+        this->_initialized.clear();
+        this->_initialized.reserve(count);
+        this->_ready.clear();
+        this->_mainThreadReady.clear();
+        this->_finished = 0;
+        this->_error = nullptr;
+
+        for (std::size_t nodeIdx = 0; nodeIdx < count; nodeIdx++) {
+            const auto &dependencies = this->_nodes.at(nodeIdx).dependencies;
+
+            this->_pendingDependencies.at(nodeIdx) = dependencies.size();
+
+            for (const auto dependencyIdx: dependencies) {
+                this->_dependents.at(dependencyIdx).push_back(nodeIdx);
+            }
+
+            for (const auto dependencyIdx: this->_nodes.at(nodeIdx).laterDependencies) {
+                this->_log->writeWarning(
+                    TAG, "{} depends on {}, which is added later, so they could be initialized in parallel",
+                    getTypeName(this->_nodes.at(nodeIdx).type), getTypeName(this->_nodes.at(dependencyIdx).type)
+                );
+            }
+        }
+
+        for (std::size_t nodeIdx = 0; nodeIdx < count; nodeIdx++) {
+            if (this->_pendingDependencies.at(nodeIdx) == 0) {
+                this->enqueue(nodeIdx);
+            }
+        }
+
+        // calling thread takes part in initialization, it is the only one allowed to run main thread resources
+        const auto threadCount = std::clamp<std::size_t>(
+            std::thread::hardware_concurrency(), 1, std::max<std::size_t>(count, 1)
+        );
+        const auto start = Clock::now();
+
+        {
+            auto workers = std::vector<std::jthread>();
+
+            workers.reserve(threadCount - 1);
+
+            for (std::size_t thread = 1; thread < threadCount; thread++) {
+                workers.emplace_back([this, thread] { this->run(thread, false); });
+            }
+
+            this->run(0, true);
+        }
+
+        const auto end = Clock::now();
+
+        // resources initialized before failure are destroyed, so their threads and devices are not left alive
+        if (this->_error != nullptr) {
+            this->destroy();
+
+            std::rethrow_exception(this->_error);
+        }
+
+        this->writeTimeline(start, end, threadCount);
+    }
+
+    void ResourceInitializer::destroy() {
+        for (const auto nodeIdx: std::views::reverse(this->_initialized)) {
+            this->_nodes.at(nodeIdx).instance->destroy();
+        }
+
+        this->_initialized.clear();
+    }
+
+    void ResourceInitializer::run(const std::size_t thread, const bool mainThread) {
+        auto lock = std::unique_lock(this->_mutex);
+
+        while (true) {
+            this->_condition.wait(lock, [this, mainThread] {
+                return this->_error != nullptr || this->_finished == this->_nodes.size() || !this->_ready.empty()
+                       || (mainThread && !this->_mainThreadReady.empty());
+            });
+
+            if (this->_error != nullptr || this->_finished == this->_nodes.size()) {
+                return;
+            }
+
+            auto &queue = mainThread && !this->_mainThreadReady.empty() ? this->_mainThreadReady : this->_ready;
+            const auto nodeIdx = queue.front();
+
+            queue.pop_front();
+            lock.unlock();
+
+            auto error = std::exception_ptr();
+            const auto start = Clock::now();
+
+            try {
+                this->_nodes.at(nodeIdx).instance->init();
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            const auto end = Clock::now();
+
+            lock.lock();
+
+            // nothing is scheduled after first failure, resources being initialized by other threads are awaited
+            if (error != nullptr) {
+                if (this->_error == nullptr) {
+                    this->_error = error;
+                }
+
+                this->_condition.notify_all();
+
+                return;
+            }
+
+            this->_timings.at(nodeIdx) = Timing {.start = start, .end = end, .thread = thread};
+            this->_initialized.push_back(nodeIdx);
+            this->_finished++;
+
+            for (const auto dependentIdx: this->_dependents.at(nodeIdx)) {
+                if (--this->_pendingDependencies.at(dependentIdx) == 0) {
+                    this->enqueue(dependentIdx);
+                }
+            }
+
+            this->_condition.notify_all();
+        }
+    }
+
+    void ResourceInitializer::enqueue(const std::size_t nodeIdx) {
+        if (this->_nodes.at(nodeIdx).mainThread) {
+            this->_mainThreadReady.push_back(nodeIdx);
+        } else {
+            this->_ready.push_back(nodeIdx);
+        }
+    }
+
+    void ResourceInitializer::writeTimeline(
+        const Clock::time_point start, const Clock::time_point end, const std::size_t threadCount
+    ) {
+        auto busy = Clock::duration::zero();
+
+        for (const auto nodeIdx: this->_initialized) {
+            const auto &timing = this->_timings.at(nodeIdx);
+
+            busy += timing.end - timing.start;
+
+            this->_log->writeInfo(
+                TAG, "{:8.2f} ms - {:8.2f} ms [thread {}] {}", toMilliseconds(timing.start - start),
+                toMilliseconds(timing.end - start), timing.thread, getTypeName(this->_nodes.at(nodeIdx).type)
+            );
+        }
+
+        this->_log->writeInfo(
+            TAG, "Initialized {} resources in {:.2f} ms on {} threads ({:.2f} ms of initialization in total)",
+            this->_initialized.size(), toMilliseconds(end - start), threadCount, toMilliseconds(busy)
+        );
+    }
+}
@@ -0,0 +1,66 @@
+#ifndef PENROSE_RESOURCES_RESOURCE_INITIALIZER_HPP
+#define PENROSE_RESOURCES_RESOURCE_INITIALIZER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+#include <Penrose/Common/Log.hpp>
+#include <Penrose/Resources/Initializable.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+
+namespace Penrose {
+
+    // initializes resources in order of their dependency graph, independent resources are initialized in parallel
+    class ResourceInitializer {
+    public:
+        explicit ResourceInitializer(const ResourceSet *resources);
+
+        // should be called on main thread, resources requiring main thread are initialized by calling thread; on failure
+        // already initialized resources are destroyed before error is rethrown
+        void init();
+
+        // destroys initialized resources on calling thread in reverse order of initialization
+        void destroy();
+
+    private:
+        using Clock = std::chrono::steady_clock;
+        using Node = ResourceSet::DependencyNode<Initializable>;
+
+        struct Timing {
+            Clock::time_point start;
+            Clock::time_point end;
+            std::size_t thread;
+        };
+
+        const ResourceSet *_resources;
+        ResourceProxy<Log> _log;
+
+        std::vector<Node> _nodes;
+        std::vector<std::vector<std::size_t>> _dependents;
+        std::vector<std::size_t> _pendingDependencies;
+        std::vector<Timing> _timings;
+
+        // nodes in order of completed initialization
+        std::vector<std::size_t> _initialized;
+
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        std::deque<std::size_t> _ready;
+        std::deque<std::size_t> _mainThreadReady;
+        std::size_t _finished = 0;
+        std::exception_ptr _error;
+
+        void run(std::size_t thread, bool mainThread);
+
+        void enqueue(std::size_t nodeIdx);
+
+        void writeTimeline(Clock::time_point start, Clock::time_point end, std::size_t threadCount);
+    };
+}
+
+#endif // PENROSE_RESOURCES_RESOURCE_INITIALIZER_HPP
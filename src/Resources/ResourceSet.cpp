@@ -1,25 +1,150 @@
 #include <Penrose/Resources/ResourceSet.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+
 namespace Penrose {
 
+    struct ResourceTypeIds {
+        std::mutex mutex;
+        std::unordered_map<std::type_index, ResourceTypeId> ids;
+    };
+
+    // identifiers are shared by every resource set, so they are allocated by single process-wide table
+    static ResourceTypeIds &getResourceTypeIds() {
+        static ResourceTypeIds typeIds;
+
+        return typeIds;
+    }
+
+    ResourceTypeId getResourceTypeId(const std::type_index type) {
+        auto &typeIds = getResourceTypeIds();
+        auto lock = std::lock_guard(typeIds.mutex);
+
+        return typeIds.ids.emplace(type, static_cast<ResourceTypeId>(typeIds.ids.size())).first->second;
+    }
+
+    constinit static thread_local const ResourceSet *captureResources = nullptr;
+    constinit static thread_local std::vector<ResourceTypeId> *captureDependencies = nullptr;
+
     void ResourceSet::insert(
-        std::set<std::type_index> &&types, ResourceGroup group, std::unique_ptr<ResourceBase> &&instance
+        std::vector<TypedInstance> &&typedInstances, ResourceGroup group, InstanceRecord &&record
     ) noexcept {
-        const auto it = this->_instances.insert(this->_instances.end(), std::forward<decltype(instance)>(instance));
+        const auto recordIdx = this->_instances.size();
+
+        this->_instances.push_back(std::forward<decltype(record)>(record));
 
-        for (const auto &type: types) {
-            this->_typeMap[type][group].emplace_back(it);
+        for (const auto &[type, typedInstance]: typedInstances) {
+            if (type >= this->_entries.size()) {
+                this->_entries.resize(type + 1);
+            }
+
+            auto &entry = this->_entries[type];
+
+            if (entry == nullptr) {
+                entry = std::make_unique<TypeEntry>();
+            }
+
+            // instances are kept sorted by group, instances of same group are kept in order of addition
+            const auto idx = std::ranges::upper_bound(entry->groups, group) - entry->groups.begin();
+
+            entry->instances.insert(entry->instances.begin() + idx, typedInstance);
+            entry->records.insert(entry->records.begin() + idx, recordIdx);
+            entry->groups.insert(entry->groups.begin() + idx, group);
         }
     }
 
-    std::optional<const ResourceSet::GroupMap *> ResourceSet::tryResolveByType(const std::type_index type
-    ) const noexcept {
-        const auto it = this->_typeMap.find(type);
+    ResourceSet::DependencyCapture ResourceSet::exchangeCapture(const DependencyCapture capture) noexcept {
+        const auto previous = DependencyCapture {
+            .resources = captureResources,
+            .dependencies = captureDependencies,
+        };
+
+        captureResources = capture.resources;
+        captureDependencies = capture.dependencies;
+
+        return previous;
+    }
+
+    void ResourceSet::recordDependency(const ResourceTypeId type) const noexcept {
+        if (captureResources != this || captureDependencies == nullptr) {
+            return;
+        }
+
+        // dependency is recorded only once, constructors usually request few types
+        if (std::ranges::find(*captureDependencies, type) != captureDependencies->end()) {
+            return;
+        }
+
+        try {
+            captureDependencies->push_back(type);
+        } catch (...) {
+            // missing dependency only weakens parallelism of initialization
+        }
+    }
+
+    std::vector<ResourceSet::NodeDependencies> ResourceSet::getDependencies(const std::vector<std::size_t> &records
+    ) const {
+        constexpr auto NO_NODE = std::numeric_limits<std::size_t>::max();
+
+        auto nodes = std::vector<std::size_t>(this->_instances.size(), NO_NODE);
+
+        for (std::size_t nodeIdx = 0; nodeIdx < records.size(); nodeIdx++) {
+            nodes.at(records.at(nodeIdx)) = nodeIdx;
+        }
+
+        auto dependencies = std::vector<NodeDependencies>(records.size());
+        auto visited = std::vector<bool>();
+        auto stack = std::vector<std::size_t>();
+
+        // dependencies are followed through resources of any type, so resource depends on target resources, which
+        // are hidden behind resources of other types
+        for (std::size_t nodeIdx = 0; nodeIdx < records.size(); nodeIdx++) {
+            visited.assign(this->_instances.size(), false);
+
+            visited.at(records.at(nodeIdx)) = true;
+            stack.push_back(records.at(nodeIdx));
+
+            while (!stack.empty()) {
+                const auto recordIdx = stack.back();
+
+                stack.pop_back();
+
+                for (const auto type: this->_instances.at(recordIdx).dependencies) {
+                    const auto entry = this->tryGetEntry(type);
+
+                    if (entry == nullptr) {
+                        continue;
+                    }
+
+                    for (const auto dependencyIdx: entry->records) {
+                        if (visited.at(dependencyIdx)) {
+                            continue;
+                        }
+
+                        visited.at(dependencyIdx) = true;
+                        stack.push_back(dependencyIdx);
+
+                        if (nodes.at(dependencyIdx) == NO_NODE) {
+                            continue;
+                        }
+
+                        // dependencies on later nodes would contradict order of addition, so they are reported apart
+                        if (nodes.at(dependencyIdx) < nodeIdx) {
+                            dependencies.at(nodeIdx).earlier.push_back(nodes.at(dependencyIdx));
+                        } else {
+                            dependencies.at(nodeIdx).later.push_back(nodes.at(dependencyIdx));
+                        }
+                    }
+                }
+            }
 
-        if (it == this->_typeMap.end()) {
-            return std::nullopt;
+            std::ranges::sort(dependencies.at(nodeIdx).earlier);
+            std::ranges::sort(dependencies.at(nodeIdx).later);
         }
 
-        return &it->second;
+        return dependencies;
     }
 }
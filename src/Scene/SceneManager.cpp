@@ -6,6 +6,7 @@
 #include <fmt/core.h>
 
 #include <Penrose/Common/EngineError.hpp>
+#include <Penrose/Performance/MemoryTracker.hpp>
 #include <Penrose/Utils/OptionalUtils.hpp>
 
 namespace Penrose {
@@ -19,6 +20,7 @@ namespace Penrose {
             throw EngineError(fmt::format("Root {} already exists", name));
         }
 
+        const auto memoryScope = MemoryTagScope(MemoryTag::Scene);
         auto root = std::make_shared<SceneNode>();
 
         this->_roots[name] = root;
@@ -133,6 +135,7 @@ namespace Penrose {
     }
 
     SceneNodePtr SceneManager::insertEmptyNode(const SceneNodePtr &parent) {
+        const auto memoryScope = MemoryTagScope(MemoryTag::Scene);
         auto node = std::make_shared<SceneNode>(parent);
 
         parent->addDescendant(node);
@@ -0,0 +1,531 @@
+#include <Penrose/UI/BinaryLayout.hpp>
+
+#include <bit>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <Penrose/Common/EngineError.hpp>
+#include <Penrose/UI/Widgets/Button.hpp>
+#include <Penrose/UI/Widgets/Checkbox.hpp>
+#include <Penrose/UI/Widgets/Group.hpp>
+#include <Penrose/UI/Widgets/Input.hpp>
+#include <Penrose/UI/Widgets/Label.hpp>
+#include <Penrose/UI/Widgets/List.hpp>
+#include <Penrose/UI/Widgets/MenuBar.hpp>
+#include <Penrose/UI/Widgets/MenuEntry.hpp>
+#include <Penrose/UI/Widgets/MenuSection.hpp>
+#include <Penrose/UI/Widgets/Select.hpp>
+#include <Penrose/UI/Widgets/Separator.hpp>
+#include <Penrose/UI/Widgets/Window.hpp>
+
+#include "src/Assets/Structs.hpp"
+
+namespace Penrose {
+
+    // version of binary layout, should be increased on incompatible changes
+    inline constexpr std::uint32_t BINARY_LAYOUT_VERSION = 2;
+
+    // nesting limit protects reader from malformed input
+    inline constexpr std::uint32_t MAX_WIDGET_DEPTH = 256;
+
+    enum class PropertyTag : std::uint8_t {
+        None = 0x00,
+        Constant = 0x01,
+        Binding = 0x02
+    };
+
+    class BinaryLayoutWriter {
+    public:
+        [[nodiscard]] std::vector<unsigned char> write(const Widget *root) {
+            this->writeWidget(root);
+
+            auto content = std::vector<unsigned char>();
+            content.reserve(this->_stringsSize + this->_body.size());
+
+            append(content, BINARY_LAYOUT_VERSION);
+            append(content, static_cast<std::uint32_t>(this->_strings.size()));
+
+            for (const auto &string: this->_strings) {
+                append(content, static_cast<std::uint32_t>(string.size()));
+                content.insert(content.end(), string.begin(), string.end());
+            }
+
+            content.insert(content.end(), this->_body.begin(), this->_body.end());
+
+            return content;
+        }
+
+    private:
+        std::vector<unsigned char> _body;
+        std::vector<std::string> _strings;
+        std::map<std::string, std::uint32_t, std::less<>> _stringIds;
+        std::size_t _stringsSize = 2 * sizeof(std::uint32_t);
+
+        template <typename T>
+        static void append(std::vector<unsigned char> &buffer, const T value) {
+            const auto raw = static_cast<std::uint64_t>(value);
+
+            for (std::size_t idx = 0; idx < sizeof(T); idx++) {
+                buffer.push_back(static_cast<unsigned char>((raw >> (8 * idx)) & 0xFF));
+            }
+        }
+
+        [[nodiscard]] std::uint32_t intern(const std::string_view value) {
+            if (const auto it = this->_stringIds.find(value); it != this->_stringIds.end()) {
+                return it->second;
+            }
+
+            const auto id = static_cast<std::uint32_t>(this->_strings.size());
+
+            this->_strings.emplace_back(value);
+            this->_stringIds.emplace(value, id);
+            this->_stringsSize += sizeof(std::uint32_t) + value.size();
+
+            return id;
+        }
+
+        void writeConstant(const bool value) { append(this->_body, static_cast<std::uint8_t>(value)); }
+
+        void writeConstant(const int value) { append(this->_body, static_cast<std::uint32_t>(value)); }
+
+        void writeConstant(const float value) { append(this->_body, std::bit_cast<std::uint32_t>(value)); }
+
+        void writeConstant(const std::string &value) { append(this->_body, this->intern(value)); }
+
+        template <ValueType Type, typename T>
+        void writeProperty(const StrongTypedProperty<Type, T> &property) {
+            if (property.getPropertyType() == PropertyType::Constant) {
+                append(this->_body, PropertyTag::Constant);
+                this->writeConstant(property.getConstant());
+            } else {
+                append(this->_body, PropertyTag::Binding);
+                append(this->_body, this->intern(property.getBinding()));
+            }
+        }
+
+        template <ValueType Type>
+        void writeProperty(const BindableProperty<Type> &property) {
+            append(this->_body, PropertyTag::Binding);
+            append(this->_body, this->intern(property.getBinding()));
+        }
+
+        template <typename P>
+        void writeProperty(const std::optional<P> &property) {
+            if (property.has_value()) {
+                this->writeProperty(*property);
+            } else {
+                append(this->_body, PropertyTag::None);
+            }
+        }
+
+        void writeChildren(const WidgetList &children) {
+            append(this->_body, static_cast<std::uint32_t>(children.size()));
+
+            for (const auto &child: children) {
+                this->writeWidget(child.get());
+            }
+        }
+
+        void writeWidget(const Widget *widget) {
+            append(this->_body, static_cast<std::uint8_t>(widget->getType()));
+
+            this->writeProperty(widget->getEnabled());
+            this->writeProperty(widget->getVisible());
+
+            switch (widget->getType()) {
+                case WidgetType::Window: {
+                    const auto window = static_cast<const Window *>(widget);
+
+                    this->writeProperty(window->getTitle());
+                    this->writeProperty(window->getContext());
+                    this->writeProperty(window->getOpened());
+                    this->writeChildren(window->getChildren());
+                    break;
+                }
+
+                case WidgetType::Label:
+                    this->writeProperty(static_cast<const Label *>(widget)->getText());
+                    break;
+
+                case WidgetType::Button: {
+                    const auto button = static_cast<const Button *>(widget);
+
+                    this->writeProperty(button->getTitle());
+                    this->writeProperty(button->getAction());
+                    break;
+                }
+
+                case WidgetType::Input:
+                    this->writeProperty(static_cast<const Input *>(widget)->getText());
+                    break;
+
+                case WidgetType::Checkbox: {
+                    const auto checkbox = static_cast<const Checkbox *>(widget);
+
+                    this->writeProperty(checkbox->getText());
+                    this->writeProperty(checkbox->getChecked());
+                    break;
+                }
+
+                case WidgetType::List: {
+                    const auto list = static_cast<const List *>(widget);
+
+                    this->writeProperty(list->getItems());
+                    this->writeProperty(list->getSelection());
+                    this->writeProperty(list->getVirtualized());
+                    this->writeWidget(list->getItemTemplate().get());
+                    break;
+                }
+
+                case WidgetType::Group: {
+                    const auto group = static_cast<const Group *>(widget);
+
+                    this->writeProperty(group->getContext());
+                    this->writeChildren(group->getChildren());
+                    break;
+                }
+
+                case WidgetType::Select: {
+                    const auto select = static_cast<const Select *>(widget);
+
+                    this->writeProperty(select->getItems());
+                    this->writeProperty(select->getSelection());
+                    break;
+                }
+
+                case WidgetType::MenuBar:
+                    this->writeChildren(static_cast<const MenuBar *>(widget)->getChildren());
+                    break;
+
+                case WidgetType::MenuSection: {
+                    const auto menuSection = static_cast<const MenuSection *>(widget);
+
+                    this->writeProperty(menuSection->getTitle());
+                    this->writeChildren(menuSection->getChildren());
+                    break;
+                }
+
+                case WidgetType::MenuEntry: {
+                    const auto menuEntry = static_cast<const MenuEntry *>(widget);
+
+                    this->writeProperty(menuEntry->getTitle());
+                    this->writeProperty(menuEntry->getChecked());
+                    this->writeProperty(menuEntry->getAction());
+                    break;
+                }
+
+                case WidgetType::Separator:
+                    break;
+
+                default:
+                    throw EngineError("Widget is not supported");
+            }
+        }
+    };
+
+    class BinaryLayoutReader {
+    public:
+        explicit BinaryLayoutReader(const std::vector<unsigned char> &content)
+            : _content(content) {
+            //
+        }
+
+        [[nodiscard]] Layout *read() {
+            if (const auto version = this->read<std::uint32_t>(); version != BINARY_LAYOUT_VERSION) {
+                throw EngineError("Binary layout of version {} is not supported", version);
+            }
+
+            const auto stringCount = this->read<std::uint32_t>();
+
+            // every string takes at least its length, so count is checked before reservation
+            if (stringCount > this->remaining() / sizeof(std::uint32_t)) {
+                throw EngineError("Binary layout string table is truncated");
+            }
+
+            this->_strings.reserve(stringCount);
+
+            for (std::uint32_t stringIdx = 0; stringIdx < stringCount; stringIdx++) {
+                const auto size = this->read<std::uint32_t>();
+                const auto data = this->take(size);
+
+                this->_strings.emplace_back(reinterpret_cast<const char *>(data), size);
+            }
+
+            auto root = this->readWidget(0);
+
+            if (this->remaining() != 0) {
+                throw EngineError("Binary layout has {} trailing bytes", this->remaining());
+            }
+
+            return new Layout(std::move(root));
+        }
+
+    private:
+        const std::vector<unsigned char> &_content;
+        std::size_t _offset = 0;
+        std::vector<std::string> _strings;
+
+        [[nodiscard]] std::size_t remaining() const { return this->_content.size() - this->_offset; }
+
+        [[nodiscard]] const unsigned char *take(const std::size_t size) {
+            if (size > this->remaining()) {
+                throw EngineError("Binary layout is truncated at offset {}", this->_offset);
+            }
+
+            const auto data = this->_content.data() + this->_offset;
+            this->_offset += size;
+
+            return data;
+        }
+
+        template <typename T>
+        [[nodiscard]] T read() {
+            const auto data = this->take(sizeof(T));
+            std::uint64_t raw = 0;
+
+            for (std::size_t idx = 0; idx < sizeof(T); idx++) {
+                raw |= static_cast<std::uint64_t>(data[idx]) << (8 * idx);
+            }
+
+            return static_cast<T>(raw);
+        }
+
+        [[nodiscard]] std::string readString() {
+            const auto id = this->read<std::uint32_t>();
+
+            if (id >= this->_strings.size()) {
+                throw EngineError("Binary layout refers to unknown string {}", id);
+            }
+
+            return this->_strings[id];
+        }
+
+        template <typename T>
+        [[nodiscard]] T readConstant() {
+            if constexpr (std::is_same_v<T, bool>) {
+                return this->read<std::uint8_t>() != 0;
+            } else if constexpr (std::is_same_v<T, int>) {
+                return static_cast<int>(this->read<std::uint32_t>());
+            } else if constexpr (std::is_same_v<T, float>) {
+                return std::bit_cast<float>(this->read<std::uint32_t>());
+            } else {
+                return this->readString();
+            }
+        }
+
+        template <typename P>
+        [[nodiscard]] std::optional<P> readOptional() {
+            const auto tag = this->read<PropertyTag>();
+
+            if (tag == PropertyTag::None) {
+                return std::nullopt;
+            }
+
+            return this->readProperty<P>(tag);
+        }
+
+        template <typename P>
+        [[nodiscard]] P readRequired() {
+            return this->readProperty<P>(this->read<PropertyTag>());
+        }
+
+        template <typename P>
+        [[nodiscard]] P readProperty(const PropertyTag tag) {
+            if constexpr (requires(const P &property) { property.getConstant(); }) {
+                using T = std::remove_cvref_t<decltype(std::declval<P>().getConstant())>;
+
+                switch (tag) {
+                    case PropertyTag::Constant:
+                        return P(this->readConstant<T>());
+
+                    case PropertyTag::Binding:
+                        return P(PropertyType::Binding, T(), this->readString());
+
+                    default:
+                        throw EngineError("Binary layout property is missing");
+                }
+            } else {
+                if (tag != PropertyTag::Binding) {
+                    throw EngineError("Binary layout property should be binding");
+                }
+
+                return P(this->readString());
+            }
+        }
+
+        [[nodiscard]] WidgetList readChildren(const std::uint32_t depth) {
+            const auto count = this->read<std::uint32_t>();
+            auto children = WidgetList();
+
+            for (std::uint32_t childIdx = 0; childIdx < count; childIdx++) {
+                children.push_back(this->readWidget(depth + 1));
+            }
+
+            return children;
+        }
+
+        [[nodiscard]] WidgetInstance readWidget(const std::uint32_t depth) {
+            if (depth >= MAX_WIDGET_DEPTH) {
+                throw EngineError("Binary layout exceeds nesting limit of {} widgets", MAX_WIDGET_DEPTH);
+            }
+
+            const auto type = static_cast<WidgetType>(this->read<std::uint8_t>());
+            auto enabled = this->readRequired<BooleanProperty>();
+            auto visible = this->readRequired<BooleanProperty>();
+
+            switch (type) {
+                case WidgetType::Window: {
+                    auto title = this->readRequired<StringProperty>();
+                    auto context = this->readOptional<ObjectProperty>();
+                    auto opened = this->readOptional<BooleanProperty>();
+
+                    return std::make_unique<Window>(Window::Args {
+                        .enabled = std::move(enabled),
+                        .visible = std::move(visible),
+                        .title = std::move(title),
+                        .context = std::move(context),
+                        .opened = std::move(opened),
+                        .children = this->readChildren(depth),
+                    });
+                }
+
+                case WidgetType::Label:
+                    return std::make_unique<Label>(Label::Args {
+                        .enabled = std::move(enabled),
+                        .visible = std::move(visible),
+                        .text = this->readRequired<StringProperty>(),
+                    });
+
+                case WidgetType::Button: {
+                    auto title = this->readRequired<StringProperty>();
+
+                    return std::make_unique<Button>(Button::Args {
+                        .enabled = std::move(enabled),
+                        .visible = std::move(visible),
+                        .title = std::move(title),
+                        .action = this->readOptional<ActionProperty>(),
+                    });
+                }
+
+                case WidgetType::Input:
+                    return std::make_unique<Input>(Input::Args {
+                        .enabled = std::move(enabled),
+                        .visible = std::move(visible),
+                        .text = this->readRequired<StringProperty>(),
+                    });
+
+                case WidgetType::Checkbox: {
+                    auto text = this->readRequired<StringProperty>();
+
+                    return std::make_unique<Checkbox>(Checkbox::Args {
+                        .enabled = std::move(enabled),
+                        .visible = std::move(visible),
+                        .text = std::move(text),
+                        .checked = this->readRequired<BooleanProperty>(),
+                    });
+                }
+
+                case WidgetType::List: {
+                    auto items = this->readRequired<ListProperty>();
+                    auto selection = this->readRequired<IntegerProperty>();
+                    auto virtualized = this->readRequired<BooleanProperty>();
+
+                    return std::make_unique<List>(List::Args {
+                        .enabled = std::move(enabled),
+                        .visible = std::move(visible),
+                        .itemTemplate = this->readWidget(depth + 1),
+                        .items = std::move(items),
+                        .selection = std::move(selection),
+                        .virtualized = std::move(virtualized),
+                    });
+                }
+
+                case WidgetType::Group: {
+                    auto context = this->readOptional<ObjectProperty>();
+
+                    return std::make_unique<Group>(Group::Args {
+                        .enabled = std::move(enabled),
+                        .visible = std::move(visible),
+                        .context = std::move(context),
+                        .children = this->readChildren(depth),
+                    });
+                }
+
+                case WidgetType::Select: {
+                    auto items = this->readRequired<ListProperty>();
+
+                    return std::make_unique<Select>(Select::Args {
+                        .enabled = std::move(enabled),
+                        .visible = std::move(visible),
+                        .items = std::move(items),
+                        .selection = this->readRequired<IntegerProperty>(),
+                    });
+                }
+
+                case WidgetType::MenuBar:
+                    return std::make_unique<MenuBar>(MenuBar::Args {
+                        .enabled = std::move(enabled),
+                        .visible = std::move(visible),
+                        .children = this->readChildren(depth),
+                    });
+
+                case WidgetType::MenuSection: {
+                    auto title = this->readRequired<StringProperty>();
+
+                    return std::make_unique<MenuSection>(MenuSection::Args {
+                        .enabled = std::move(enabled),
+                        .visible = std::move(visible),
+                        .title = std::move(title),
+                        .children = this->readChildren(depth),
+                    });
+                }
+
+                case WidgetType::MenuEntry: {
+                    auto title = this->readRequired<StringProperty>();
+                    auto checked = this->readRequired<BooleanProperty>();
+
+                    return std::make_unique<MenuEntry>(MenuEntry::Args {
+                        .enabled = std::move(enabled),
+                        .visible = std::move(visible),
+                        .title = std::move(title),
+                        .checked = std::move(checked),
+                        .action = this->readOptional<ActionProperty>(),
+                    });
+                }
+
+                case WidgetType::Separator:
+                    return std::make_unique<Separator>();
+
+                default:
+                    throw EngineError("Binary layout contains unknown widget {}", static_cast<std::uint8_t>(type));
+            }
+        }
+    };
+
+    std::vector<unsigned char> writeBinaryLayout(const Widget *root) {
+        return BinaryLayoutWriter().write(root);
+    }
+
+    void writeBinaryLayoutAsset(const Widget *root, std::ostream &stream) {
+        const auto content = writeBinaryLayout(root);
+
+        const auto magic = MagicHeader {.value = {ASSET_MAGIC[0], ASSET_MAGIC[1], ASSET_MAGIC[2], ASSET_MAGIC[3]}};
+        const auto version = VersionHeader {.value = ASSET_VERSION};
+        const auto header = V1Header {.type = AssetType::UIBinaryLayout};
+        const auto info = UIBinaryLayoutInfo {.size = static_cast<std::uint32_t>(content.size())};
+
+        stream.write(reinterpret_cast<const char *>(&magic), sizeof(magic));
+        stream.write(reinterpret_cast<const char *>(&version), sizeof(version));
+        stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        stream.write(reinterpret_cast<const char *>(&info), sizeof(info));
+        stream.write(reinterpret_cast<const char *>(content.data()), static_cast<std::streamsize>(content.size()));
+    }
+
+    Layout *readBinaryLayout(const std::vector<unsigned char> &content) {
+        return BinaryLayoutReader(content).read();
+    }
+}
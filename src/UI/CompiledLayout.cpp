@@ -0,0 +1,258 @@
+#include <Penrose/UI/CompiledLayout.hpp>
+
+#include <fmt/core.h>
+
+#include <Penrose/Common/EngineError.hpp>
+#include <Penrose/UI/Widgets/Button.hpp>
+#include <Penrose/UI/Widgets/Checkbox.hpp>
+#include <Penrose/UI/Widgets/Group.hpp>
+#include <Penrose/UI/Widgets/Input.hpp>
+#include <Penrose/UI/Widgets/Label.hpp>
+#include <Penrose/UI/Widgets/List.hpp>
+#include <Penrose/UI/Widgets/MenuBar.hpp>
+#include <Penrose/UI/Widgets/MenuEntry.hpp>
+#include <Penrose/UI/Widgets/MenuSection.hpp>
+#include <Penrose/UI/Widgets/Select.hpp>
+#include <Penrose/UI/Widgets/Window.hpp>
+
+namespace Penrose {
+
+    template <ValueType Type>
+    constexpr SlotKind toSlotKind() {
+        switch (Type) {
+            case ValueType::Boolean:
+                return SlotKind::Boolean;
+
+            case ValueType::Integer:
+                return SlotKind::Integer;
+
+            case ValueType::Float:
+                return SlotKind::Float;
+
+            case ValueType::String:
+                return SlotKind::String;
+
+            default:
+                throw EngineError("Value type has no constant slot");
+        }
+    }
+
+    template <ValueType Type, typename Arena>
+    static auto &getArena(Arena &arena) {
+        if constexpr (Type == ValueType::Boolean) {
+            return arena.booleans;
+        } else if constexpr (Type == ValueType::Integer) {
+            return arena.integers;
+        } else if constexpr (Type == ValueType::Float) {
+            return arena.floats;
+        } else {
+            return arena.strings;
+        }
+    }
+
+    template <typename T>
+    static const T *tryGet(const std::optional<T> &property) {
+        return property.has_value() ? &*property : nullptr;
+    }
+
+    CompiledLayout CompiledLayout::compile(const Widget *root) {
+        auto layout = CompiledLayout();
+
+        const auto rootFrame = layout.addFrame();
+
+        layout.compileWidget(root, rootFrame, 0);
+        layout._frames.at(rootFrame).end = static_cast<std::uint32_t>(layout._instructions.size());
+
+        return layout;
+    }
+
+    void CompiledLayout::compileWidget(const Widget *widget, const std::uint32_t frameIdx, const std::uint32_t scope) {
+        const auto instructionIdx = static_cast<std::uint32_t>(this->_instructions.size());
+
+        this->_instructions.push_back(LayoutInstruction {
+            .type = widget->getType(),
+            .end = NO_INDEX,
+            .slot = static_cast<std::uint32_t>(this->_frames.at(frameIdx).slots.size()),
+            .frame = NO_INDEX,
+            .list = NO_INDEX,
+            .tag = fmt::format("##{}", instructionIdx),
+        });
+
+        this->addSlot(frameIdx, scope, &widget->getVisible());
+        this->addSlot(frameIdx, scope, &widget->getEnabled());
+
+        switch (widget->getType()) {
+            case WidgetType::Window: {
+                const auto window = static_cast<const Window *>(widget);
+                const auto childScope = window->getContext().has_value() ? this->openScope(frameIdx) : scope;
+
+                this->addSlot(frameIdx, scope, &window->getTitle());
+                this->addSlot(frameIdx, scope, tryGet(window->getContext()), SlotKind::Object);
+
+                if (window->getContext().has_value()) {
+                    this->_frames.at(frameIdx).slots.back().openedScope = childScope;
+                }
+
+                this->addSlot(frameIdx, scope, tryGet(window->getOpened()));
+
+                this->compileChildren(window->getChildren(), frameIdx, childScope);
+                break;
+            }
+
+            case WidgetType::Label:
+                this->addSlot(frameIdx, scope, &static_cast<const Label *>(widget)->getText());
+                break;
+
+            case WidgetType::Button: {
+                const auto button = static_cast<const Button *>(widget);
+
+                this->addSlot(frameIdx, scope, &button->getTitle());
+                this->addSlot(frameIdx, scope, tryGet(button->getAction()), SlotKind::Action);
+                break;
+            }
+
+            case WidgetType::Input:
+                this->addSlot(frameIdx, scope, &static_cast<const Input *>(widget)->getText());
+                break;
+
+            case WidgetType::Checkbox: {
+                const auto checkbox = static_cast<const Checkbox *>(widget);
+
+                this->addSlot(frameIdx, scope, &checkbox->getText());
+                this->addSlot(frameIdx, scope, &checkbox->getChecked());
+                break;
+            }
+
+            case WidgetType::List: {
+                const auto list = static_cast<const List *>(widget);
+
+                this->addSlot(frameIdx, scope, &list->getItems(), SlotKind::ObjectList);
+                this->addSlot(frameIdx, scope, &list->getSelection());
+                this->addSlot(frameIdx, scope, &list->getVirtualized());
+
+                // item template is resolved against every item, so it has its own frame
+                const auto templateFrame = this->addFrame();
+
+                this->_instructions.at(instructionIdx).list = this->_frames.at(frameIdx).listCount++;
+                this->_instructions.at(instructionIdx).frame = templateFrame;
+                this->_frames.at(templateFrame).begin = static_cast<std::uint32_t>(this->_instructions.size());
+
+                this->compileWidget(list->getItemTemplate().get(), templateFrame, 0);
+
+                this->_frames.at(templateFrame).end = static_cast<std::uint32_t>(this->_instructions.size());
+                break;
+            }
+
+            case WidgetType::Group: {
+                const auto group = static_cast<const Group *>(widget);
+                const auto childScope = group->getContext().has_value() ? this->openScope(frameIdx) : scope;
+
+                this->addSlot(frameIdx, scope, tryGet(group->getContext()), SlotKind::Object);
+
+                if (group->getContext().has_value()) {
+                    this->_frames.at(frameIdx).slots.back().openedScope = childScope;
+                }
+
+                this->compileChildren(group->getChildren(), frameIdx, childScope);
+                break;
+            }
+
+            case WidgetType::Select: {
+                const auto select = static_cast<const Select *>(widget);
+
+                this->addSlot(frameIdx, scope, &select->getItems(), SlotKind::StringList);
+                this->addSlot(frameIdx, scope, &select->getSelection());
+                break;
+            }
+
+            case WidgetType::MenuBar:
+                this->compileChildren(static_cast<const MenuBar *>(widget)->getChildren(), frameIdx, scope);
+                break;
+
+            case WidgetType::MenuSection: {
+                const auto menuSection = static_cast<const MenuSection *>(widget);
+
+                this->addSlot(frameIdx, scope, &menuSection->getTitle());
+
+                this->compileChildren(menuSection->getChildren(), frameIdx, scope);
+                break;
+            }
+
+            case WidgetType::MenuEntry: {
+                const auto menuEntry = static_cast<const MenuEntry *>(widget);
+
+                this->addSlot(frameIdx, scope, &menuEntry->getTitle());
+                this->addSlot(frameIdx, scope, &menuEntry->getChecked());
+                this->addSlot(frameIdx, scope, tryGet(menuEntry->getAction()), SlotKind::Action);
+                break;
+            }
+
+            case WidgetType::Separator:
+                break;
+
+            default:
+                throw EngineError("Widget is not supported");
+        }
+
+        this->_instructions.at(instructionIdx).end = static_cast<std::uint32_t>(this->_instructions.size());
+    }
+
+    void CompiledLayout::compileChildren(
+        const WidgetList &children, const std::uint32_t frameIdx, const std::uint32_t scope
+    ) {
+        for (const auto &child: children) {
+            this->compileWidget(child.get(), frameIdx, scope);
+        }
+    }
+
+    std::uint32_t CompiledLayout::addFrame() {
+        this->_frames.push_back(LayoutFrame {
+            .begin = static_cast<std::uint32_t>(this->_instructions.size()),
+            .end = NO_INDEX,
+            .slots = {},
+            .scopeCount = 1,
+            .listCount = 0,
+        });
+
+        return static_cast<std::uint32_t>(this->_frames.size() - 1);
+    }
+
+    template <ValueType Type, typename T>
+    void CompiledLayout::addSlot(
+        const std::uint32_t frameIdx, const std::uint32_t scope, const StrongTypedProperty<Type, T> *property
+    ) {
+        auto slot = LayoutSlot {
+            .kind = property != nullptr ? toSlotKind<Type>() : SlotKind::None,
+            .scope = scope,
+            .openedScope = NO_INDEX,
+            .constant = nullptr,
+            .binding = {},
+        };
+
+        if (property != nullptr && property->getPropertyType() == PropertyType::Constant) {
+            slot.constant = &getArena<Type>(this->_constants).emplace_back(property->getConstant(), true);
+        } else if (property != nullptr) {
+            slot.binding = ValuePath(property->getBinding());
+        }
+
+        this->_frames.at(frameIdx).slots.push_back(std::move(slot));
+    }
+
+    template <ValueType Type>
+    void CompiledLayout::addSlot(
+        const std::uint32_t frameIdx, const std::uint32_t scope, const BindableProperty<Type> *property,
+        const SlotKind kind
+    ) {
+        this->_frames.at(frameIdx).slots.push_back(LayoutSlot {
+            .kind = property != nullptr ? kind : SlotKind::None,
+            .scope = scope,
+            .openedScope = NO_INDEX,
+            .constant = nullptr,
+            .binding = property != nullptr ? ValuePath(property->getBinding()) : ValuePath(),
+        });
+    }
+
+    std::uint32_t CompiledLayout::openScope(const std::uint32_t frameIdx) {
+        return this->_frames.at(frameIdx).scopeCount++;
+    }
+}
@@ -3,7 +3,8 @@
 namespace Penrose {
 
     Layout::Layout(std::unique_ptr<Widget> &&root)
-        : _root(std::forward<decltype(root)>(root)) {
+        : _root(std::forward<decltype(root)>(root)),
+          _compiled(CompiledLayout::compile(this->_root.get())) {
         //
     }
 }
@@ -0,0 +1,140 @@
+#include <Penrose/UI/LayoutBinding.hpp>
+
+#include <algorithm>
+
+#include <Penrose/Common/EngineError.hpp>
+
+namespace Penrose {
+
+    [[nodiscard]] static bool isCompatible(const SlotKind kind, Value *value) {
+        switch (kind) {
+            case SlotKind::Boolean:
+                return value->getType() == ValueType::Boolean;
+
+            case SlotKind::Integer:
+                return value->getType() == ValueType::Integer;
+
+            case SlotKind::Float:
+                return value->getType() == ValueType::Float;
+
+            case SlotKind::String:
+                return value->getType() == ValueType::String;
+
+            case SlotKind::Action:
+                return value->getType() == ValueType::Action;
+
+            case SlotKind::Object:
+                return value->getType() == ValueType::Object;
+
+            case SlotKind::ObjectList:
+                return dynamic_cast<ListValue<ObjectValue> *>(value) != nullptr;
+
+            case SlotKind::StringList:
+                return dynamic_cast<ListValue<StringValue> *>(value) != nullptr;
+
+            default:
+                return false;
+        }
+    }
+
+    LayoutBinding::LayoutBinding(const CompiledLayout *layout, const ObjectValue *context)
+        : _layout(layout),
+          _context(context) {
+        //
+    }
+
+    FrameBinding &LayoutBinding::getRoot() {
+        // properties of context or of object along bound path were added, replaced or removed, so every slot is
+        // resolved again
+        if (this->_bound && isStale(this->_root)) {
+            this->invalidate();
+        }
+
+        if (!this->_bound) {
+            this->bind(this->_root, this->_layout->getFrames().at(CompiledLayout::ROOT_FRAME), this->_context);
+            this->_bound = true;
+        }
+
+        return this->_root;
+    }
+
+    FrameBinding &LayoutBinding::getItem(
+        FrameBinding &parent, const LayoutInstruction &list, const std::size_t idx,
+        const std::shared_ptr<ObjectValue> &item
+    ) {
+        auto &listBinding = parent.lists.at(list.list);
+
+        if (listBinding.items.size() <= idx) {
+            listBinding.items.resize(idx + 1);
+            listBinding.frames.resize(idx + 1);
+        }
+
+        // item is kept alive by binding, so same pointer always means same item; its properties are checked by stamps
+        if (listBinding.items.at(idx) != item || isStale(listBinding.frames.at(idx))) {
+            this->bind(listBinding.frames.at(idx), this->_layout->getFrames().at(list.frame), item.get());
+            listBinding.items.at(idx) = item;
+        }
+
+        return listBinding.frames.at(idx);
+    }
+
+    void LayoutBinding::trimItems(FrameBinding &parent, const LayoutInstruction &list, const std::size_t count) {
+        auto &listBinding = parent.lists.at(list.list);
+
+        if (listBinding.items.size() > count) {
+            listBinding.items.resize(count);
+            listBinding.frames.resize(count);
+        }
+    }
+
+    void LayoutBinding::invalidate() {
+        this->_root = {};
+        this->_bound = false;
+    }
+
+    bool LayoutBinding::isStale(const FrameBinding &binding) {
+
+        // parents are checked first, so child is never accessed after its parent has released it
+        return std::ranges::any_of(binding.stamps, [](const ObjectStamp &entry) {
+            return entry.object->getStamp() != entry.stamp;
+        });
+    }
+
+    void LayoutBinding::bind(FrameBinding &binding, const LayoutFrame &frame, const ObjectValue *context) const {
+        auto scopes = std::vector<const ObjectValue *>(frame.scopeCount, nullptr);
+        scopes.at(0) = context;
+
+        binding.stamps.assign({ObjectStamp {.object = context, .stamp = context->getStamp()}});
+        binding.values.assign(frame.slots.size(), nullptr);
+        binding.caches.assign(frame.slots.size(), {});
+        binding.owners.clear();
+        binding.lists.assign(frame.listCount, {});
+
+        for (std::size_t slotIdx = 0; slotIdx < frame.slots.size(); slotIdx++) {
+            const auto &slot = frame.slots.at(slotIdx);
+
+            if (slot.kind == SlotKind::None) {
+                continue;
+            }
+
+            if (slot.constant != nullptr) {
+                binding.values.at(slotIdx) = slot.constant;
+
+                continue;
+            }
+
+            auto value = slot.binding.resolve(scopes.at(slot.scope), &binding.stamps);
+
+            if (!isCompatible(slot.kind, value.get())) {
+                throw EngineError("Property {} has incompatible type", slot.binding.getPath());
+            }
+
+            if (slot.openedScope != NO_INDEX) {
+                scopes.at(slot.openedScope) = static_cast<const ObjectValue *>(value.get());
+            }
+
+            binding.values.at(slotIdx) = value.get();
+            binding.owners.push_back(std::move(value));
+        }
+    }
+}
@@ -167,7 +167,8 @@ namespace Penrose {
                 .enabled = getOptionalAttribute(element, "enabled", BooleanProperty(true)),
                 .visible = getOptionalAttribute(element, "visible", BooleanProperty(true)),
                 .items = getRequiredAttribute<ListProperty>(element, "items"),
-                .selection = getRequiredAttribute<IntegerProperty>(element, "selection")
+                .selection = getRequiredAttribute<IntegerProperty>(element, "selection"),
+                .virtualized = getOptionalAttribute(element, "virtualized", BooleanProperty(false))
             };
 
             auto itemTemplate = dynamic_cast<const xmlpp::Element *>(element->get_first_child("list-item"));
@@ -1,6 +1,7 @@
 #include <Penrose/UI/UIManager.hpp>
 
 #include <Penrose/Common/EngineError.hpp>
+#include <Penrose/Performance/MemoryTracker.hpp>
 
 namespace Penrose {
 
@@ -14,6 +15,7 @@ namespace Penrose {
     }
 
     void UIManager::createContext(std::string_view &&name) {
+        const auto memoryScope = MemoryTagScope(MemoryTag::UI);
         const auto nameStr = std::string(std::forward<decltype(name)>(name));
 
         if (this->_contexts.contains(nameStr)) {
@@ -32,6 +34,7 @@ namespace Penrose {
     void UIManager::addLayoutToContext(
         std::string_view &&name, std::string_view &&layout, std::shared_ptr<ObjectValue> &&valueContext
     ) {
+        const auto memoryScope = MemoryTagScope(MemoryTag::UI);
         const auto nameStr = std::string(name);
         const auto it = this->_contexts.find(nameStr);
 
@@ -1,6 +1,12 @@
 #include <Penrose/UI/Value.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include <Penrose/Common/EngineError.hpp>
@@ -16,66 +22,244 @@ namespace Penrose {
         this->_delegate();
     }
 
+    struct ValueKey::Interned {
+        std::string name;
+        std::size_t hash;
+    };
+
+    // keys are never released, count of distinct property names is bounded by code and layouts
+    const ValueKey::Interned *ValueKey::intern(const std::string_view name) {
+        static std::mutex mutex;
+        static std::deque<Interned> storage;
+        static std::unordered_map<std::string_view, const Interned *> keys;
+
+        std::lock_guard guard(mutex);
+
+        if (const auto it = keys.find(name); it != keys.end()) {
+            return it->second;
+        }
+
+        const auto &key = storage.emplace_back(std::string(name), std::hash<std::string_view>()(name));
+        keys.emplace(key.name, &key);
+
+        return &key;
+    }
+
+    static std::uint64_t nextStamp() {
+        constinit static std::atomic_uint64_t stamp = 1;
+
+        return stamp.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ValueKey::ValueKey(const std::string_view name)
+        : _key(intern(name)) {
+        //
+    }
+
+    std::string_view ValueKey::getName() const {
+        return this->_key->name;
+    }
+
+    std::size_t ValueKey::getHash() const {
+        return this->_key->hash;
+    }
+
     ObjectValue::ObjectValue(ObjectValue::Container &&properties)
-        : _properties(properties) {
+        : _stamp(nextStamp()) {
+        for (auto &[name, value]: properties) {
+            this->set(ValueKey(name), std::move(value));
+        }
+    }
+
+    ObjectValue::ObjectValue(const ObjectValue &other)
+        : Value(other),
+          _properties(other._properties),
+          _table(other._table),
+          _stamp(nextStamp()) {
         //
     }
 
+    ObjectValue::ObjectValue(ObjectValue &&other) noexcept
+        : Value(std::move(other)),
+          _properties(std::move(other._properties)),
+          _table(std::move(other._table)),
+          _stamp(nextStamp()) {
+        other._table.clear();
+        other._stamp = nextStamp();
+    }
+
+    ObjectValue &ObjectValue::operator=(const ObjectValue &other) {
+        if (this != &other) {
+            this->_properties = other._properties;
+            this->_table = other._table;
+            this->_stamp = nextStamp();
+        }
+
+        return *this;
+    }
+
+    ObjectValue &ObjectValue::operator=(ObjectValue &&other) noexcept {
+        if (this != &other) {
+            this->_properties = std::move(other._properties);
+            this->_table = std::move(other._table);
+            this->_stamp = nextStamp();
+
+            other._properties.clear();
+            other._table.clear();
+            other._stamp = nextStamp();
+        }
+
+        return *this;
+    }
+
     ObjectValue &ObjectValue::property(std::string_view &&name, const std::shared_ptr<Value> &value) {
-        this->_properties.emplace(std::forward<decltype(name)>(name), value);
+        this->set(ValueKey(name), std::shared_ptr<Value>(value));
 
         return *this;
     }
 
     ObjectValue &ObjectValue::property(std::string_view &&name, std::shared_ptr<Value> &&value) {
-        this->_properties.emplace(std::forward<decltype(name)>(name), std::forward<decltype(value)>(value));
+        this->set(ValueKey(name), std::forward<decltype(value)>(value));
 
         return *this;
     }
 
+    bool ObjectValue::removeProperty(const std::string_view name) {
+        const auto idx = this->find(name);
+
+        if (idx == NO_PROPERTY) {
+            return false;
+        }
+
+        this->_properties.erase(std::next(this->_properties.begin(), idx));
+        this->rebuildTable(this->_table.size());
+        this->_stamp = nextStamp();
+
+        return true;
+    }
+
     std::optional<std::shared_ptr<Value>> ObjectValue::tryGetProperty(const std::string_view &name) const {
-        auto it = this->_properties.find(std::string(name));
+        const auto idx = this->find(name);
+
+        if (idx == NO_PROPERTY) {
+            return std::nullopt;
+        }
+
+        return this->_properties[idx].value;
+    }
+
+    std::optional<std::shared_ptr<Value>> ObjectValue::tryGetProperty(const ValueKey &key) const {
+        const auto idx = this->find(key);
 
-        if (it == this->_properties.end()) {
+        if (idx == NO_PROPERTY) {
             return std::nullopt;
         }
 
-        return it->second;
+        return this->_properties[idx].value;
     }
 
     std::shared_ptr<Value> ObjectValue::getPropertyByPath(const std::string_view &path) const {
-        std::vector<std::string_view> properties;
+        auto current = this;
+        std::string_view::size_type begin = 0;
 
-        std::string_view remain = path;
-        std::string_view::size_type idx = remain.find('.');
+        // path is used once, so it is walked by names instead of being interned into ValuePath
+        while (true) {
+            const auto end = std::min(path.find('.', begin), path.size());
+            const auto name = path.substr(begin, end - begin);
+            const auto idx = current->find(name);
 
-        do {
-            properties.emplace_back(remain.substr(0, idx));
-            remain = remain.substr(idx + 1);
-        } while ((idx = remain.find('.')) && idx != std::string_view::npos);
+            if (idx == NO_PROPERTY) {
+                throw EngineError("No such property {}", name);
+            }
 
-        auto currentObject = this;
-        std::optional<std::shared_ptr<Value>> value;
+            const auto &value = current->_properties[idx].value;
 
-        for (std::uint32_t propertyIdx = 0; propertyIdx < properties.size(); ++propertyIdx) {
-            auto property = properties.at(propertyIdx);
-            value = currentObject->tryGetProperty(property);
+            if (end == path.size()) {
+                return value;
+            }
 
-            if (!value.has_value()) {
-                throw EngineError("No such property {}", property);
+            if (value == nullptr || value->getType() != ValueType::Object) {
+                throw EngineError("Property {} is not an object", name);
             }
 
-            if (propertyIdx == properties.size() - 1) {
-                return *value;
+            current = static_cast<const ObjectValue *>(value.get());
+            begin = end + 1;
+        }
+    }
+
+    std::uint32_t ObjectValue::find(const std::string_view name) const {
+        if (this->_table.empty()) {
+            return NO_PROPERTY;
+        }
+
+        const auto mask = this->_table.size() - 1;
+
+        // interned keys are hashed same way, so name is found without interning
+        for (auto slot = std::hash<std::string_view>()(name) & mask;; slot = (slot + 1) & mask) {
+            const auto idx = this->_table[slot];
+
+            if (idx == NO_PROPERTY || this->_properties[idx].key.getName() == name) {
+                return idx;
             }
+        }
+    }
+
+    std::uint32_t ObjectValue::find(const ValueKey &key) const {
+        if (this->_table.empty()) {
+            return NO_PROPERTY;
+        }
 
-            currentObject = dynamic_cast<ObjectValue *>(value->get());
+        const auto mask = this->_table.size() - 1;
 
-            if (currentObject == nullptr) {
-                throw EngineError("Property {} is not an object", property);
+        for (auto slot = key.getHash() & mask;; slot = (slot + 1) & mask) {
+            const auto idx = this->_table[slot];
+
+            if (idx == NO_PROPERTY || this->_properties[idx].key == key) {
+                return idx;
             }
         }
+    }
+
+    void ObjectValue::set(ValueKey key, std::shared_ptr<Value> &&value) {
+        if (const auto idx = this->find(key); idx != NO_PROPERTY) {
+            this->_properties[idx].value = std::forward<decltype(value)>(value);
+            this->_stamp = nextStamp();
+
+            return;
+        }
 
-        throw EngineError("Out of reach");
+        this->_properties.push_back(Property {.key = key, .value = std::forward<decltype(value)>(value)});
+
+        // load factor is kept below 3/4, so probe sequences stay short and always reach empty slot
+        if (4 * this->_properties.size() > 3 * this->_table.size()) {
+            this->rebuildTable(std::max<std::size_t>(8, 2 * this->_table.size()));
+        } else {
+            const auto mask = this->_table.size() - 1;
+            auto slot = key.getHash() & mask;
+
+            while (this->_table[slot] != NO_PROPERTY) {
+                slot = (slot + 1) & mask;
+            }
+
+            this->_table[slot] = static_cast<std::uint32_t>(this->_properties.size() - 1);
+        }
+
+        this->_stamp = nextStamp();
+    }
+
+    void ObjectValue::rebuildTable(const std::size_t size) {
+        this->_table.assign(size, NO_PROPERTY);
+
+        const auto mask = size - 1;
+
+        for (std::size_t idx = 0; idx < this->_properties.size(); idx++) {
+            auto slot = this->_properties[idx].key.getHash() & mask;
+
+            while (this->_table[slot] != NO_PROPERTY) {
+                slot = (slot + 1) & mask;
+            }
+
+            this->_table[slot] = static_cast<std::uint32_t>(idx);
+        }
     }
 }
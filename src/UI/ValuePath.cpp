@@ -0,0 +1,74 @@
+#include <Penrose/UI/ValuePath.hpp>
+
+#include <algorithm>
+
+#include <Penrose/Common/EngineError.hpp>
+
+namespace Penrose {
+
+    ValuePath::ValuePath(const std::string_view path)
+        : _path(path) {
+        std::string_view::size_type begin = 0;
+
+        while (begin <= path.size()) {
+            const auto end = std::min(path.find('.', begin), path.size());
+            const auto name = path.substr(begin, end - begin);
+
+            if (name.empty()) {
+                throw EngineError("Property path {} contains empty segment", path);
+            }
+
+            // zero stamp is never assigned to object, so new segment is always resolved on first use
+            this->_segments.push_back(Segment {
+                .key = ValueKey(name),
+                .stamp = 0,
+                .property = ObjectValue::NO_PROPERTY,
+            });
+
+            begin = end + 1;
+        }
+    }
+
+    std::shared_ptr<Value> ValuePath::resolve(const ObjectValue *root, std::vector<ObjectStamp> *visited) const {
+        if (this->_segments.empty()) {
+            throw EngineError("Property path is empty");
+        }
+
+        auto current = root;
+
+        for (std::size_t segmentIdx = 0; segmentIdx < this->_segments.size(); segmentIdx++) {
+            const auto &segment = this->_segments[segmentIdx];
+
+            if (visited != nullptr && std::ranges::none_of(*visited, [&](const ObjectStamp &entry) {
+                    return entry.object == current;
+                })) {
+                visited->push_back(ObjectStamp {.object = current, .stamp = current->getStamp()});
+            }
+
+            if (segment.stamp != current->getStamp()) {
+                const auto property = current->find(segment.key);
+
+                if (property == ObjectValue::NO_PROPERTY) {
+                    throw EngineError("No such property {}", segment.key.getName());
+                }
+
+                segment.stamp = current->getStamp();
+                segment.property = property;
+            }
+
+            const auto &value = current->_properties[segment.property].value;
+
+            if (segmentIdx == this->_segments.size() - 1) {
+                return value;
+            }
+
+            if (value == nullptr || value->getType() != ValueType::Object) {
+                throw EngineError("Property {} is not an object", segment.key.getName());
+            }
+
+            current = static_cast<const ObjectValue *>(value.get());
+        }
+
+        throw EngineError("Out of reach");
+    }
+}
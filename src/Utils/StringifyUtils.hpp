@@ -2,6 +2,7 @@
 #define PENROSE_UTILS_STRINGIFY_UTILS_HPP
 
 #include <Penrose/Common/EngineError.hpp>
+#include <Penrose/Performance/FrameStats.hpp>
 
 namespace Penrose {
 
@@ -23,6 +24,22 @@ namespace Penrose {
                 throw EngineError("Log level is not supported");
         }
     }
+
+    constexpr std::string_view toString(const FrameSource source) {
+        switch (source) {
+            case FrameSource::Engine:
+                return "Engine";
+
+            case FrameSource::Render:
+                return "Render";
+
+            case FrameSource::Systems:
+                return "Systems";
+
+            default:
+                throw EngineError("Frame source is not supported");
+        }
+    }
 }
 
 #endif // PENROSE_UTILS_STRINGIFY_UTILS_HPP
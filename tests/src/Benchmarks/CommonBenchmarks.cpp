@@ -0,0 +1,85 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+
+#include <Penrose/Common/Params.hpp>
+
+#include "../src/Common/BitSet.hpp"
+#include "../src/Common/OrderedQueue.hpp"
+
+using namespace Penrose;
+
+TEST_CASE("Common / BitSet benchmark", "[engine-benchmark][Common][BitSet]") {
+    constexpr std::size_t size = 4096;
+
+    auto bitset = BitSet(size);
+
+    for (std::size_t idx = 0; idx < size; idx += 3) {
+        bitset.set(idx, true);
+    }
+
+    BENCHMARK("Set and reset every bit") {
+        for (std::size_t idx = 0; idx < size; idx++) {
+            bitset.set(idx, !bitset.at(idx));
+        }
+
+        return bitset.size();
+    };
+
+    BENCHMARK("Check any") {
+        return bitset.any();
+    };
+
+    BENCHMARK("Check all") {
+        return bitset.all();
+    };
+
+    BENCHMARK("Resize") {
+        auto copy = BitSet(BitSet::BITS_PER_BLOCK);
+        copy.resize(size);
+
+        return copy.size();
+    };
+}
+
+TEST_CASE("Common / OrderedQueue benchmark", "[engine-benchmark][Common][OrderedQueue]") {
+    constexpr int count = 1024;
+
+    BENCHMARK("Push and pop 1024 items") {
+        auto queue = OrderedQueue<int>();
+
+        // multiplicative hash gives shuffled but reproducible order of items
+        for (int idx = 0; idx < count; idx++) {
+            queue.push(static_cast<int>((static_cast<std::uint32_t>(idx) * 2654435761u) % count));
+        }
+
+        int sum = 0;
+
+        while (!queue.empty()) {
+            sum += queue.front();
+            queue.pop();
+        }
+
+        return sum;
+    };
+}
+
+TEST_CASE("Common / Params benchmark", "[engine-benchmark][Common][Params]") {
+    auto params = Params();
+
+    for (int idx = 0; idx < 16; idx++) {
+        std::ignore = params.add(std::string_view(std::to_string(idx)), idx);
+    }
+
+    std::ignore = params.add("mesh", std::string("models/cube")).add("visible", true).add("scale", 1.5f);
+
+    BENCHMARK("Lookup existing key") {
+        return params.get<std::string>("mesh").size();
+    };
+
+    BENCHMARK("Lookup missing key") {
+        return params.tryGet<float>("missing").has_value();
+    };
+}
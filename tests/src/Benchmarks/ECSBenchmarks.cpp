@@ -0,0 +1,115 @@
+#include <catch2/catch_all.hpp>
+
+#include <vector>
+
+#include <Penrose/ECS/Component.hpp>
+#include <Penrose/Events/ECSEvents.hpp>
+#include <Penrose/Performance/MetricsRegistry.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+
+#include "../src/Common/LogImpl.hpp"
+#include "../src/ECS/EntityManagerImpl.hpp"
+#include "../src/ECS/EntityStore.hpp"
+
+using namespace Penrose;
+
+struct BenchPositionComponent final: Component<BenchPositionComponent> {
+    ~BenchPositionComponent() override = default;
+
+    float x = 0;
+    float y = 0;
+};
+
+struct BenchVelocityComponent final: Component<BenchVelocityComponent> {
+    ~BenchVelocityComponent() override = default;
+
+    float x = 1;
+    float y = 1;
+};
+
+TEST_CASE("ECS / EntityStore benchmark", "[engine-benchmark][ECS][EntityStore]") {
+    constexpr std::size_t count = 1024;
+
+    auto store = EntityStore();
+    auto entities = std::vector<Entity>(count);
+
+    BENCHMARK("Acquire and release 1024 entities") {
+        for (auto &entity: entities) {
+            entity = store.acquire();
+        }
+
+        for (const auto entity: entities) {
+            store.release(entity);
+        }
+
+        return store.size();
+    };
+}
+
+TEST_CASE("ECS / EntityManagerImpl benchmark", "[engine-benchmark][ECS][EntityManagerImpl]") {
+    constexpr std::size_t count = 1024;
+
+    auto resources = ResourceSet();
+
+    resources.add<LogImpl>().implements<Log>().done();
+    resources.add<MetricsRegistry>().done();
+    resources.add<ECSEventQueue>().done();
+
+    // benchmark goes through interface, like any system does
+    EntityManager *entityManager = resources.add<EntityManagerImpl>().implements<EntityManager>().done();
+
+    auto entities = std::vector<Entity>(count);
+
+    for (auto &entity: entities) {
+        entity = entityManager->createEntity();
+
+        entityManager->addComponent<BenchPositionComponent>(entity);
+    }
+
+    BENCHMARK("Add and remove component") {
+        for (const auto entity: entities) {
+            entityManager->addComponent<BenchVelocityComponent>(entity, BenchVelocityComponent());
+        }
+
+        for (const auto entity: entities) {
+            entityManager->removeComponent<BenchVelocityComponent>(entity);
+        }
+    };
+
+    // only every second entity is moving, so query has to skip half of entries
+    for (std::size_t idx = 0; idx < count; idx += 2) {
+        entityManager->addComponent<BenchVelocityComponent>(entities.at(idx));
+    }
+
+    BENCHMARK("Get component") {
+        float sum = 0;
+
+        for (const auto entity: entities) {
+            sum += entityManager->getComponent<BenchPositionComponent>(entity)->x;
+        }
+
+        return sum;
+    };
+
+    BENCHMARK("Try get missing component") {
+        std::size_t found = 0;
+
+        for (const auto entity: entities) {
+            found += entityManager->tryGetComponent<BenchVelocityComponent>(entity).has_value() ? 1 : 0;
+        }
+
+        return found;
+    };
+
+    BENCHMARK("Query by component") {
+        float sum = 0;
+
+        for (const auto &entry: entityManager->query().component<BenchVelocityComponent>().collect()) {
+            sum += std::dynamic_pointer_cast<BenchVelocityComponent>(entry.component)->x;
+        }
+
+        return sum;
+    };
+
+    resources.resolveOne<EntityManagerImpl>()->destroy();
+}
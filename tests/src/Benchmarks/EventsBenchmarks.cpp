@@ -0,0 +1,50 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+
+#include <Penrose/Events/EventQueue.hpp>
+
+using namespace Penrose;
+
+struct BenchTickEvent {
+    std::uint32_t tick = 0;
+};
+
+struct BenchResizeEvent {
+    std::uint32_t width = 0;
+    std::uint32_t height = 0;
+};
+
+using BenchEventQueue = EventQueue<BenchTickEvent, BenchResizeEvent>;
+
+TEST_CASE("Events / EventQueue benchmark", "[engine-benchmark][Events][EventQueue]") {
+    constexpr std::uint32_t count = 1024;
+
+    auto queue = BenchEventQueue();
+    std::uint64_t ticks = 0;
+
+    queue.addHandler<BenchTickEvent>([&ticks](const BenchTickEvent *event) { ticks += event->tick; });
+    queue.addHandler<BenchResizeEvent>([&ticks](const BenchResizeEvent *event) { ticks += event->width; });
+
+    BENCHMARK("Push 1024 events") {
+        for (std::uint32_t idx = 0; idx < count; idx++) {
+            queue.push(BenchTickEvent {.tick = idx});
+        }
+
+        // queue is double buffered, so events are dropped by two dispatches without handling cost of interest
+        queue.update(0);
+        queue.update(0);
+    };
+
+    BENCHMARK("Push and dispatch 1024 events") {
+        for (std::uint32_t idx = 0; idx < count; idx++) {
+            queue.push(BenchTickEvent {.tick = idx});
+        }
+
+        queue.update(0);
+
+        return ticks;
+    };
+
+    queue.destroy();
+}
@@ -0,0 +1,69 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <utility>
+
+#include <Penrose/Resources/Resource.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+
+using namespace Penrose;
+
+class BenchInterface {
+public:
+    virtual ~BenchInterface() = default;
+
+    [[nodiscard]] virtual std::size_t getIdx() const = 0;
+};
+
+template <std::size_t Idx>
+class BenchResource final: public Resource<BenchResource<Idx>>,
+                           public BenchInterface {
+public:
+    ~BenchResource() override = default;
+
+    [[nodiscard]] std::size_t getIdx() const override { return Idx; }
+};
+
+template <std::size_t... Idx>
+static void addBenchResources(ResourceSet &resources, std::index_sequence<Idx...>) {
+    (resources.add<BenchResource<Idx>>().group(ResourceGroup::Custom).template implements<BenchInterface>().done(),
+     ...);
+}
+
+TEST_CASE("Resources / ResourceSet benchmark", "[engine-benchmark][Resources][ResourceSet]") {
+    constexpr std::size_t count = 64;
+
+    // count of resources is close to count registered by engine
+    auto resources = ResourceSet();
+    addBenchResources(resources, std::make_index_sequence<count>());
+
+    BENCHMARK("Resolve one by concrete type") {
+        return resources.resolveOne<BenchResource<count / 2>>()->getIdx();
+    };
+
+    BENCHMARK("Resolve one by interface") {
+        return resources.resolveOne<BenchInterface>()->getIdx();
+    };
+
+    BENCHMARK("Resolve all by interface") {
+        return resources.tryResolveAll<BenchInterface>().size();
+    };
+
+    BENCHMARK("Resolve proxy on first use") {
+        return resources.get<BenchResource<count - 1>>()->getIdx();
+    };
+
+    // resolved proxy is iterated every frame, like proxies of Updatable in engine loop
+    auto proxy = resources.get<BenchInterface>();
+    std::ignore = proxy.isPresent();
+
+    BENCHMARK("Iterate resolved proxy") {
+        std::size_t sum = 0;
+
+        for (const auto instance: proxy) {
+            sum += instance->getIdx();
+        }
+
+        return sum;
+    };
+}
@@ -0,0 +1,84 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <Penrose/UI/ValuePath.hpp>
+
+using namespace Penrose;
+
+// object of inspector-like shape: every level has many leaf properties and one nested object
+static std::shared_ptr<ObjectValue> makeObject(const std::size_t depth, const std::size_t width) {
+    auto object = std::make_shared<ObjectValue>();
+
+    for (std::size_t idx = 0; idx < width; idx++) {
+        std::ignore = object->property<IntegerValue>(fmt::format("field{}", idx), static_cast<int>(idx));
+    }
+
+    if (depth > 0) {
+        std::ignore = object->property("child", makeObject(depth - 1, width));
+    }
+
+    return object;
+}
+
+TEST_CASE("UI / ValuePath benchmark", "[engine-benchmark][UI][ValuePath]") {
+    constexpr std::size_t depth = 4;
+    constexpr std::size_t width = 64;
+    constexpr std::size_t bindingCount = 1000;
+
+    const auto root = makeObject(depth, width);
+
+    auto paths = std::vector<std::string>();
+    for (std::size_t idx = 0; idx < bindingCount; idx++) {
+        auto path = std::string();
+
+        for (std::size_t level = 0; level < idx % (depth + 1); level++) {
+            path += "child.";
+        }
+
+        paths.push_back(path + fmt::format("field{}", idx % width));
+    }
+
+    auto compiledPaths = std::vector<ValuePath>();
+    for (const auto &path: paths) {
+        compiledPaths.emplace_back(path);
+    }
+
+    // every benchmark resolves 1000 bindings, so bindings per second are 1000 / mean time
+    BENCHMARK("Resolve 1000 bindings by string path") {
+        std::size_t count = 0;
+
+        for (const auto &path: paths) {
+            count += root->getPropertyByPath(path) != nullptr;
+        }
+
+        return count;
+    };
+
+    BENCHMARK("Resolve 1000 bindings by compiled path") {
+        std::size_t count = 0;
+
+        for (const auto &path: compiledPaths) {
+            count += path.resolve(root.get()) != nullptr;
+        }
+
+        return count;
+    };
+
+    BENCHMARK("Resolve 1000 bindings by compiled path after structural change") {
+        std::ignore = root->property<IntegerValue>("field0", 0);
+
+        std::size_t count = 0;
+
+        for (const auto &path: compiledPaths) {
+            count += path.resolve(root.get()) != nullptr;
+        }
+
+        return count;
+    };
+}
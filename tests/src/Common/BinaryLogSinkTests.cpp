@@ -0,0 +1,193 @@
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Penrose/Common/BinaryLogSink.hpp>
+#include <Penrose/Common/EngineError.hpp>
+
+using namespace Penrose;
+
+namespace {
+
+    struct ReadEntry {
+        LogLevel level;
+        std::string tag;
+        std::string msg;
+    };
+
+    std::vector<ReadEntry> readFile(const std::filesystem::path &path) {
+        auto stream = std::ifstream(path, std::ios::binary);
+        auto entries = std::vector<ReadEntry>();
+
+        readBinaryLog(stream, [&entries](const BinaryLogEntry &entry) {
+            entries.push_back(ReadEntry {
+                .level = entry.level,
+                .tag = std::string(entry.tag),
+                .msg = std::string(entry.msg),
+            });
+        });
+
+        return entries;
+    }
+}
+
+TEST_CASE("Common / BinaryLogSink", "[engine-unit-test][Common][BinaryLogSink]") {
+    const auto directory = std::filesystem::temp_directory_path() / "penrose-binary-log-sink-tests";
+
+    std::filesystem::remove_all(directory);
+
+    SECTION("Written records are read back") {
+        {
+            auto sink = BinaryLogSink();
+            sink.setInfo(BinaryLogSinkInfo {.enabled = true, .directory = directory, .prefix = "test"});
+
+            const auto time = std::chrono::system_clock::now();
+
+            sink.write(LogRecord {LogLevel::Info, time, std::this_thread::get_id(), "Engine", "Started"});
+            sink.write(LogRecord {LogLevel::Warning, time, std::this_thread::get_id(), "Assets", "Missing asset"});
+            sink.write(LogRecord {LogLevel::Error, time, std::this_thread::get_id(), "Engine", "Stopped"});
+            sink.flush();
+        }
+
+        const auto entries = readFile(directory / "test-000001.plog");
+
+        REQUIRE(entries.size() == 3);
+        REQUIRE(entries.at(0).level == LogLevel::Info);
+        REQUIRE(entries.at(0).tag == "Engine");
+        REQUIRE(entries.at(0).msg == "Started");
+        REQUIRE(entries.at(1).level == LogLevel::Warning);
+        REQUIRE(entries.at(1).tag == "Assets");
+        REQUIRE(entries.at(1).msg == "Missing asset");
+        REQUIRE(entries.at(2).tag == "Engine");
+        REQUIRE(entries.at(2).msg == "Stopped");
+    }
+
+    SECTION("Files are rotated and oldest files are removed") {
+        {
+            auto sink = BinaryLogSink();
+            sink.setInfo(BinaryLogSinkInfo {
+                .enabled = true,
+                .directory = directory,
+                .prefix = "test",
+                .maxFileSize = 256,
+                .maxFileCount = 3,
+            });
+
+            for (int idx = 0; idx < 100; idx++) {
+                sink.write(LogRecord {
+                    LogLevel::Debug, std::chrono::system_clock::now(), std::this_thread::get_id(), "Test",
+                    "Message " + std::to_string(idx)
+                });
+            }
+
+            sink.flush();
+        }
+
+        auto files = std::vector<std::filesystem::path>();
+
+        for (const auto &entry: std::filesystem::directory_iterator(directory)) {
+            files.push_back(entry.path());
+        }
+
+        std::ranges::sort(files);
+
+        REQUIRE(files.size() == 3);
+
+        // every file defines its own tags, so it is decoded without previous files
+        for (const auto &file: files) {
+            REQUIRE(std::filesystem::file_size(file) <= 256 + 64);
+
+            const auto entries = readFile(file);
+
+            REQUIRE_FALSE(entries.empty());
+            REQUIRE(entries.front().tag == "Test");
+        }
+
+        REQUIRE(readFile(files.back()).back().msg == "Message 99");
+    }
+
+    SECTION("Truncated record is skipped") {
+        {
+            auto sink = BinaryLogSink();
+            sink.setInfo(BinaryLogSinkInfo {.enabled = true, .directory = directory, .prefix = "test"});
+
+            sink.write(LogRecord {LogLevel::Info, std::chrono::system_clock::now(), {}, "Test", "Complete"});
+            sink.write(LogRecord {LogLevel::Info, std::chrono::system_clock::now(), {}, "Test", "Truncated"});
+            sink.flush();
+        }
+
+        const auto path = directory / "test-000001.plog";
+        std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+
+        const auto entries = readFile(path);
+
+        REQUIRE(entries.size() == 1);
+        REQUIRE(entries.front().msg == "Complete");
+    }
+
+    SECTION("Record of corrupted size is rejected") {
+        auto stream = std::stringstream();
+
+        // header of version 1 followed by prefix of message record of 4 GiB
+        stream.write("PNRSLOG1\x01\x00\x00\x00\x00\x00\x00\x00", 16);
+        stream.write("\xF0\xFF\xFF\xFF\x01", 5);
+
+        REQUIRE_THROWS_AS(readBinaryLog(stream, [](const BinaryLogEntry &) {}), EngineError);
+    }
+
+    SECTION("Disabled sink does not write files") {
+        {
+            auto sink = BinaryLogSink();
+            sink.setInfo(BinaryLogSinkInfo {.directory = directory, .prefix = "test"});
+
+            sink.write(LogRecord {LogLevel::Info, std::chrono::system_clock::now(), {}, "Test", "Dropped"});
+            sink.flush();
+        }
+
+        REQUIRE_FALSE(std::filesystem::exists(directory));
+    }
+
+    SECTION("Failed file is not opened again until definition is changed") {
+        {
+            // regular file in place of directory makes file open fail
+            std::ofstream(directory).put('\0');
+
+            auto sink = BinaryLogSink();
+            sink.setInfo(BinaryLogSinkInfo {.enabled = true, .directory = directory, .prefix = "test"});
+
+            sink.write(LogRecord {LogLevel::Info, std::chrono::system_clock::now(), {}, "Test", "Dropped"});
+
+            std::filesystem::remove(directory);
+            std::filesystem::create_directories(directory);
+
+            sink.write(LogRecord {LogLevel::Info, std::chrono::system_clock::now(), {}, "Test", "Dropped"});
+            sink.flush();
+
+            REQUIRE(std::filesystem::is_empty(directory));
+
+            sink.setInfo(BinaryLogSinkInfo {.enabled = true, .directory = directory, .prefix = "test"});
+
+            sink.write(LogRecord {LogLevel::Info, std::chrono::system_clock::now(), {}, "Test", "Written"});
+            sink.flush();
+        }
+
+        const auto entries = readFile(directory / "test-000001.plog");
+
+        REQUIRE(entries.size() == 1);
+        REQUIRE(entries.at(0).msg == "Written");
+    }
+
+    SECTION("Stream without header is rejected") {
+        auto stream = std::istringstream("not a binary log");
+
+        REQUIRE_THROWS_AS(readBinaryLog(stream, [](const BinaryLogEntry &) {}), EngineError);
+    }
+
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,68 @@
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+#include <vector>
+
+#include "../src/Common/BoundedQueue.hpp"
+
+using namespace Penrose;
+
+TEST_CASE("Common / BoundedQueue", "[engine-unit-test][Common][BoundedQueue]") {
+    auto queue = BoundedQueue<int, 4>();
+
+    SECTION("Values are popped in order of push") {
+        for (int value = 0; value < 4; value++) {
+            REQUIRE(queue.tryPush([value](int &cell) { cell = value; }));
+        }
+
+        REQUIRE_FALSE(queue.tryPush([](int &cell) { cell = 42; }));
+        REQUIRE(queue.size() == 4);
+
+        for (int expected = 0; expected < 4; expected++) {
+            int value = -1;
+
+            REQUIRE(queue.tryPop([&value](const int &cell) { value = cell; }));
+            REQUIRE(value == expected);
+        }
+
+        REQUIRE_FALSE(queue.tryPop([](const int &) {}));
+        REQUIRE(queue.pushCount() == 4);
+        REQUIRE(queue.popCount() == 4);
+    }
+
+    SECTION("Values of multiple producers are not lost") {
+        constexpr int PRODUCER_COUNT = 4;
+        constexpr int VALUE_COUNT = 10000;
+
+        auto producers = std::vector<std::thread>();
+
+        for (int producerIdx = 0; producerIdx < PRODUCER_COUNT; producerIdx++) {
+            producers.emplace_back([&queue] {
+                for (int value = 1; value <= VALUE_COUNT; value++) {
+                    while (!queue.tryPush([value](int &cell) { cell = value; })) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        long long sum = 0;
+        int count = 0;
+
+        while (count < PRODUCER_COUNT * VALUE_COUNT) {
+            if (!queue.tryPop([&sum](const int &cell) { sum += cell; })) {
+                std::this_thread::yield();
+
+                continue;
+            }
+
+            count++;
+        }
+
+        for (auto &producer: producers) {
+            producer.join();
+        }
+
+        REQUIRE(sum == static_cast<long long>(PRODUCER_COUNT) * VALUE_COUNT * (VALUE_COUNT + 1) / 2);
+    }
+}
@@ -0,0 +1,189 @@
+#include <catch2/catch_all.hpp>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <Penrose/Common/LogSink.hpp>
+#include <Penrose/Resources/Resource.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+
+#include "../src/Common/LogImpl.hpp"
+
+using namespace Penrose;
+
+namespace {
+
+    // sink records every call, writer thread could be held in first write until sink is released
+    class CapturingSink final: public Resource<CapturingSink>,
+                               public LogSink {
+    public:
+        void write(const LogRecord &record) override {
+            auto lock = std::unique_lock(this->_mutex);
+
+            this->_events.push_back(fmt::format("{}: {}", record.tag, record.msg));
+            this->_entered = true;
+            this->_condition.notify_all();
+
+            this->_condition.wait(lock, [this] { return !this->_held; });
+        }
+
+        void flush() override {
+            auto lock = std::lock_guard(this->_mutex);
+
+            this->_events.emplace_back("flush");
+        }
+
+        void hold() {
+            auto lock = std::lock_guard(this->_mutex);
+
+            this->_held = true;
+            this->_entered = false;
+        }
+
+        void waitUntilEntered() {
+            auto lock = std::unique_lock(this->_mutex);
+
+            this->_condition.wait(lock, [this] { return this->_entered; });
+        }
+
+        void release() {
+            {
+                auto lock = std::lock_guard(this->_mutex);
+
+                this->_held = false;
+            }
+
+            this->_condition.notify_all();
+        }
+
+        [[nodiscard]] std::vector<std::string> getEvents() {
+            auto lock = std::lock_guard(this->_mutex);
+
+            return this->_events;
+        }
+
+    private:
+        std::vector<std::string> _events;
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        bool _held = false;
+        bool _entered = false;
+    };
+
+    [[nodiscard]] std::vector<std::string> getMessages(const std::vector<std::string> &events) {
+        auto messages = std::vector<std::string>();
+
+        for (const auto &event: events) {
+            if (event != "flush") {
+                messages.push_back(event);
+            }
+        }
+
+        return messages;
+    }
+}
+
+TEST_CASE("Common / LogImpl", "[engine-unit-test][Common][LogImpl]") {
+    auto resources = ResourceSet();
+
+    const auto sink = resources.add<CapturingSink>().implements<LogSink>().done();
+
+    auto log = std::make_unique<LogImpl>(&resources);
+    log->addSink(typeid(CapturingSink));
+
+    SECTION("Messages of every thread reach sink in order of their thread") {
+        constexpr int THREAD_COUNT = 4;
+        constexpr int MESSAGE_COUNT = 500;
+
+        auto threads = std::vector<std::thread>();
+
+        for (int threadIdx = 0; threadIdx < THREAD_COUNT; threadIdx++) {
+            threads.emplace_back([&log, threadIdx] {
+                for (int messageIdx = 0; messageIdx < MESSAGE_COUNT; messageIdx++) {
+                    log->write(LogLevel::Info, fmt::format("T{}", threadIdx), fmt::format("{}", messageIdx));
+                }
+            });
+        }
+
+        for (auto &thread: threads) {
+            thread.join();
+        }
+
+        log->flush();
+
+        const auto messages = getMessages(sink->getEvents());
+
+        REQUIRE(messages.size() == THREAD_COUNT * MESSAGE_COUNT);
+        REQUIRE(log->getStats().written == THREAD_COUNT * MESSAGE_COUNT);
+
+        for (int threadIdx = 0; threadIdx < THREAD_COUNT; threadIdx++) {
+            const auto prefix = fmt::format("T{}: ", threadIdx);
+            int expected = 0;
+
+            for (const auto &message: messages) {
+                if (message.starts_with(prefix)) {
+                    REQUIRE(message == fmt::format("{}{}", prefix, expected++));
+                }
+            }
+
+            REQUIRE(expected == MESSAGE_COUNT);
+        }
+    }
+
+    SECTION("Flush returns after messages are written and sink is flushed") {
+        log->write(LogLevel::Info, "Test", "First");
+        log->write(LogLevel::Info, "Test", "Second");
+        log->flush();
+
+        const auto events = sink->getEvents();
+
+        REQUIRE(getMessages(events) == std::vector<std::string> {"Test: First", "Test: Second"});
+        REQUIRE(events.back() == "flush");
+        REQUIRE(log->getStats().written == 2);
+    }
+
+    SECTION("Pending messages are written on destruction") {
+        for (int messageIdx = 0; messageIdx < 100; messageIdx++) {
+            log->write(LogLevel::Info, "Test", fmt::format("{}", messageIdx));
+        }
+
+        log.reset();
+
+        const auto messages = getMessages(sink->getEvents());
+
+        REQUIRE(messages.size() == 100);
+        REQUIRE(messages.back() == "Test: 99");
+    }
+
+    SECTION("Messages are dropped when queue is full") {
+        constexpr auto OVERFLOW_COUNT = static_cast<int>(LogImpl::QUEUE_CAPACITY) + 16;
+
+        // errors wake up writer, which is held in sink until queue is overflowed
+        sink->hold();
+        log->write(LogLevel::Error, "Test", "Held");
+        sink->waitUntilEntered();
+
+        for (int messageIdx = 0; messageIdx < OVERFLOW_COUNT; messageIdx++) {
+            log->write(LogLevel::Info, "Test", fmt::format("{}", messageIdx));
+        }
+
+        const auto dropped = log->getStats().dropped;
+
+        REQUIRE(dropped >= 16);
+
+        sink->release();
+        log->flush();
+
+        const auto messages = getMessages(sink->getEvents());
+
+        REQUIRE(log->getStats().written == 1 + OVERFLOW_COUNT - dropped);
+        REQUIRE(messages.back() == fmt::format("LogImpl: {} message(s) were dropped, log queue is full", dropped));
+    }
+}
@@ -0,0 +1,68 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../src/Common/PngEncoder.hpp"
+
+using namespace Penrose;
+
+namespace {
+
+    std::uint32_t readU32BE(const std::vector<std::byte> &data, const std::size_t offset) {
+        return (static_cast<std::uint32_t>(data.at(offset)) << 24)
+               | (static_cast<std::uint32_t>(data.at(offset + 1)) << 16)
+               | (static_cast<std::uint32_t>(data.at(offset + 2)) << 8)
+               | static_cast<std::uint32_t>(data.at(offset + 3));
+    }
+}
+
+TEST_CASE("Common / PngEncoder", "[Common][PngEncoder]") {
+
+    constexpr std::uint32_t width = 3;
+    constexpr std::uint32_t height = 2;
+
+    std::vector<std::byte> pixels;
+    for (std::uint32_t idx = 0; idx < width * height * 4; idx++) {
+        pixels.push_back(static_cast<std::byte>(idx));
+    }
+
+    const auto png = encodePng(width, height, pixels);
+
+    // signature
+    REQUIRE(png.size() > 8);
+    REQUIRE(png.at(0) == std::byte {0x89});
+    REQUIRE(png.at(1) == std::byte {'P'});
+    REQUIRE(png.at(2) == std::byte {'N'});
+    REQUIRE(png.at(3) == std::byte {'G'});
+
+    // IHDR
+    REQUIRE(readU32BE(png, 8) == 13);
+    REQUIRE(readU32BE(png, 12) == 0x49484452);
+    REQUIRE(readU32BE(png, 16) == width);
+    REQUIRE(readU32BE(png, 20) == height);
+    REQUIRE(png.at(24) == std::byte {8});
+    REQUIRE(png.at(25) == std::byte {6});
+
+    // IDAT: zlib header, single stored block with filtered scanlines, adler32
+    const auto idatLength = readU32BE(png, 33);
+    REQUIRE(readU32BE(png, 37) == 0x49444154);
+
+    constexpr auto scanlinesSize = (width * 4 + 1) * height;
+    REQUIRE(idatLength == 2 + 5 + scanlinesSize + 4);
+    REQUIRE(png.at(41) == std::byte {0x78});
+    REQUIRE(png.at(43) == std::byte {1});
+    REQUIRE(static_cast<std::uint32_t>(png.at(44)) == scanlinesSize);
+
+    REQUIRE(png.at(48) == std::byte {0});
+    REQUIRE(png.at(49) == pixels.at(0));
+    REQUIRE(png.at(48 + width * 4 + 1) == std::byte {0});
+    REQUIRE(png.at(48 + width * 4 + 2) == pixels.at(width * 4));
+
+    // IEND with its well-known CRC
+    REQUIRE(readU32BE(png, png.size() - 8) == 0x49454E44);
+    REQUIRE(readU32BE(png, png.size() - 4) == 0xAE426082);
+
+    REQUIRE_THROWS(encodePng(width, height + 1, pixels));
+}
@@ -0,0 +1,57 @@
+#include <catch2/catch_all.hpp>
+
+#include <array>
+#include <atomic>
+#include <thread>
+
+#include "../src/Common/SeqDoubleBuffer.hpp"
+
+using namespace Penrose;
+
+TEST_CASE("Common / SeqDoubleBuffer", "[engine-unit-test][Common][SeqDoubleBuffer]") {
+    using Values = std::array<int, 16>;
+
+    auto buffer = SeqDoubleBuffer<Values>();
+
+    SECTION("Written value is published as front one") {
+        buffer.writeAll([](Values &values) { values.fill(1); });
+
+        REQUIRE(buffer.read([](const Values &values) { return values.at(0); }) == 1);
+
+        buffer.write([](Values &values) { values.fill(2); });
+
+        REQUIRE(buffer.getFront().at(15) == 2);
+        REQUIRE(buffer.read([](const Values &values) { return values.at(15); }) == 2);
+    }
+
+    SECTION("Readers never observe partially written value") {
+        constexpr int WRITE_COUNT = 20000;
+
+        auto torn = std::atomic_int(0);
+        auto finished = std::atomic_bool(false);
+
+        auto reader = std::thread([&buffer, &torn, &finished] {
+            while (!finished.load()) {
+                const auto values = buffer.read([](const Values &values) { return values; });
+
+                for (const auto value: values) {
+                    if (value != values.at(0)) {
+                        torn++;
+
+                        break;
+                    }
+                }
+            }
+        });
+
+        for (int value = 1; value <= WRITE_COUNT; value++) {
+            buffer.write([value](Values &values) { values.fill(value); });
+        }
+
+        finished.store(true);
+        reader.join();
+
+        REQUIRE(torn == 0);
+        REQUIRE(buffer.getFront().at(0) == WRITE_COUNT);
+    }
+}
@@ -0,0 +1,96 @@
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <Penrose/Common/EngineError.hpp>
+#include <Penrose/ECS/Component.hpp>
+#include <Penrose/Events/ECSEvents.hpp>
+#include <Penrose/Performance/MetricsRegistry.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+
+#include "../src/Common/LogImpl.hpp"
+#include "../src/ECS/EntityManagerImpl.hpp"
+
+using namespace Penrose;
+
+namespace {
+
+    struct PositionComponent final: Component<PositionComponent> {
+        ~PositionComponent() override = default;
+
+        float x = 0;
+    };
+
+    struct VelocityComponent final: Component<VelocityComponent> {
+        ~VelocityComponent() override = default;
+
+        float x = 0;
+    };
+
+    struct HealthComponent final: Component<HealthComponent> {
+        ~HealthComponent() override = default;
+
+        int value = 0;
+    };
+}
+
+TEST_CASE("ECS / EntityManagerImpl", "[engine-unit-test][ECS][EntityManagerImpl]") {
+    auto resources = ResourceSet();
+
+    resources.add<LogImpl>().implements<Log>().done();
+    resources.add<MetricsRegistry>().done();
+    resources.add<ECSEventQueue>().done();
+
+    EntityManager *entityManager = resources.add<EntityManagerImpl>().implements<EntityManager>().done();
+
+    SECTION("Component is got without taking entity manager lock twice") {
+        const auto entity = entityManager->createEntity();
+
+        auto position = std::make_shared<PositionComponent>();
+        position->x = 4;
+
+        entityManager->addComponent(entity, std::move(position));
+
+        REQUIRE(entityManager->getComponent<PositionComponent>(entity)->x == 4);
+        REQUIRE_THROWS_AS(entityManager->getComponent<VelocityComponent>(entity), EngineError);
+    }
+
+    SECTION("Query iterates every component of every entity") {
+        const auto first = entityManager->createEntity();
+        const auto empty = entityManager->createEntity();
+        const auto second = entityManager->createEntity();
+        const auto third = entityManager->createEntity();
+
+        entityManager->addComponent<PositionComponent>(first);
+        entityManager->addComponent<VelocityComponent>(first);
+        entityManager->addComponent<HealthComponent>(first);
+        entityManager->addComponent<PositionComponent>(second);
+        entityManager->addComponent<PositionComponent>(third);
+        entityManager->addComponent<HealthComponent>(third);
+
+        auto visited = std::vector<std::pair<Entity, ComponentType>>();
+
+        for (const auto &entry: entityManager->query().collect()) {
+            visited.emplace_back(entry.entity, entry.componentType);
+        }
+
+        REQUIRE(visited.size() == 6);
+        REQUIRE(std::ranges::count(visited, first, &std::pair<Entity, ComponentType>::first) == 3);
+        REQUIRE(std::ranges::count(visited, empty, &std::pair<Entity, ComponentType>::first) == 0);
+        REQUIRE(std::ranges::count(visited, second, &std::pair<Entity, ComponentType>::first) == 1);
+        REQUIRE(std::ranges::count(visited, third, &std::pair<Entity, ComponentType>::first) == 2);
+
+        auto healthy = std::vector<Entity>();
+
+        for (const auto &entry: entityManager->query().component<HealthComponent>().collect()) {
+            healthy.push_back(entry.entity);
+        }
+
+        REQUIRE(healthy == std::vector<Entity> {first, third});
+    }
+
+    resources.resolveOne<EntityManagerImpl>()->destroy();
+}
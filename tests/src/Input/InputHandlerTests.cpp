@@ -0,0 +1,137 @@
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <Penrose/Events/InputEvents.hpp>
+#include <Penrose/Input/InputHandler.hpp>
+#include <Penrose/Performance/MetricsRegistry.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+
+using namespace Penrose;
+
+TEST_CASE("Input / InputHandler", "[engine-unit-test][Input][InputHandler]") {
+    auto resources = ResourceSet();
+
+    resources.add<MetricsRegistry>().done();
+    resources.add<InputEventQueue>().done();
+    const auto inputHandler = resources.add<InputHandler>().done();
+
+    SECTION("Input is published at the end of frame") {
+        inputHandler->pushKeyStateUpdate(InputKey::A, InputState::Pressed, InputClock::now());
+        inputHandler->pushMouseMove(0.5f, 0.25f, InputClock::now());
+
+        REQUIRE(inputHandler->getCurrentStateOf(InputKey::A) == InputState::Released);
+
+        inputHandler->endFrame();
+
+        const auto snapshot = inputHandler->getSnapshot();
+
+        REQUIRE(snapshot.frame == 0);
+        REQUIRE(snapshot.isDown(InputKey::A));
+        REQUIRE(snapshot.wasPressed(InputKey::A));
+        REQUIRE_FALSE(snapshot.wasReleased(InputKey::A));
+        REQUIRE(inputHandler->getCurrentStateOf(InputKey::A) == InputState::Pressed);
+        REQUIRE(std::get<0>(inputHandler->getCurrentMousePosition()) == 0.5f);
+    }
+
+    SECTION("Transitions and deltas are accumulated per frame") {
+        inputHandler->pushKeyStateUpdate(InputKey::Space, InputState::Pressed, InputClock::now());
+        inputHandler->pushKeyStateUpdate(InputKey::Space, InputState::Released, InputClock::now());
+        inputHandler->pushMouseMove(0.25f, 0.0f, InputClock::now());
+        inputHandler->pushMouseMove(0.5f, 0.0f, InputClock::now());
+        inputHandler->pushScroll(0.0f, 1.0f, InputClock::now());
+        inputHandler->pushScroll(0.0f, 2.0f, InputClock::now());
+        inputHandler->endFrame();
+
+        auto snapshot = inputHandler->getSnapshot();
+
+        REQUIRE_FALSE(snapshot.isDown(InputKey::Space));
+        REQUIRE(snapshot.wasPressed(InputKey::Space));
+        REQUIRE(snapshot.wasReleased(InputKey::Space));
+        REQUIRE(std::get<0>(snapshot.mouseMovement) == 0.5f);
+        REQUIRE(std::get<1>(snapshot.mouseScroll) == 3.0f);
+
+        inputHandler->endFrame();
+
+        snapshot = inputHandler->getSnapshot();
+
+        REQUIRE(snapshot.frame == 1);
+        REQUIRE_FALSE(snapshot.wasPressed(InputKey::Space));
+        REQUIRE_FALSE(snapshot.wasReleased(InputKey::Space));
+        REQUIRE(std::get<0>(snapshot.mouseMovement) == 0.0f);
+        REQUIRE(std::get<0>(snapshot.mousePosition) == 0.5f);
+    }
+
+    SECTION("Mouse events are coalesced within frame") {
+        auto movements = std::vector<MouseMovementEvent>();
+        auto rawMovements = std::size_t(0);
+
+        const auto rawEventQueue = resources.add<RawInputEventQueue>().done();
+
+        resources.get<InputEventQueue>()->addHandler<MouseMovementEvent>([&](const MouseMovementEvent *event) {
+            movements.push_back(*event);
+        });
+        rawEventQueue->addHandler<MouseMovementEvent>([&](const MouseMovementEvent *) { rawMovements++; });
+
+        const auto start = InputClock::now();
+
+        inputHandler->pushMouseMove(0.25f, 0.0f, start);
+        inputHandler->pushMouseMove(0.5f, 0.0f, start + std::chrono::milliseconds(1));
+        inputHandler->pushKeyStateUpdate(InputKey::MB1, InputState::Pressed, start + std::chrono::milliseconds(2));
+        inputHandler->pushMouseMove(0.75f, 0.0f, start + std::chrono::milliseconds(3));
+        inputHandler->pushMouseMove(1.0f, 0.0f, start + std::chrono::milliseconds(4));
+        inputHandler->endFrame();
+
+        resources.get<InputEventQueue>()->update(0);
+        rawEventQueue->update(0);
+
+        REQUIRE(rawMovements == 4);
+        REQUIRE(movements.size() == 2);
+        REQUIRE(movements.at(0).samples == 2);
+        REQUIRE(std::get<0>(movements.at(0).movement) == 0.5f);
+        REQUIRE(movements.at(1).samples == 2);
+        REQUIRE(std::get<0>(movements.at(1).position) == 1.0f);
+        REQUIRE(movements.at(1).timestamp == start + std::chrono::milliseconds(4));
+
+        auto metrics = resources.get<MetricsRegistry>();
+
+        REQUIRE(metrics->gauge("input.frame_samples")->get() == 5);
+        REQUIRE(metrics->gauge("input.frame_events")->get() == 3);
+    }
+
+    SECTION("Snapshots are consistent while frames are published") {
+        constexpr std::uint64_t FRAME_COUNT = 10000;
+
+        auto done = std::atomic_bool(false);
+        auto inconsistent = std::atomic_bool(false);
+
+        // every frame holds either both keys or none, so torn snapshot is observable
+        auto reader = std::thread([&]() {
+            while (!done.load()) {
+                const auto snapshot = inputHandler->getSnapshot();
+
+                if (snapshot.isDown(InputKey::A) != snapshot.isDown(InputKey::MB7)) {
+                    inconsistent.store(true);
+                }
+            }
+        });
+
+        for (std::uint64_t frameIdx = 0; frameIdx < FRAME_COUNT; frameIdx++) {
+            const auto state = frameIdx % 2 == 0 ? InputState::Pressed : InputState::Released;
+
+            inputHandler->pushKeyStateUpdate(InputKey::A, state, InputClock::now());
+            inputHandler->pushKeyStateUpdate(InputKey::MB7, state, InputClock::now());
+            inputHandler->endFrame();
+        }
+
+        done.store(true);
+        reader.join();
+
+        REQUIRE_FALSE(inconsistent.load());
+        REQUIRE(inputHandler->getSnapshot().frame == FRAME_COUNT - 1);
+    }
+}
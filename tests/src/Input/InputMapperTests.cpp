@@ -0,0 +1,138 @@
+#include <catch2/catch_all.hpp>
+
+#include <sstream>
+
+#include <Penrose/Common/EngineError.hpp>
+#include <Penrose/Events/InputEvents.hpp>
+#include <Penrose/Input/InputHandler.hpp>
+#include <Penrose/Input/InputMapper.hpp>
+#include <Penrose/Performance/MetricsRegistry.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+
+using namespace Penrose;
+
+TEST_CASE("Input / InputMapper", "[engine-unit-test][Input][InputMapper]") {
+    auto resources = ResourceSet();
+
+    resources.add<MetricsRegistry>().done();
+    resources.add<InputEventQueue>().done();
+    const auto inputHandler = resources.add<InputHandler>().done();
+    const auto inputMapper = resources.add<InputMapper>().done();
+
+    auto stream = std::istringstream(R"({
+        "actions": {"jump": ["Space", "MB1"]},
+        "axes": {"moveX": {"D": 1.0, "A": -1.0, "Right": 1.0}}
+    })");
+
+    const auto frame = [&]() {
+        inputHandler->endFrame();
+        inputMapper->endFrame();
+    };
+
+    inputMapper->load(stream);
+
+    // input map is applied by next frame
+    REQUIRE(inputMapper->tryGetActionId("jump") == NO_INPUT_ACTION);
+
+    frame();
+
+    const auto jump = inputMapper->getActionId("jump");
+    const auto moveX = inputMapper->getActionId("moveX");
+
+    REQUIRE(inputMapper->getActionCount() == 2);
+    REQUIRE(inputMapper->tryGetActionId("fire") == NO_INPUT_ACTION);
+
+    SECTION("Actions follow bound keys") {
+        inputHandler->pushKeyStateUpdate(InputKey::MB1, InputState::Pressed, InputClock::now());
+        frame();
+
+        REQUIRE(inputMapper->getState(jump).down);
+        REQUIRE(inputMapper->getState(jump).pressed);
+        REQUIRE(inputMapper->getState(jump).value == 1.0f);
+
+        inputHandler->pushKeyStateUpdate(InputKey::Space, InputState::Pressed, InputClock::now());
+        frame();
+
+        REQUIRE(inputMapper->getState(jump).down);
+        REQUIRE_FALSE(inputMapper->getState(jump).pressed);
+
+        inputHandler->pushKeyStateUpdate(InputKey::MB1, InputState::Released, InputClock::now());
+        inputHandler->pushKeyStateUpdate(InputKey::Space, InputState::Released, InputClock::now());
+        frame();
+
+        REQUIRE_FALSE(inputMapper->getState(jump).down);
+        REQUIRE(inputMapper->getState(jump).released);
+    }
+
+    SECTION("Tap within frame is reported as pressed and released") {
+        inputHandler->pushKeyStateUpdate(InputKey::Space, InputState::Pressed, InputClock::now());
+        inputHandler->pushKeyStateUpdate(InputKey::Space, InputState::Released, InputClock::now());
+        frame();
+
+        REQUIRE_FALSE(inputMapper->getState(jump).down);
+        REQUIRE(inputMapper->getState(jump).pressed);
+        REQUIRE(inputMapper->getState(jump).released);
+    }
+
+    SECTION("Axes sum scales of held keys") {
+        inputHandler->pushKeyStateUpdate(InputKey::A, InputState::Pressed, InputClock::now());
+        frame();
+
+        REQUIRE(inputMapper->getState(moveX).value == -1.0f);
+
+        inputHandler->pushKeyStateUpdate(InputKey::D, InputState::Pressed, InputClock::now());
+        frame();
+
+        REQUIRE(inputMapper->getState(moveX).value == 0.0f);
+        REQUIRE_FALSE(inputMapper->getState(moveX).down);
+
+        inputHandler->pushKeyStateUpdate(InputKey::A, InputState::Released, InputClock::now());
+        inputHandler->pushKeyStateUpdate(InputKey::Right, InputState::Pressed, InputClock::now());
+        frame();
+
+        REQUIRE(inputMapper->getState(moveX).value == 1.0f);
+    }
+
+    SECTION("Unknown keys are rejected") {
+        auto invalidStream = std::istringstream(R"({"actions": {"jump": ["Spacebar"]}})");
+
+        REQUIRE_THROWS_AS(inputMapper->load(invalidStream), EngineError);
+    }
+
+    SECTION("Input map is replaced between frames") {
+        inputHandler->pushKeyStateUpdate(InputKey::Space, InputState::Pressed, InputClock::now());
+        frame();
+
+        REQUIRE(inputMapper->getState(jump).down);
+
+        auto nextStream = std::istringstream(R"({"actions": {"fire": ["MB1"], "jump": ["Space"]}})");
+
+        inputMapper->load(nextStream);
+
+        // identifiers of previous input map stay valid until next frame
+        REQUIRE(inputMapper->getActionId("moveX") == moveX);
+        REQUIRE(inputMapper->getState(jump).down);
+
+        inputHandler->pushKeyStateUpdate(InputKey::MB1, InputState::Pressed, InputClock::now());
+        frame();
+
+        const auto fire = inputMapper->getActionId("fire");
+        const auto nextJump = inputMapper->getActionId("jump");
+
+        REQUIRE(inputMapper->getActionCount() == 2);
+        REQUIRE(inputMapper->tryGetActionId("moveX") == NO_INPUT_ACTION);
+
+        REQUIRE(inputMapper->getState(fire).down);
+        REQUIRE(inputMapper->getState(fire).pressed);
+        REQUIRE(inputMapper->getState(nextJump).down);
+        REQUIRE(inputMapper->getState(nextJump).pressed);
+
+        inputHandler->pushKeyStateUpdate(InputKey::MB1, InputState::Released, InputClock::now());
+        frame();
+
+        REQUIRE_FALSE(inputMapper->getState(fire).down);
+        REQUIRE(inputMapper->getState(fire).released);
+        REQUIRE(inputMapper->getState(nextJump).down);
+        REQUIRE_FALSE(inputMapper->getState(nextJump).pressed);
+    }
+}
@@ -6,9 +6,9 @@
 using namespace Penrose;
 
 TEST_CASE("EngineStartStop", "[engine-int-test]") {
-    Engine engine;
+    Engine engine(HeadlessInfo {.size = {320, 240}, .imageCount = 3, .captureDirectory = std::nullopt});
 
-    engine.resources().get<EngineEventQueue>()->push<EngineDestroyRequestedEvent>();
+    engine.resources().get<EngineEventQueue>()->push<EngineDestroyRequestEvent>();
 
     REQUIRE_NOTHROW([&]() { engine.run(); }());
 }
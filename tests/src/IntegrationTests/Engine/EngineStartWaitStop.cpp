@@ -1,20 +1,68 @@
 #include <catch2/catch_all.hpp>
 
-#include <Penrose/Engine.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 
-#include "src/ECS/TestCountdownSystem.hpp"
+#include <Penrose/Engine.hpp>
+#include <Penrose/Events/EngineEvents.hpp>
+#include <Penrose/Rendering/FrameCapture.hpp>
+#include <Penrose/Resources/Resource.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+#include <Penrose/Resources/Updatable.hpp>
 
 using namespace Penrose;
 
-TEST_CASE("EngineStartWaitStop", "[engine-int-test]") {
-    Engine engine;
+static constexpr std::uint32_t TEST_FRAME_COUNT = 10;
+static constexpr float TEST_TIMEOUT = 10.0f;
+
+// frames are captured by rendering thread, but engine is stopped from update loop, because event queue is not
+// synchronized
+class TestFrameCounter: public Resource<TestFrameCounter>,
+                        public FrameCaptureHandler,
+                        public Updatable {
+public:
+    explicit TestFrameCounter(const ResourceSet *resources)
+        : _eventQueue(resources->get<EngineEventQueue>()) {
+        //
+    }
+
+    ~TestFrameCounter() override = default;
+
+    void onFrameCaptured(const FrameCapture &capture) override {
+        if (capture.width == 320 && capture.height == 240
+            && capture.data.size() == std::size_t {4} * capture.width * capture.height) {
+            this->_captured++;
+        }
+    }
 
-    auto testCountdownSystem = engine.resources().add<TestCountdownSystem>().group(ResourceGroup::ECSSystem)
-            .implements<Initializable>()
-            .implements<System>()
-            .done();
+    void update(const float delta) override {
+        this->_passed += delta;
+
+        if (this->_captured >= TEST_FRAME_COUNT || this->_passed > TEST_TIMEOUT) {
+            this->_eventQueue->push<EngineDestroyRequestEvent>();
+        }
+    }
+
+    [[nodiscard]] std::uint32_t getCaptured() const { return this->_captured; }
+
+private:
+    ResourceProxy<EngineEventQueue> _eventQueue;
+
+    std::atomic_uint32_t _captured = 0;
+    float _passed = 0;
+};
+
+TEST_CASE("EngineStartWaitStop", "[engine-int-test]") {
+    Engine engine(HeadlessInfo {.size = {320, 240}, .imageCount = 3, .captureDirectory = std::nullopt});
 
-    testCountdownSystem->setTestTimeout(1.0f);
+    auto counter = engine.resources()
+                       .add<TestFrameCounter>()
+                       .group(ResourceGroup::Custom)
+                       .implements<FrameCaptureHandler>()
+                       .implements<Updatable>()
+                       .done();
 
     REQUIRE_NOTHROW([&]() { engine.run(); }());
+    REQUIRE(counter->getCaptured() >= TEST_FRAME_COUNT);
 }
@@ -0,0 +1,89 @@
+#include <catch2/catch_all.hpp>
+
+#include <limits>
+#include <sstream>
+
+#include <Penrose/Performance/ChromeTrace.hpp>
+
+using namespace Penrose;
+
+TEST_CASE("Performance / ChromeTrace", "[engine-unit-test][Performance][ChromeTrace]") {
+    auto profiler = Profiler();
+
+    profiler.setThreadName("Main \"Thread\"");
+
+    const auto scopeTag = profiler.intern("Scope");
+    const auto counterTag = profiler.intern("Counter");
+
+    SECTION("Capture is finished after requested count of frames") {
+        profiler.beginCapture(2);
+
+        REQUIRE(profiler.isCapturing());
+        REQUIRE_FALSE(profiler.takeCapture().has_value());
+
+        for (int frameIdx = 0; frameIdx < 3; frameIdx++) {
+            {
+                auto scope = profiler.begin(scopeTag);
+            }
+
+            profiler.recordCounter(counterTag, frameIdx);
+            profiler.endFrame();
+        }
+
+        REQUIRE_FALSE(profiler.isCapturing());
+
+        const auto capture = profiler.takeCapture();
+
+        REQUIRE(capture.has_value());
+        REQUIRE(capture->frames.size() == 3);
+        REQUIRE(capture->threads.size() == 1);
+        REQUIRE(capture->threads.at(0).name == "Main \"Thread\"");
+        REQUIRE(capture->threads.at(0).records.size() == 2);
+        REQUIRE(capture->counters.size() == 2);
+        REQUIRE(capture->tags.at(scopeTag) == "Scope");
+
+        REQUIRE_FALSE(profiler.takeCapture().has_value());
+    }
+
+    SECTION("Capture is written as trace events") {
+        profiler.beginCapture(1);
+
+        {
+            auto scope = profiler.begin(scopeTag);
+        }
+
+        profiler.recordCounter(counterTag, 42);
+        profiler.endFrame();
+
+        auto stream = std::stringstream();
+        writeChromeTrace(*profiler.takeCapture(), stream);
+
+        const auto trace = stream.str();
+
+        REQUIRE(trace.starts_with(R"({"displayTimeUnit":"ms","traceEvents":[)"));
+        REQUIRE(trace.ends_with("]}\n"));
+        REQUIRE(trace.find(R"("args":{"name":"Main \"Thread\""})") != std::string::npos);
+        REQUIRE(trace.find(R"({"name":"Scope","cat":"scope","ph":"X")") != std::string::npos);
+        REQUIRE(trace.find(R"({"name":"Counter","ph":"C")") != std::string::npos);
+        REQUIRE(trace.find(R"("args":{"value":42})") != std::string::npos);
+        REQUIRE(trace.find(R"({"name":"Frame #1","cat":"frame")") != std::string::npos);
+    }
+
+    SECTION("Non-finite counter values are written as null") {
+        profiler.beginCapture(1);
+        profiler.recordCounter(counterTag, std::numeric_limits<double>::quiet_NaN());
+        profiler.recordCounter(counterTag, std::numeric_limits<double>::infinity());
+        profiler.endFrame();
+
+        auto stream = std::stringstream();
+        writeChromeTrace(*profiler.takeCapture(), stream);
+
+        const auto trace = stream.str();
+        const auto first = trace.find(R"("args":{"value":null})");
+
+        REQUIRE(first != std::string::npos);
+        REQUIRE(trace.find(R"("args":{"value":null})", first + 1) != std::string::npos);
+        REQUIRE(trace.find("nan") == std::string::npos);
+        REQUIRE(trace.find("inf") == std::string::npos);
+    }
+}
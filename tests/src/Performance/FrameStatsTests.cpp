@@ -0,0 +1,113 @@
+#include <catch2/catch_all.hpp>
+
+#include <optional>
+
+#include <Penrose/Performance/FrameStats.hpp>
+#include <Penrose/Performance/MetricsRegistry.hpp>
+#include <Penrose/Performance/Profiler.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+
+#include "../src/Common/LogImpl.hpp"
+
+using namespace Penrose;
+
+TEST_CASE("Performance / FrameStats", "[engine-unit-test][Performance][FrameStats]") {
+    auto resources = ResourceSet();
+
+    resources.add<LogImpl>().implements<Log>().done();
+    const auto profiler = resources.add<Profiler>().done();
+    const auto metrics = resources.add<MetricsRegistry>().done();
+    const auto frameStats = resources.add<FrameStats>().done();
+
+    SECTION("Percentiles are computed per source") {
+        for (int idx = 1; idx <= 100; idx++) {
+            frameStats->record(FrameSource::Engine, 0.001f * static_cast<float>(idx));
+        }
+
+        const auto stats = frameStats->getStats(FrameSource::Engine);
+
+        REQUIRE(stats.has_value());
+        REQUIRE(stats->count == 100);
+        REQUIRE(stats->p50 == 0.001f * 50);
+        REQUIRE(stats->p95 == 0.001f * 95);
+        REQUIRE(stats->p99 == 0.001f * 99);
+        REQUIRE(stats->max == 0.001f * 100);
+
+        REQUIRE_FALSE(frameStats->getStats(FrameSource::Render).has_value());
+    }
+
+    SECTION("Captured frames are not limited by window") {
+        frameStats->record(FrameSource::Engine, 1.0f);
+        frameStats->beginCapture();
+
+        for (std::uint32_t idx = 0; idx < 2 * FrameStats::WINDOW; idx++) {
+            frameStats->record(FrameSource::Engine, idx == 0 ? 0.5f : 0.001f);
+        }
+
+        const auto captured = frameStats->takeCapture();
+        const auto &stats = captured.at(static_cast<std::size_t>(FrameSource::Engine));
+
+        REQUIRE(stats.has_value());
+        REQUIRE(stats->count == 2 * FrameStats::WINDOW);
+        REQUIRE(stats->max == 0.5f);
+        REQUIRE_FALSE(captured.at(static_cast<std::size_t>(FrameSource::Render)).has_value());
+
+        // frames recorded after capture are not captured
+        frameStats->record(FrameSource::Engine, 0.001f);
+
+        REQUIRE_FALSE(frameStats->takeCapture().at(static_cast<std::size_t>(FrameSource::Engine)).has_value());
+    }
+
+    SECTION("Hitches are resolved into profiler snapshot") {
+        frameStats->setInfo(FrameStatsInfo {
+            .hitchThreshold = 0.05f,
+            .maxHitchCount = 16,
+            .hitchDumpDirectory = std::nullopt,
+            .summaryInterval = 10,
+        });
+
+        {
+            auto scope = profiler->begin("Slow Scope");
+        }
+
+        frameStats->record(FrameSource::Render, 0.016f);
+        frameStats->record(FrameSource::Render, 0.08f);
+
+        // hitch is not resolved until scopes of hitching frame are drained
+        REQUIRE(frameStats->takeHitches().empty());
+
+        profiler->endFrame();
+        frameStats->endFrame();
+
+        const auto hitches = frameStats->takeHitches();
+
+        REQUIRE(hitches.size() == 1);
+        REQUIRE(hitches.front().source == FrameSource::Render);
+        REQUIRE(hitches.front().duration == 0.08f);
+        REQUIRE(hitches.front().capture.threads.at(0).records.size() == 1);
+        REQUIRE(metrics->counter("frame.render.hitches")->get() == 1);
+        REQUIRE(frameStats->takeHitches().empty());
+    }
+
+    SECTION("Only most recent hitches are kept") {
+        frameStats->setInfo(FrameStatsInfo {
+            .hitchThreshold = 0.05f,
+            .maxHitchCount = 2,
+            .hitchDumpDirectory = std::nullopt,
+            .summaryInterval = 10,
+        });
+
+        for (int idx = 0; idx < 4; idx++) {
+            frameStats->record(FrameSource::Systems, 0.1f + 0.01f * static_cast<float>(idx));
+        }
+
+        profiler->endFrame();
+        frameStats->endFrame();
+
+        const auto hitches = frameStats->takeHitches();
+
+        REQUIRE(hitches.size() == 2);
+        REQUIRE(hitches.front().duration == 0.1f + 0.01f * 2);
+        REQUIRE(hitches.back().duration == 0.1f + 0.01f * 3);
+    }
+}
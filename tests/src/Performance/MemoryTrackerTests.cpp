@@ -0,0 +1,131 @@
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include <Penrose/Common/EngineError.hpp>
+#include <Penrose/Performance/MemoryTracker.hpp>
+#include <Penrose/Performance/MetricsRegistry.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+
+using namespace Penrose;
+
+TEST_CASE("Performance / MemoryTracker", "[engine-unit-test][Performance][MemoryTracker]") {
+    auto resources = ResourceSet();
+
+    const auto metrics = resources.add<MetricsRegistry>().done();
+    const auto tracker = resources.add<MemoryTracker>().done();
+
+    SECTION("Allocations are accounted to tag of scope") {
+        const auto before = tracker->getStats(MemoryTag::UI);
+
+        std::unique_ptr<int[]> values;
+
+        // assertions are made outside of scope, so allocations of Catch are not accounted to tag
+        {
+            const auto memoryScope = MemoryTagScope(MemoryTag::UI);
+
+            values = std::make_unique<int[]>(256);
+        }
+
+        if (MemoryTracker::isEnabled()) {
+            REQUIRE(tracker->getStats(MemoryTag::UI).liveBytes == before.liveBytes + 256 * sizeof(int));
+        }
+
+        values.reset();
+
+        const auto after = tracker->getStats(MemoryTag::UI);
+
+        REQUIRE(after.liveBytes == before.liveBytes);
+
+        if (MemoryTracker::isEnabled()) {
+            REQUIRE(after.allocations == before.allocations + 1);
+            REQUIRE(after.peakBytes >= 256 * sizeof(int));
+        } else {
+            REQUIRE(after.allocations == 0);
+        }
+    }
+
+    SECTION("Statistics are published into metrics") {
+        {
+            const auto memoryScope = MemoryTagScope(MemoryTag::Scene);
+            const auto value = std::make_shared<int>(42);
+
+            tracker->endFrame();
+
+            REQUIRE(value != nullptr);
+        }
+
+        const auto frameAllocations = MemoryTracker::isEnabled() ? 1 : 0;
+
+        REQUIRE(tracker->getStats(MemoryTag::Scene).frameAllocations == frameAllocations);
+        REQUIRE(metrics->gauge("memory.scene.frame_allocations")->get() == frameAllocations);
+    }
+
+    SECTION("Allocating frame fails in steady state") {
+        tracker->setInfo(MemoryTrackerInfo {.zeroFrameAllocations = true, .warmupFrames = 1});
+
+        // nothing is allocated between frames, so second frame passes steady state check
+        tracker->endFrame();
+        tracker->endFrame();
+
+        std::unique_ptr<int> value;
+
+        {
+            const auto memoryScope = MemoryTagScope(MemoryTag::ECS);
+
+            value = std::make_unique<int>(42);
+        }
+
+        if (MemoryTracker::isEnabled()) {
+            REQUIRE_THROWS_AS(tracker->endFrame(), EngineError);
+        } else {
+            REQUIRE_NOTHROW(tracker->endFrame());
+        }
+
+        REQUIRE(value != nullptr);
+    }
+
+    SECTION("Allocations of other threads do not fail frame in steady state") {
+        auto allocate = std::atomic_bool(false);
+        auto allocated = std::atomic_bool(false);
+
+        // allocation is kept outside of thread, so it is not removed by compiler
+        std::unique_ptr<int> value;
+
+        // thread is started before warm-up, as starting it allocates on calling thread
+        auto worker = std::jthread([&allocate, &allocated, &value] {
+            while (!allocate.load()) {
+                std::this_thread::yield();
+            }
+
+            {
+                const auto memoryScope = MemoryTagScope(MemoryTag::Assets);
+
+                value = std::make_unique<int>(42);
+            }
+
+            allocated.store(true);
+        });
+
+        tracker->setInfo(MemoryTrackerInfo {.zeroFrameAllocations = true, .warmupFrames = 1});
+
+        tracker->endFrame();
+        tracker->endFrame();
+
+        allocate.store(true);
+
+        while (!allocated.load()) {
+            std::this_thread::yield();
+        }
+
+        REQUIRE_NOTHROW(tracker->endFrame());
+
+        const auto stats = tracker->getStats(MemoryTag::Assets);
+
+        REQUIRE(stats.frameAllocations == (MemoryTracker::isEnabled() ? 1 : 0));
+        REQUIRE(stats.loopFrameAllocations == 0);
+        REQUIRE(value != nullptr);
+    }
+}
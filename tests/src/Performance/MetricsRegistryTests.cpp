@@ -0,0 +1,102 @@
+#include <catch2/catch_all.hpp>
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <Penrose/Performance/MetricsRegistry.hpp>
+
+using namespace Penrose;
+
+TEST_CASE("Performance / MetricsRegistry", "[engine-unit-test][Performance][MetricsRegistry]") {
+    auto registry = MetricsRegistry();
+
+    SECTION("Metrics are created once per name") {
+        const auto counter = registry.counter("counter");
+
+        REQUIRE(registry.counter("counter") == counter);
+        REQUIRE(registry.counter("other") != counter);
+        REQUIRE(registry.gauge("gauge") == registry.gauge("gauge"));
+        REQUIRE(registry.histogram("histogram") == registry.histogram("histogram", {1.0}));
+    }
+
+    SECTION("Counter is updated from multiple threads") {
+        constexpr std::uint32_t THREAD_COUNT = 4;
+        constexpr std::uint32_t ADD_COUNT = 10000;
+
+        const auto counter = registry.counter("counter");
+        auto threads = std::vector<std::thread>();
+
+        for (std::uint32_t threadIdx = 0; threadIdx < THREAD_COUNT; threadIdx++) {
+            threads.emplace_back([counter] {
+                for (std::uint32_t idx = 0; idx < ADD_COUNT; idx++) {
+                    counter->add();
+                }
+            });
+        }
+
+        for (auto &thread: threads) {
+            thread.join();
+        }
+
+        REQUIRE(counter->get() == THREAD_COUNT * ADD_COUNT);
+    }
+
+    SECTION("Gauge holds current value") {
+        const auto gauge = registry.gauge("gauge");
+
+        gauge->set(10);
+        gauge->add(5);
+        gauge->add(-3);
+
+        REQUIRE(gauge->get() == 12);
+    }
+
+    SECTION("Histogram distributes values into buckets") {
+        const auto histogram = registry.histogram("histogram", {1.0, 10.0});
+
+        histogram->record(0.5);
+        histogram->record(1.0);
+        histogram->record(5.0);
+        histogram->record(50.0);
+
+        const auto snapshot = registry.snapshot();
+
+        REQUIRE(snapshot.histograms.size() == 1);
+
+        const auto &value = snapshot.histograms.front();
+
+        REQUIRE(value.name == "histogram");
+        REQUIRE(value.count == 4);
+        REQUIRE(value.sum == 56.5);
+        REQUIRE(value.min == 0.5);
+        REQUIRE(value.max == 50.0);
+        REQUIRE(value.buckets == std::vector<std::uint64_t> {2, 1, 1});
+    }
+
+    SECTION("Histogram requires sorted bounds") {
+        REQUIRE_THROWS(registry.histogram("histogram", {10.0, 1.0}));
+    }
+
+    SECTION("Dump into inaccessible file is skipped") {
+        registry.setDumpInfo(MetricsDumpInfo {.path = "missing-directory/metrics.jsonl", .interval = 0});
+
+        REQUIRE_NOTHROW(registry.update(1));
+    }
+
+    SECTION("Snapshot is written as single JSON line") {
+        registry.counter("counter")->add(3);
+        registry.gauge("gauge")->set(1.5);
+        registry.histogram("histogram", {1.0})->record(2.0);
+
+        auto stream = std::ostringstream();
+        writeMetrics(registry.snapshot(), stream);
+
+        REQUIRE(
+            stream.str()
+            == R"({"counters":{"counter":3},"gauges":{"gauge":1.5},"histograms":{"histogram":{"count":1,"sum":2,)"
+               R"("min":2,"max":2,"bounds":[1],"buckets":[0,1]}}})"
+               "\n"
+        );
+    }
+}
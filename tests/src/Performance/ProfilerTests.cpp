@@ -0,0 +1,146 @@
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+
+#include <Penrose/Performance/Profiler.hpp>
+
+using namespace Penrose;
+
+TEST_CASE("Performance / Profiler", "[engine-unit-test][Performance][Profiler]") {
+    auto profiler = Profiler();
+
+    SECTION("Tags are interned once") {
+        const auto first = profiler.intern("First");
+        const auto second = profiler.intern("Second");
+
+        REQUIRE(first != second);
+        REQUIRE(profiler.intern("First") == first);
+        REQUIRE(profiler.getTagName(second) == "Second");
+    }
+
+    SECTION("Ticks are converted to time before first frame") {
+        const auto begin = Profiler::now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        const auto end = Profiler::now();
+
+        const auto seconds = static_cast<double>(end - begin) / profiler.getTicksPerSecond();
+
+        REQUIRE(seconds > 0.015);
+        REQUIRE(seconds < 0.5);
+    }
+
+    SECTION("Nested scopes are aggregated per tag") {
+        const auto outer = profiler.intern("Outer");
+        const auto inner = profiler.intern("Inner");
+
+        for (int idx = 0; idx < 4; idx++) {
+            auto outerScope = profiler.begin(outer);
+
+            {
+                auto innerScope = profiler.begin(inner);
+            }
+
+            {
+                auto innerScope = profiler.begin(inner);
+            }
+        }
+
+        REQUIRE(profiler.getStats().empty());
+
+        profiler.endFrame();
+
+        const auto stats = profiler.getStats();
+        REQUIRE(stats.size() == 2);
+
+        const auto outerStats = std::ranges::find(stats, std::string("Outer"), &Profiler::ScopeStats::tag);
+        const auto innerStats = std::ranges::find(stats, std::string("Inner"), &Profiler::ScopeStats::tag);
+
+        REQUIRE(outerStats != stats.end());
+        REQUIRE(innerStats != stats.end());
+        REQUIRE(outerStats->count == 4);
+        REQUIRE(innerStats->count == 8);
+        REQUIRE(innerStats->min <= innerStats->avg);
+        REQUIRE(innerStats->avg <= innerStats->max);
+        REQUIRE(innerStats->p50 <= innerStats->p99);
+        REQUIRE(outerStats->max >= innerStats->min);
+    }
+
+    SECTION("Scopes of every thread are drained") {
+        const auto tag = profiler.intern("Worker");
+
+        auto workers = std::vector<std::thread>();
+        for (int workerIdx = 0; workerIdx < 4; workerIdx++) {
+            workers.emplace_back([&profiler, tag] {
+                for (int idx = 0; idx < 100; idx++) {
+                    auto scope = profiler.begin(tag);
+                }
+            });
+        }
+
+        for (auto &worker: workers) {
+            worker.join();
+        }
+
+        profiler.endFrame();
+
+        const auto stats = profiler.getStats();
+        REQUIRE(stats.size() == 1);
+        REQUIRE(stats.at(0).count == 400);
+        REQUIRE(profiler.getDroppedCount() == 0);
+    }
+
+    SECTION("Scopes of external track are drained") {
+        const auto tag = profiler.intern("External");
+        const auto track = profiler.addTrack("GPU");
+
+        const auto ticks = static_cast<Profiler::Ticks>(profiler.getTicksPerSecond());
+
+        profiler.record(track, Profiler::ScopeRecord {.tag = tag, .depth = 0, .begin = ticks, .end = 3 * ticks});
+        profiler.endFrame();
+
+        const auto stats = profiler.getStats();
+        REQUIRE(stats.size() == 1);
+        REQUIRE(stats.at(0).count == 1);
+        REQUIRE(stats.at(0).max > 1.99f);
+        REQUIRE(stats.at(0).max < 2.01f);
+    }
+
+    SECTION("Most recent frames are kept") {
+        const auto tag = profiler.intern("Recent");
+
+        for (std::uint32_t frameIdx = 0; frameIdx < Profiler::HISTORY_FRAMES + 2; frameIdx++) {
+            for (std::uint32_t idx = 0; idx <= frameIdx; idx++) {
+                auto scope = profiler.begin(tag);
+            }
+
+            profiler.endFrame();
+        }
+
+        const auto recent = profiler.getRecentFrames();
+
+        auto recordCount = std::size_t(0);
+        for (const auto &thread: recent.threads) {
+            recordCount += thread.records.size();
+        }
+
+        // oldest kept frame recorded 3 scopes, newest one recorded 6 scopes
+        REQUIRE(recent.frames.size() == Profiler::HISTORY_FRAMES);
+        REQUIRE(recordCount == 3 + 4 + 5 + 6);
+        REQUIRE(recent.tags.at(tag) == "Recent");
+    }
+
+    SECTION("Overflowed records are dropped") {
+        const auto tag = profiler.intern("Overflow");
+        const auto extra = 10;
+
+        for (std::uint64_t idx = 0; idx < Profiler::THREAD_BUFFER_CAPACITY + extra; idx++) {
+            auto scope = profiler.begin(tag);
+        }
+
+        profiler.endFrame();
+
+        // one slot is always reserved for record under write
+        REQUIRE(profiler.getDroppedCount() == extra + 1);
+        REQUIRE(profiler.getStats().at(0).count == Profiler::THREAD_BUFFER_CAPACITY - 1);
+    }
+}
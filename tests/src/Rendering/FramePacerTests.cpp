@@ -0,0 +1,71 @@
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+
+#include "../src/Rendering/FramePacer.hpp"
+
+using namespace Penrose;
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Rendering / FramePacer", "[engine-unit-test][Rendering][FramePacer]") {
+
+    // waiting only advances fake clock, so every duration is exact
+    auto time = FramePacer::Clock::time_point();
+    auto pacer = FramePacer(FramePacer::Timer {
+        .now = [&time] { return time; },
+        .waitUntil = [&time](const FramePacer::Clock::time_point deadline) { time = std::max(time, deadline); },
+    });
+
+    SECTION("Pacer without target rate does not wait") {
+        REQUIRE_FALSE(pacer.getInterval().has_value());
+        REQUIRE(pacer.pace() == FramePacer::Clock::duration::zero());
+        REQUIRE(pacer.pace() == FramePacer::Clock::duration::zero());
+        REQUIRE(time == FramePacer::Clock::time_point());
+    }
+
+    SECTION("Pacer holds frames to target rate") {
+        pacer.setTargetRate(100);
+
+        REQUIRE(pacer.getInterval() == 10ms);
+
+        // first frame only starts schedule
+        REQUIRE(pacer.pace() == FramePacer::Clock::duration::zero());
+
+        for (int idx = 0; idx < 5; idx++) {
+            REQUIRE(pacer.pace() == 10ms);
+        }
+
+        REQUIRE(time == FramePacer::Clock::time_point(50ms));
+    }
+
+    SECTION("Pacer waits only for remaining part of interval") {
+        pacer.setTargetRate(100);
+        pacer.pace();
+
+        time += 4ms;
+
+        REQUIRE(pacer.pace() == 6ms);
+        REQUIRE(time == FramePacer::Clock::time_point(10ms));
+    }
+
+    SECTION("Late frame restarts schedule") {
+        pacer.setTargetRate(1000);
+        pacer.pace();
+
+        time += 10ms;
+
+        // late frame does not wait, next frame waits for full interval instead of catching up
+        REQUIRE(pacer.pace() == FramePacer::Clock::duration::zero());
+        REQUIRE(pacer.pace() == 1ms);
+        REQUIRE(time == FramePacer::Clock::time_point(11ms));
+    }
+
+    SECTION("Resetting target rate disables pacing") {
+        pacer.setTargetRate(100);
+        pacer.setTargetRate(std::nullopt);
+
+        REQUIRE_FALSE(pacer.getInterval().has_value());
+        REQUIRE(pacer.pace() == FramePacer::Clock::duration::zero());
+    }
+}
@@ -0,0 +1,120 @@
+#include <catch2/catch_all.hpp>
+
+#include "../src/Rendering/Graph/GraphCompiler.hpp"
+
+using namespace Penrose;
+
+static AttachmentInfo makeAttachment(const AttachmentLoadOp loadOp, const AttachmentStoreOp storeOp) {
+    return AttachmentInfo {
+        .format = std::nullopt,
+        .clearValue = {},
+        .loadOp = loadOp,
+        .storeOp = storeOp,
+        .initialLayout = AttachmentLayout::Undefined,
+        .finalLayout = AttachmentLayout::ColorAttachment,
+    };
+}
+
+TEST_CASE("Rendering / GraphCompiler", "[engine-unit-test][Rendering][GraphCompiler]") {
+
+    // 0 - stored output, 1..3 - transient g-buffer/lighting/unused targets
+    const auto graph = GraphInfo {
+        .name = "TestGraph",
+        .attachments = {
+            makeAttachment(AttachmentLoadOp::Clear, AttachmentStoreOp::Store),
+            makeAttachment(AttachmentLoadOp::Clear, AttachmentStoreOp::DontCare),
+            makeAttachment(AttachmentLoadOp::Clear, AttachmentStoreOp::DontCare),
+            makeAttachment(AttachmentLoadOp::Clear, AttachmentStoreOp::DontCare),
+        },
+        .passes = {
+            PassInfo {.dependsOn = {3}, .colorTargets = {0}},
+            PassInfo {.colorTargets = {1}},
+            PassInfo {.colorTargets = {3}},
+            PassInfo {.inputTargets = {1}, .colorTargets = {2}},
+        },
+        .area = std::nullopt,
+    };
+
+    const auto compiled = compileGraph(graph);
+
+    SECTION("Passes are sorted and unused passes are culled") {
+        REQUIRE(compiled.passes.size() == 3);
+        REQUIRE(compiled.passes.at(0).passIdx == 1);
+        REQUIRE(compiled.passes.at(1).passIdx == 3);
+        REQUIRE(compiled.passes.at(2).passIdx == 0);
+    }
+
+    SECTION("Attachment lifetimes are computed in execution order") {
+        REQUIRE(compiled.attachments.at(1).firstSubpass == 0);
+        REQUIRE(compiled.attachments.at(1).lastSubpass == 1);
+        REQUIRE_FALSE(compiled.attachments.at(3).firstSubpass.has_value());
+        REQUIRE_FALSE(compiled.attachments.at(0).transient);
+    }
+
+    SECTION("Transient attachments with overlapping lifetimes get separate alias slots") {
+        REQUIRE(compiled.attachments.at(1).transient);
+        REQUIRE(compiled.attachments.at(2).transient);
+        REQUIRE(compiled.attachments.at(1).aliasSlot == 0);
+        REQUIRE(compiled.attachments.at(2).aliasSlot == 1);
+        REQUIRE(compiled.aliasSlotCount == 2);
+    }
+
+    SECTION("Transient attachments with disjoint lifetimes share alias slot") {
+
+        // 0 - stored output, 1 - transient of first half, 2 - transient of second half
+        const auto disjointGraph = GraphInfo {
+            .name = "DisjointGraph",
+            .attachments = {
+                makeAttachment(AttachmentLoadOp::Clear, AttachmentStoreOp::Store),
+                makeAttachment(AttachmentLoadOp::Clear, AttachmentStoreOp::DontCare),
+                makeAttachment(AttachmentLoadOp::Clear, AttachmentStoreOp::DontCare),
+            },
+            .passes = {
+                PassInfo {.colorTargets = {1}},
+                PassInfo {.inputTargets = {1}, .colorTargets = {0}},
+                PassInfo {.dependsOn = {1}, .colorTargets = {2}},
+                PassInfo {.inputTargets = {2}, .colorTargets = {0}},
+            },
+            .area = std::nullopt,
+        };
+
+        const auto disjoint = compileGraph(disjointGraph);
+
+        REQUIRE(disjoint.passes.size() == 4);
+        REQUIRE(disjoint.attachments.at(1).lastSubpass < disjoint.attachments.at(2).firstSubpass);
+        REQUIRE(disjoint.attachments.at(1).transient);
+        REQUIRE(disjoint.attachments.at(2).transient);
+        REQUIRE(disjoint.attachments.at(1).aliasSlot == disjoint.attachments.at(2).aliasSlot);
+        REQUIRE(disjoint.aliasSlotCount == 1);
+    }
+
+    SECTION("Explicit dependencies override declaration order of shared attachments") {
+
+        // 0 - stored output, 1 - transient written by second pass and read by first pass
+        const auto reorderedGraph = GraphInfo {
+            .name = "ReorderedGraph",
+            .attachments = {
+                makeAttachment(AttachmentLoadOp::Clear, AttachmentStoreOp::Store),
+                makeAttachment(AttachmentLoadOp::Clear, AttachmentStoreOp::DontCare),
+            },
+            .passes = {
+                PassInfo {.dependsOn = {1}, .inputTargets = {1}, .colorTargets = {0}},
+                PassInfo {.colorTargets = {1}},
+            },
+            .area = std::nullopt,
+        };
+
+        const auto reordered = compileGraph(reorderedGraph);
+
+        REQUIRE(reordered.passes.size() == 2);
+        REQUIRE(reordered.passes.at(0).passIdx == 1);
+        REQUIRE(reordered.passes.at(1).passIdx == 0);
+    }
+
+    SECTION("Cyclic dependencies are rejected") {
+        auto cyclicGraph = graph;
+        cyclicGraph.passes.at(3).dependsOn = {0};
+
+        REQUIRE_THROWS(compileGraph(cyclicGraph));
+    }
+}
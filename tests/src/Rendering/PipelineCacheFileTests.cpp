@@ -0,0 +1,94 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../src/Rendering/PipelineCacheFile.hpp"
+
+using namespace Penrose;
+
+static PipelineCacheDevice makeDevice() {
+    return PipelineCacheDevice {
+        .vendorId = 0x10DE,
+        .deviceId = 0x2204,
+        .driverVersion = 42,
+        .cacheUuid = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16},
+    };
+}
+
+static std::string writeCache(const PipelineCacheDevice &device, const std::vector<std::byte> &data) {
+    auto stream = std::ostringstream(std::ios::binary);
+
+    PipelineCacheFile::write(stream, device, data.data(), data.size());
+
+    return stream.str();
+}
+
+static PipelineCacheStatus readCache(
+    const std::string &content, const PipelineCacheDevice &device, std::vector<std::byte> &data
+) {
+    auto stream = std::istringstream(content, std::ios::binary);
+
+    return PipelineCacheFile::read(stream, device, data);
+}
+
+TEST_CASE("Rendering / PipelineCacheFile", "[engine-unit-test][Rendering][PipelineCacheFile]") {
+    const auto device = makeDevice();
+    const auto data = std::vector<std::byte> {std::byte {0xCA}, std::byte {0xFE}, std::byte {0xBA}, std::byte {0xBE}};
+    auto content = writeCache(device, data);
+    auto loaded = std::vector<std::byte>();
+
+    SECTION("Cache written for device is loaded") {
+        REQUIRE(readCache(content, device, loaded) == PipelineCacheStatus::Loaded);
+        REQUIRE(loaded == data);
+    }
+
+    SECTION("Truncated header is rejected") {
+        content.resize(8);
+
+        REQUIRE(readCache(content, device, loaded) == PipelineCacheStatus::Truncated);
+        REQUIRE(loaded.empty());
+    }
+
+    SECTION("Truncated data is rejected") {
+        content.pop_back();
+
+        REQUIRE(readCache(content, device, loaded) == PipelineCacheStatus::Corrupted);
+        REQUIRE(loaded.empty());
+    }
+
+    SECTION("Unknown format is rejected") {
+        content.at(0) = 'X';
+
+        REQUIRE(readCache(content, device, loaded) == PipelineCacheStatus::UnknownFormat);
+    }
+
+    SECTION("Cache of device with another UUID is rejected") {
+        auto otherDevice = device;
+        otherDevice.cacheUuid.at(15) = 0;
+
+        REQUIRE(readCache(content, otherDevice, loaded) == PipelineCacheStatus::OtherDevice);
+        REQUIRE(loaded.empty());
+    }
+
+    SECTION("Cache with bad checksum is rejected") {
+        content.back() = static_cast<char>(0x00);
+
+        REQUIRE(readCache(content, device, loaded) == PipelineCacheStatus::Corrupted);
+        REQUIRE(loaded.empty());
+    }
+
+    SECTION("Corrupted data size is rejected without allocation") {
+        // data size is stored right before checksum at the end of header
+        const auto sizeOffset = content.size() - data.size() - 2 * sizeof(std::uint64_t);
+
+        for (std::size_t idx = 0; idx < sizeof(std::uint64_t); idx++) {
+            content.at(sizeOffset + idx) = static_cast<char>(0xFF);
+        }
+
+        REQUIRE(readCache(content, device, loaded) == PipelineCacheStatus::Corrupted);
+        REQUIRE(loaded.empty());
+    }
+}
@@ -0,0 +1,324 @@
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <Penrose/Common/EngineError.hpp>
+#include <Penrose/Resources/Initializable.hpp>
+#include <Penrose/Resources/Resource.hpp>
+#include <Penrose/Resources/ResourceSet.hpp>
+
+#include "../src/Common/LogImpl.hpp"
+#include "../src/Resources/ResourceInitializer.hpp"
+
+using namespace Penrose;
+
+namespace {
+
+    class InitJournal final: public Resource<InitJournal> {
+    public:
+        void enter(const std::string &name) {
+            const auto running = ++this->_running;
+            auto maxRunning = this->maxRunning.load();
+
+            while (maxRunning < running && !this->maxRunning.compare_exchange_weak(maxRunning, running)) {
+                //
+            }
+
+            auto lock = std::lock_guard(this->_mutex);
+
+            this->threads.emplace_back(name, std::this_thread::get_id());
+        }
+
+        void leave(const std::string &name, std::vector<std::string> &events) {
+            --this->_running;
+
+            auto lock = std::lock_guard(this->_mutex);
+
+            events.push_back(name);
+        }
+
+        [[nodiscard]] std::thread::id getThread(const std::string &name) {
+            auto lock = std::lock_guard(this->_mutex);
+
+            return std::ranges::find(this->threads, name, &std::pair<std::string, std::thread::id>::first)->second;
+        }
+
+        [[nodiscard]] std::ptrdiff_t indexOf(const std::string &name) {
+            auto lock = std::lock_guard(this->_mutex);
+
+            return std::ranges::find(this->initialized, name) - this->initialized.begin();
+        }
+
+        std::vector<std::string> initialized;
+        std::vector<std::string> destroyed;
+        std::vector<std::pair<std::string, std::thread::id>> threads;
+        std::atomic_int maxRunning = 0;
+
+    private:
+        std::mutex _mutex;
+        std::atomic_int _running = 0;
+    };
+
+    template <typename Self>
+    class JournaledResource: public Resource<Self>,
+                             public Initializable {
+    public:
+        explicit JournaledResource(const ResourceSet *resources, std::string name)
+            : _journal(resources->get<InitJournal>()),
+              _name(std::move(name)) {
+            //
+        }
+
+        void init() override {
+            this->_journal->enter(this->_name);
+            this->initialize();
+            this->_journal->leave(this->_name, this->_journal->initialized);
+        }
+
+        void destroy() override {
+            this->_journal->destroyed.push_back(this->_name);
+        }
+
+    protected:
+        virtual void initialize() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+
+    private:
+        ResourceProxy<InitJournal> _journal;
+        std::string _name;
+    };
+
+    class Device final: public JournaledResource<Device> {
+    public:
+        explicit Device(const ResourceSet *resources)
+            : JournaledResource(resources, "Device") {
+            //
+        }
+    };
+
+    class Window final: public JournaledResource<Window> {
+    public:
+        explicit Window(const ResourceSet *resources)
+            : JournaledResource(resources, "Window") {
+            //
+        }
+    };
+
+    class Assets final: public JournaledResource<Assets> {
+    public:
+        explicit Assets(const ResourceSet *resources)
+            : JournaledResource(resources, "Assets") {
+            //
+        }
+    };
+
+    class Pipeline final: public JournaledResource<Pipeline> {
+    public:
+        explicit Pipeline(const ResourceSet *resources)
+            : JournaledResource(resources, "Pipeline"),
+              _device(resources->get<Device>()) {
+            //
+        }
+
+    private:
+        ResourceProxy<Device> _device;
+    };
+
+    // not initializable, dependencies of resources are followed through it
+    class Loader final: public Resource<Loader> {
+    public:
+        explicit Loader(const ResourceSet *resources)
+            : _device(resources->get<Device>()) {
+            //
+        }
+
+    private:
+        ResourceProxy<Device> _device;
+    };
+
+    class Scene final: public JournaledResource<Scene> {
+    public:
+        explicit Scene(const ResourceSet *resources)
+            : JournaledResource(resources, "Scene"),
+              _loader(resources->get<Loader>()) {
+            //
+        }
+
+    private:
+        ResourceProxy<Loader> _loader;
+    };
+
+    class Failing final: public JournaledResource<Failing> {
+    public:
+        explicit Failing(const ResourceSet *resources)
+            : JournaledResource(resources, "Failing") {
+            //
+        }
+
+    protected:
+        void initialize() override {
+            throw EngineError("Failed to initialize");
+        }
+    };
+
+    [[nodiscard]] std::vector<std::string> getTypeNames(
+        const std::vector<ResourceSet::DependencyNode<Initializable>> &nodes,
+        const ResourceSet::DependencyNode<Initializable> &node
+    ) {
+        auto names = std::vector<std::string>();
+
+        for (const auto dependencyIdx: node.dependencies) {
+            names.emplace_back(nodes.at(dependencyIdx).type.name());
+        }
+
+        return names;
+    }
+}
+
+TEST_CASE("Resources / ResourceInitializer", "[engine-unit-test][Resources][ResourceInitializer]") {
+    auto resources = ResourceSet();
+
+    resources.add<LogImpl>().group(ResourceGroup::Engine).implements<Log>().done();
+    const auto journal = resources.add<InitJournal>().group(ResourceGroup::Engine).done();
+
+    resources.add<Window>().group(ResourceGroup::Windowing).implements<Initializable>().mainThread().done();
+    resources.add<Scene>().group(ResourceGroup::Scene).implements<Initializable>().done();
+    resources.add<Device>().group(ResourceGroup::Backend).implements<Initializable>().done();
+    resources.add<Loader>().group(ResourceGroup::Assets).done();
+    resources.add<Assets>().group(ResourceGroup::Assets).implements<Initializable>().dependsOn<Window>().done();
+    resources.add<Pipeline>().group(ResourceGroup::Rendering).implements<Initializable>().done();
+
+    SECTION("Dependencies are inferred from proxies and declared explicitly") {
+        const auto nodes = resources.getDependencyGraph<Initializable>();
+
+        REQUIRE(nodes.size() == 5);
+        REQUIRE(nodes.at(0).type == Device::type());
+        REQUIRE(nodes.at(1).type == Window::type());
+        REQUIRE(nodes.at(2).type == Pipeline::type());
+        REQUIRE(nodes.at(3).type == Assets::type());
+        REQUIRE(nodes.at(4).type == Scene::type());
+
+        REQUIRE(nodes.at(0).dependencies.empty());
+        REQUIRE(nodes.at(1).mainThread);
+        REQUIRE(getTypeNames(nodes, nodes.at(2)) == std::vector<std::string> {Device::type().name()});
+        REQUIRE(getTypeNames(nodes, nodes.at(3)) == std::vector<std::string> {Window::type().name()});
+
+        // scene depends on device through loader
+        REQUIRE(getTypeNames(nodes, nodes.at(4)) == std::vector<std::string> {Device::type().name()});
+    }
+
+    SECTION("Dependencies on later resources are reported apart") {
+        class Early final: public JournaledResource<Early> {
+        public:
+            explicit Early(const ResourceSet *resources)
+                : JournaledResource(resources, "Early"),
+                  _assets(resources->get<Assets>()) {
+                //
+            }
+
+        private:
+            ResourceProxy<Assets> _assets;
+        };
+
+        resources.add<Early>().group(ResourceGroup::Engine).implements<Initializable>().done();
+
+        const auto nodes = resources.getDependencyGraph<Initializable>();
+
+        REQUIRE(nodes.at(0).type == Early::type());
+        REQUIRE(nodes.at(0).dependencies.empty());
+
+        // assets depend on window, so early resource depends on both
+        REQUIRE(nodes.at(0).laterDependencies.size() == 2);
+        REQUIRE(nodes.at(nodes.at(0).laterDependencies.at(0)).type == Window::type());
+        REQUIRE(nodes.at(nodes.at(0).laterDependencies.at(1)).type == Assets::type());
+    }
+
+    SECTION("Resources are initialized after dependencies and destroyed in reverse order") {
+        auto initializer = ResourceInitializer(&resources);
+
+        initializer.init();
+
+        REQUIRE(journal->initialized.size() == 5);
+        REQUIRE(journal->indexOf("Device") < journal->indexOf("Pipeline"));
+        REQUIRE(journal->indexOf("Device") < journal->indexOf("Scene"));
+        REQUIRE(journal->indexOf("Window") < journal->indexOf("Assets"));
+        REQUIRE(journal->getThread("Window") == std::this_thread::get_id());
+
+        if (std::thread::hardware_concurrency() > 1) {
+            REQUIRE(journal->maxRunning > 1);
+        }
+
+        initializer.destroy();
+
+        auto reversed = journal->initialized;
+        std::ranges::reverse(reversed);
+
+        REQUIRE(journal->destroyed == reversed);
+    }
+
+    SECTION("Failure stops initialization of dependent resources") {
+        class Dependent final: public JournaledResource<Dependent> {
+        public:
+            explicit Dependent(const ResourceSet *resources)
+                : JournaledResource(resources, "Dependent"),
+                  _failing(resources->get<Failing>()) {
+                //
+            }
+
+        private:
+            ResourceProxy<Failing> _failing;
+        };
+
+        resources.add<Failing>().implements<Initializable>().done();
+        resources.add<Dependent>().implements<Initializable>().done();
+
+        auto initializer = ResourceInitializer(&resources);
+
+        REQUIRE_THROWS_AS(initializer.init(), EngineError);
+        REQUIRE(journal->indexOf("Dependent") == static_cast<std::ptrdiff_t>(journal->initialized.size()));
+    }
+
+    SECTION("Failure destroys resources initialized before it") {
+        class LateFailing final: public JournaledResource<LateFailing> {
+        public:
+            explicit LateFailing(const ResourceSet *resources)
+                : JournaledResource(resources, "LateFailing"),
+                  _device(resources->get<Device>()) {
+                //
+            }
+
+        protected:
+            void initialize() override {
+                throw EngineError("Failed to initialize");
+            }
+
+        private:
+            ResourceProxy<Device> _device;
+        };
+
+        resources.add<LateFailing>().implements<Initializable>().done();
+
+        auto initializer = ResourceInitializer(&resources);
+
+        REQUIRE_THROWS_AS(initializer.init(), EngineError);
+        REQUIRE(journal->indexOf("Device") < static_cast<std::ptrdiff_t>(journal->initialized.size()));
+
+        auto reversed = journal->initialized;
+        std::ranges::reverse(reversed);
+
+        REQUIRE(journal->destroyed == reversed);
+
+        // resources are not destroyed twice
+        initializer.destroy();
+
+        REQUIRE(journal->destroyed.size() == journal->initialized.size());
+    }
+}
@@ -0,0 +1,117 @@
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <string_view>
+
+#include <Penrose/Common/EngineError.hpp>
+#include <Penrose/UI/BinaryLayout.hpp>
+#include <Penrose/UI/Widgets/Button.hpp>
+#include <Penrose/UI/Widgets/Label.hpp>
+#include <Penrose/UI/Widgets/List.hpp>
+#include <Penrose/UI/Widgets/Separator.hpp>
+#include <Penrose/UI/Widgets/Window.hpp>
+
+using namespace Penrose;
+
+static WidgetInstance makeLabel(StringProperty &&text) {
+    return std::make_unique<Label>(Label::Args {
+        .enabled = BooleanProperty(true),
+        .visible = BooleanProperty(PropertyType::Binding, false, "shown"),
+        .text = std::forward<decltype(text)>(text),
+    });
+}
+
+TEST_CASE("UI / BinaryLayout", "[engine-unit-test][UI][BinaryLayout]") {
+    auto children = WidgetList();
+    children.push_back(makeLabel(StringProperty(std::string("Constant"))));
+    children.push_back(std::make_unique<Button>(Button::Args {
+        .enabled = BooleanProperty(false),
+        .visible = BooleanProperty(true),
+        .title = StringProperty(PropertyType::Binding, {}, "title"),
+        .action = ActionProperty("click"),
+    }));
+    children.push_back(std::make_unique<Separator>());
+    children.push_back(std::make_unique<List>(List::Args {
+        .enabled = BooleanProperty(true),
+        .visible = BooleanProperty(true),
+        .itemTemplate = makeLabel(StringProperty(PropertyType::Binding, {}, "title")),
+        .items = ListProperty("items"),
+        .selection = IntegerProperty(-3),
+        .virtualized = BooleanProperty(true),
+    }));
+
+    const auto root = std::make_unique<Window>(Window::Args {
+        .enabled = BooleanProperty(true),
+        .visible = BooleanProperty(true),
+        .title = StringProperty(std::string("Window")),
+        .context = std::nullopt,
+        .opened = BooleanProperty(PropertyType::Binding, false, "opened"),
+        .children = std::move(children),
+    });
+
+    const auto content = writeBinaryLayout(root.get());
+
+    SECTION("Widget tree is restored") {
+        const auto layout = std::unique_ptr<Layout>(readBinaryLayout(content));
+        const auto window = dynamic_cast<const Window *>(layout->getRoot());
+
+        REQUIRE(window != nullptr);
+        REQUIRE(window->getTitle().getConstant() == "Window");
+        REQUIRE(!window->getContext().has_value());
+        REQUIRE(window->getOpened()->getBinding() == "opened");
+        REQUIRE(window->getChildren().size() == 4);
+
+        auto childIt = window->getChildren().begin();
+
+        const auto label = dynamic_cast<const Label *>((childIt++)->get());
+        REQUIRE(label != nullptr);
+        REQUIRE(label->getText().getConstant() == "Constant");
+        REQUIRE(label->getVisible().getBinding() == "shown");
+
+        const auto button = dynamic_cast<const Button *>((childIt++)->get());
+        REQUIRE(button != nullptr);
+        REQUIRE(!button->getEnabled().getConstant());
+        REQUIRE(button->getTitle().getBinding() == "title");
+        REQUIRE(button->getAction()->getBinding() == "click");
+
+        REQUIRE((childIt++)->get()->getType() == WidgetType::Separator);
+
+        const auto list = dynamic_cast<const List *>((childIt++)->get());
+        REQUIRE(list != nullptr);
+        REQUIRE(list->getItems().getBinding() == "items");
+        REQUIRE(list->getSelection().getConstant() == -3);
+        REQUIRE(list->getVirtualized().getConstant());
+        REQUIRE(list->getItemTemplate()->getType() == WidgetType::Label);
+
+        REQUIRE(layout->getCompiled().getInstructions().size() == 6);
+    }
+
+    SECTION("Strings are stored once") {
+        REQUIRE(std::ranges::search(content, std::string_view("title")).size() == 5);
+
+        const auto first = std::ranges::search(content, std::string_view("shown"));
+        const auto rest = std::ranges::subrange(first.end(), content.end());
+
+        REQUIRE(std::ranges::search(rest, std::string_view("shown")).empty());
+    }
+
+    SECTION("Malformed layout is rejected") {
+        auto truncated = content;
+        truncated.pop_back();
+
+        REQUIRE_THROWS_AS(readBinaryLayout(truncated), EngineError);
+
+        auto trailing = content;
+        trailing.push_back(0);
+
+        REQUIRE_THROWS_AS(readBinaryLayout(trailing), EngineError);
+
+        auto unknownVersion = content;
+        unknownVersion.at(0) = 0xFF;
+
+        REQUIRE_THROWS_AS(readBinaryLayout(unknownVersion), EngineError);
+    }
+}
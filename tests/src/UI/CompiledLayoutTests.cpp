@@ -0,0 +1,176 @@
+#include <catch2/catch_all.hpp>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <fmt/core.h>
+
+#include <Penrose/UI/CompiledLayout.hpp>
+#include <Penrose/UI/LayoutBinding.hpp>
+#include <Penrose/UI/Widgets/Group.hpp>
+#include <Penrose/UI/Widgets/Label.hpp>
+#include <Penrose/UI/Widgets/List.hpp>
+
+using namespace Penrose;
+
+static StringProperty bindString(std::string &&binding) {
+    return StringProperty(PropertyType::Binding, {}, std::forward<decltype(binding)>(binding));
+}
+
+static WidgetInstance makeLabel(StringProperty &&text) {
+    return std::make_unique<Label>(Label::Args {
+        .enabled = BooleanProperty(true),
+        .visible = BooleanProperty(true),
+        .text = std::forward<decltype(text)>(text),
+    });
+}
+
+TEST_CASE("UI / CompiledLayout", "[engine-unit-test][UI][CompiledLayout]") {
+    auto children = WidgetList();
+    children.push_back(makeLabel(StringProperty(std::string("Constant"))));
+    children.push_back(makeLabel(bindString("title")));
+    children.push_back(std::make_unique<List>(List::Args {
+        .enabled = BooleanProperty(true),
+        .visible = BooleanProperty(true),
+        .itemTemplate = makeLabel(bindString("name")),
+        .items = ListProperty("items"),
+        .selection = IntegerProperty(0),
+        .virtualized = BooleanProperty(true),
+    }));
+
+    auto innerChildren = WidgetList();
+    innerChildren.push_back(makeLabel(bindString("name")));
+    children.push_back(std::make_unique<Group>(Group::Args {
+        .enabled = BooleanProperty(true),
+        .visible = BooleanProperty(true),
+        .context = ObjectProperty("inner"),
+        .children = std::move(innerChildren),
+    }));
+
+    const auto root = std::make_unique<Group>(Group::Args {
+        .enabled = BooleanProperty(true),
+        .visible = BooleanProperty(true),
+        .context = std::nullopt,
+        .children = std::move(children),
+    });
+
+    const auto layout = CompiledLayout::compile(root.get());
+    const auto &instructions = layout.getInstructions();
+
+    SECTION("Widgets are flattened in depth-first order") {
+        REQUIRE(instructions.size() == 7);
+        REQUIRE(layout.getFrames().size() == 2);
+
+        REQUIRE(instructions.at(0).type == WidgetType::Group);
+        REQUIRE(instructions.at(0).end == 7);
+        REQUIRE(instructions.at(3).type == WidgetType::List);
+        REQUIRE(instructions.at(3).end == 5);
+        REQUIRE(instructions.at(5).type == WidgetType::Group);
+        REQUIRE(instructions.at(5).end == 7);
+
+        const auto &itemFrame = layout.getFrames().at(instructions.at(3).frame);
+
+        REQUIRE(itemFrame.begin == 4);
+        REQUIRE(itemFrame.end == 5);
+    }
+
+    SECTION("Constants are kept by moved layout") {
+        STATIC_REQUIRE_FALSE(std::is_copy_constructible_v<CompiledLayout>);
+        STATIC_REQUIRE(std::is_move_constructible_v<CompiledLayout>);
+
+        auto source = CompiledLayout::compile(root.get());
+        const auto slotIdx = source.getInstructions().at(1).slot + SLOT_TEXT;
+        const auto *constant = source.getFrames().at(CompiledLayout::ROOT_FRAME).slots.at(slotIdx).constant;
+
+        const auto moved = std::move(source);
+        const auto &slot = moved.getFrames().at(CompiledLayout::ROOT_FRAME).slots.at(slotIdx);
+
+        REQUIRE(slot.constant == constant);
+        REQUIRE(dynamic_cast<StringValue *>(slot.constant)->getValue() == "Constant");
+    }
+
+    auto items = std::make_shared<ListValue<ObjectValue>>();
+    items->push(ObjectValue().property<StringValue>("name", "First"));
+
+    auto context = std::make_shared<ObjectValue>();
+    std::ignore = context->property<StringValue>("title", "Title")
+                      .property("items", items)
+                      .property<ObjectValue>("inner", ObjectValue().property<StringValue>("name", "Inner"));
+
+    auto binding = LayoutBinding(&layout, context.get());
+    auto &rootBinding = binding.getRoot();
+
+    SECTION("Constant and bound slots are resolved") {
+        REQUIRE(LayoutBinding::get<StringValue>(rootBinding, instructions.at(1), SLOT_TEXT)->getValue() == "Constant");
+        REQUIRE(LayoutBinding::get<StringValue>(rootBinding, instructions.at(2), SLOT_TEXT)->getValue() == "Title");
+        REQUIRE(LayoutBinding::get<StringValue>(rootBinding, instructions.at(6), SLOT_TEXT)->getValue() == "Inner");
+        REQUIRE(LayoutBinding::get<Value>(rootBinding, instructions.at(0), SLOT_CONTEXT) == nullptr);
+    }
+
+    SECTION("List items are bound against item template") {
+        const auto &list = instructions.at(3);
+
+        REQUIRE(LayoutBinding::get<ListValue<ObjectValue>>(rootBinding, list, SLOT_ITEMS) == items.get());
+
+        auto &itemBinding = binding.getItem(rootBinding, list, 0, items->getItems().at(0));
+        const auto text = LayoutBinding::get<StringValue>(itemBinding, instructions.at(4), SLOT_TEXT);
+
+        REQUIRE(text->getValue() == "First");
+        REQUIRE(&binding.getItem(rootBinding, list, 0, items->getItems().at(0)) == &itemBinding);
+        REQUIRE(LayoutBinding::get<StringValue>(itemBinding, instructions.at(4), SLOT_TEXT) == text);
+        REQUIRE(LayoutBinding::get<BooleanValue>(rootBinding, list, SLOT_LIST_VIRTUALIZED)->getValue());
+    }
+
+    SECTION("Only requested rows are bound") {
+        const auto &list = instructions.at(3);
+
+        for (int idx = 0; idx < 1000; idx++) {
+            items->push(ObjectValue().property<StringValue>("name", fmt::format("Item {}", idx)));
+        }
+
+        auto &itemBinding = binding.getItem(rootBinding, list, 900, items->getItems().at(900));
+
+        REQUIRE(LayoutBinding::get<StringValue>(itemBinding, instructions.at(4), SLOT_TEXT)->getValue() == "Item 899");
+        REQUIRE(rootBinding.lists.at(list.list).frames.at(899).values.empty());
+
+        binding.trimItems(rootBinding, list, 10);
+
+        REQUIRE(rootBinding.lists.at(list.list).items.size() == 10);
+    }
+
+    SECTION("Replaced nested properties are bound again") {
+        const auto &list = instructions.at(3);
+        const auto &item = items->getItems().at(0);
+
+        std::ignore = binding.getItem(rootBinding, list, 0, item);
+        std::ignore = item->property<StringValue>("name", "Replaced item");
+
+        auto &itemBinding = binding.getItem(rootBinding, list, 0, item);
+
+        REQUIRE(
+            LayoutBinding::get<StringValue>(itemBinding, instructions.at(4), SLOT_TEXT)->getValue() == "Replaced item"
+        );
+
+        const auto inner = std::static_pointer_cast<ObjectValue>(*context->tryGetProperty("inner"));
+        std::ignore = inner->property<StringValue>("name", "Replaced inner");
+
+        auto &nextRootBinding = binding.getRoot();
+
+        REQUIRE(
+            LayoutBinding::get<StringValue>(nextRootBinding, instructions.at(6), SLOT_TEXT)->getValue()
+            == "Replaced inner"
+        );
+    }
+
+    SECTION("Incompatible binding is reported") {
+        auto invalidContext = ObjectValue();
+        std::ignore = invalidContext.property<IntegerValue>("title", 0)
+                          .property("items", items)
+                          .property<ObjectValue>("inner", ObjectValue().property<StringValue>("name", "Inner"));
+
+        auto invalidBinding = LayoutBinding(&layout, &invalidContext);
+
+        REQUIRE_THROWS(invalidBinding.getRoot());
+    }
+}
@@ -0,0 +1,78 @@
+#include <catch2/catch_all.hpp>
+
+#include <memory>
+#include <string>
+
+#include <fmt/core.h>
+
+#include <Penrose/Common/EngineError.hpp>
+#include <Penrose/UI/ValuePath.hpp>
+
+using namespace Penrose;
+
+TEST_CASE("UI / ValuePath", "[engine-unit-test][UI][ValuePath]") {
+    auto inner = std::make_shared<ObjectValue>();
+    std::ignore = inner->property<IntegerValue>("value", 1);
+
+    auto root = ObjectValue();
+    std::ignore = root.property("inner", inner);
+
+    SECTION("Object contains many properties") {
+        auto object = ObjectValue();
+
+        for (int idx = 0; idx < 1000; idx++) {
+            std::ignore = object.property<IntegerValue>(fmt::format("property{}", idx), idx);
+        }
+
+        REQUIRE(object.getProperties().size() == 1000);
+
+        for (int idx = 0; idx < 1000; idx += 97) {
+            const auto value = object.tryGetProperty(fmt::format("property{}", idx));
+
+            REQUIRE(value.has_value());
+            REQUIRE(static_cast<IntegerValue *>(value->get())->getValue() == idx);
+        }
+
+        REQUIRE(object.removeProperty("property500"));
+        REQUIRE(!object.removeProperty("property500"));
+        REQUIRE(!object.tryGetProperty("property500").has_value());
+        REQUIRE(object.tryGetProperty("property999").has_value());
+    }
+
+    SECTION("Path is resolved through nested objects") {
+        const auto path = ValuePath("inner.value");
+
+        REQUIRE(static_cast<IntegerValue *>(path.resolve(&root).get())->getValue() == 1);
+        REQUIRE(path.resolve(&root) == path.resolve(&root));
+        REQUIRE(root.getPropertyByPath("inner.value") == path.resolve(&root));
+    }
+
+    SECTION("Structural change invalidates cached segments") {
+        const auto path = ValuePath("inner.value");
+        std::ignore = path.resolve(&root);
+
+        const auto stamp = inner->getStamp();
+        std::ignore = inner->property<IntegerValue>("other", 2).property<IntegerValue>("value", 3);
+
+        REQUIRE(inner->getStamp() != stamp);
+        REQUIRE(static_cast<IntegerValue *>(path.resolve(&root).get())->getValue() == 3);
+
+        REQUIRE(inner->removeProperty("value"));
+        REQUIRE_THROWS_AS(path.resolve(&root), EngineError);
+    }
+
+    SECTION("Copy of object has its own stamp") {
+        const auto path = ValuePath("inner");
+        const auto copy = root;
+
+        REQUIRE(copy.getStamp() != root.getStamp());
+        REQUIRE(path.resolve(&root) == path.resolve(&copy));
+    }
+
+    SECTION("Invalid paths are rejected") {
+        REQUIRE_THROWS_AS(ValuePath(""), EngineError);
+        REQUIRE_THROWS_AS(ValuePath("inner..value"), EngineError);
+        REQUIRE_THROWS_AS(ValuePath("inner.value.more").resolve(&root), EngineError);
+        REQUIRE_THROWS_AS(ValuePath("missing").resolve(&root), EngineError);
+    }
+}
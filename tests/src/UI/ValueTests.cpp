@@ -0,0 +1,60 @@
+#include <catch2/catch_all.hpp>
+
+#include <string>
+
+#include <Penrose/UI/Value.hpp>
+
+using namespace Penrose;
+
+TEST_CASE("UI / Value", "[engine-unit-test][UI][Value]") {
+
+    SECTION("Version of stored value is increased only on change") {
+        auto value = StringValue("text");
+        const auto version = value.getVersion();
+
+        value.setValue("text");
+        REQUIRE(value.getVersion() == version);
+
+        value.setValue("other");
+        REQUIRE(value.getValue() == "other");
+        REQUIRE(value.getVersion() == version + 1);
+    }
+
+    SECTION("Constant value is not changed") {
+        auto value = IntegerValue(1, true);
+        const auto version = value.getVersion();
+
+        value.setValue(2);
+
+        REQUIRE(value.isConstant());
+        REQUIRE(value.getValue() == 1);
+        REQUIRE(value.getVersion() == version);
+    }
+
+    SECTION("Computed value tracks changes of its source") {
+        int source = 1;
+        auto value = IntegerValue([&source]() { return source; }, [&source](int newValue) { source = newValue; });
+
+        const auto version = value.getVersion();
+        REQUIRE(value.getValue() == 1);
+        REQUIRE(value.getVersion() == version);
+
+        source = 2;
+        REQUIRE(value.getVersion() == version + 1);
+        REQUIRE(value.getValue() == 2);
+
+        value.setValue(3);
+        REQUIRE(source == 3);
+        REQUIRE(value.getVersion() == version + 2);
+    }
+
+    SECTION("Stored value stays valid after copy") {
+        auto value = BooleanValue(false);
+        auto copy = value;
+
+        copy.setValue(true);
+
+        REQUIRE(!value.getValue());
+        REQUIRE(copy.getValue());
+    }
+}
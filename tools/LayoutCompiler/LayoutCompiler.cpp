@@ -0,0 +1,59 @@
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <Penrose/Common/EngineError.hpp>
+#include <Penrose/UI/BinaryLayout.hpp>
+#include <Penrose/UI/LayoutFactory.hpp>
+
+using namespace Penrose;
+
+int main(const int argc, const char **argv) {
+
+    if (argc != 3) {
+        fmt::print(stderr, "Usage: {} <layout.xml> <layout.asset>\n", argv[0]);
+        return 1;
+    }
+
+    auto input = std::ifstream(argv[1], std::ios::binary);
+
+    if (!input.is_open()) {
+        fmt::print(stderr, "Failed to open {}\n", argv[1]);
+        return 1;
+    }
+
+    auto content = std::vector<unsigned char>(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+    const auto inputSize = content.size();
+
+    std::unique_ptr<Layout> layout;
+
+    try {
+        layout = std::unique_ptr<Layout>(LayoutFactory().makeLayout(std::move(content)));
+    } catch (const EngineError &error) {
+        fmt::print(stderr, "Failed to compile {}: {}\n", argv[1], error.what());
+        return 1;
+    }
+
+    auto output = std::ofstream(argv[2], std::ios::binary);
+
+    if (!output.is_open()) {
+        fmt::print(stderr, "Failed to open {}\n", argv[2]);
+        return 1;
+    }
+
+    writeBinaryLayoutAsset(layout->getRoot(), output);
+
+    if (!output.good()) {
+        fmt::print(stderr, "Failed to write {}\n", argv[2]);
+        return 1;
+    }
+
+    fmt::print(
+        "{}: {} bytes of XML -> {}: {} bytes\n", argv[1], inputSize, argv[2], static_cast<std::size_t>(output.tellp())
+    );
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+#include <fstream>
+#include <iostream>
+
+#include <fmt/chrono.h>
+#include <fmt/core.h>
+
+#include <Penrose/Common/BinaryLogSink.hpp>
+#include <Penrose/Common/EngineError.hpp>
+
+#include "../../src/Utils/StringifyUtils.hpp"
+
+using namespace Penrose;
+
+int main(const int argc, const char **argv) {
+
+    if (argc < 2) {
+        fmt::print(stderr, "Usage: {} <file.plog>...\n", argv[0]);
+        return 1;
+    }
+
+    for (int argIdx = 1; argIdx < argc; argIdx++) {
+        auto stream = std::ifstream(argv[argIdx], std::ios::binary);
+
+        if (!stream.is_open()) {
+            fmt::print(stderr, "Failed to open {}\n", argv[argIdx]);
+            return 1;
+        }
+
+        try {
+            readBinaryLog(stream, [](const BinaryLogEntry &entry) {
+                fmt::print(
+                    "{:%Y-%m-%d %H:%M:%S} {}/{} [{:016x}]:\t{}\n", entry.time, toString(entry.level), entry.tag,
+                    entry.thread, entry.msg
+                );
+            });
+        } catch (const EngineError &error) {
+            fmt::print(stderr, "Failed to read {}: {}\n", argv[argIdx], error.what());
+            return 1;
+        }
+    }
+
+    return 0;
+}